@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+#
+# Genera 'src/jit_exec_labels.h' a partir dels BC_CASE de 'exec_inst'
+# en 'src/jit_exec.h'. Cal tornar-lo a executar cada vegada que
+# s'afegeix o s'elimina un bytecode.
+#
+# Ús: scripts/bc_labels.py > src/jit_exec_labels.h
+
+import os
+import re
+import sys
+
+path= os.path.join ( os.path.dirname ( os.path.abspath ( __file__ ) ),
+                     '..', 'src', 'jit_exec.h' )
+with open ( path ) as f:
+    lines= f.read ().split ( '\n' )
+
+beg= None
+for i,line in enumerate ( lines ):
+    if beg is None and 'switch ( p->v[pos] )' in line: beg= i
+    elif beg is not None and line.startswith ( '} // end exec_inst' ):
+        end= i
+        break
+else:
+    sys.exit ( 'exec_inst no trobat' )
+
+out= []
+out.append ( '/* Generat per scripts/bc_labels.py. NO EDITAR. */' )
+out.append ( 'static const void *const BC_LABELS[BC_NUM]=' )
+out.append ( '  {' )
+out.append ( '    [0 ... BC_NUM-1]= &&L_BC_DEFAULT,' )
+for line in lines[beg:end]:
+    m= re.search ( r'BC_CASE\((BC_\w+)\):', line )
+    if m:
+        out.append ( '    [%s]= &&L_%s,'%(m.group ( 1 ),m.group ( 1 )) )
+    elif re.match ( r'#\s*(if|ifdef|ifndef|else|elif|endif)\b', line ) and \
+         'pragma' not in line:
+        out.append ( line )
+
+# Elimina els condicionals que no contenen cap etiqueta.
+changed= True
+while changed:
+    changed= False
+    for i in range ( len ( out ) - 1 ):
+        a,b= out[i].lstrip ( '# ' ),out[i+1].lstrip ( '# ' )
+        if a.startswith ( 'if' ) and b.startswith ( 'endif' ):
+            del out[i:i+2]
+            changed= True
+            break
+        if a.startswith ( 'else' ) and b.startswith ( 'endif' ):
+            del out[i]
+            changed= True
+            break
+out.append ( '  };' )
+print ( '\n'.join ( out ) )
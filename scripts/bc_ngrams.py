@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+#
+# Analitza els perfils generats amb IA32_jit_profile_dump (compilant
+# amb __IA32_JIT_PROFILE__) i mostra els n-grams de bytecodes més
+# freqüents, candidats a ser fusionats en una única instrucció.
+#
+# Ús: scripts/bc_ngrams.py [-n NUM] [-l LONG] perfil1.txt [perfil2.txt ...]
+#
+# Els perfils sols contenen parells. Els n-grams més llargs s'estimen
+# seguint el successor més probable de cada bytecode.
+
+import argparse
+import os
+import re
+import sys
+
+def read_names ():
+    path= os.path.join ( os.path.dirname ( os.path.abspath ( __file__ ) ),
+                         '..', 'src', 'jit.c' )
+    with open ( path ) as f:
+        text= f.read ()
+    beg= text.index ( 'BC_GOTO_EIP= 0' )
+    end= text.index ( 'BC_NUM', beg )
+    names= re.findall ( r'^\s*(BC_\w+)', text[beg:end], re.M )
+    return names
+
+def main ():
+    parser= argparse.ArgumentParser ()
+    parser.add_argument ( '-n', type=int, default=40,
+                          help='nombre de n-grams a mostrar' )
+    parser.add_argument ( '-l', type=int, default=4,
+                          help='longitud màxima dels n-grams estimats' )
+    parser.add_argument ( 'files', nargs='+' )
+    args= parser.parse_args ()
+    names= read_names ()
+    def name ( i ):
+        return '<inici>' if i < 0 else names[i]
+
+    pairs= {}
+    total= 0
+    for fn in args.files:
+        with open ( fn ) as f:
+            for line in f:
+                a,b,c= line.split ()
+                key= (int ( a ),int ( b ))
+                pairs[key]= pairs.get ( key, 0 ) + int ( c )
+                total+= int ( c )
+    if total == 0: sys.exit ( 'perfil buit' )
+
+    # Successors
+    succ= {}
+    out= {}
+    for (a,b),c in pairs.items ():
+        out[a]= out.get ( a, 0 ) + c
+        if a not in succ or c > pairs[(a,succ[a])]: succ[a]= b
+
+    print ( 'Dispatches: %d'%total )
+    print ( '\nParells:' )
+    for (a,b),c in sorted ( pairs.items (), key=lambda x: -x[1] )[:args.n]:
+        if a < 0: continue
+        print ( '  %6.2f%%  %s + %s'%(100.0*c/total,name ( a ),name ( b )) )
+
+    print ( '\nCadenes estimades:' )
+    chains= []
+    for (a,b),c in pairs.items ():
+        if a < 0: continue
+        chain= [a,b]
+        freq= c
+        while len ( chain ) < args.l and chain[-1] in succ:
+            nxt= succ[chain[-1]]
+            freq= freq*pairs[(chain[-1],nxt)]/out[chain[-1]]
+            chain.append ( nxt )
+        chains.append ( (freq,chain) )
+    for freq,chain in sorted ( chains, key=lambda x: -x[0] )[:args.n]:
+        print ( '  %6.2f%%  %s'%(100.0*freq/total,
+                                 ' + '.join ( name ( i ) for i in chain )) )
+
+if __name__ == '__main__':
+    main ()
@@ -30,6 +30,33 @@
  *                           definint este flag ens assegurem que els
  *                           mètodes 'lock/unlock' de l'intèrpret es
  *                           criden abans de cada instrucció.
+ *   - __IA32_JIT_NATIVE__ : El JIT tradueix a codi màquina x86-64 les
+ *                           seqüències d'instruccions que sap
+ *                           traduir. Sols té efecte en x86-64 amb
+ *                           mmap, la resta continua sent bytecode.
+ *   - __IA32_JIT_SWITCH__ : Força que el bytecode s'execute amb un
+ *                           'switch' en compte de 'computed goto'
+ *                           (sols disponible en GCC/Clang).
+ *   - __IA32_JIT_PROFILE__ : El JIT compta quantes vegades s'executa
+ *                            cada parell de bytecodes consecutius
+ *                            (veure IA32_jit_profile_dump i
+ *                            scripts/bc_ngrams.py). Implica
+ *                            __IA32_JIT_SWITCH__.
+ *   - __IA32_JIT_LAZY_FLAGS__ : El JIT no calcula els flags de les
+ *                               instruccions ADD/SUB/CMP/INC/DEC i
+ *                               lògiques fins que algú els llig. Mentre
+ *                               s'executa el JIT (callbacks inclosos)
+ *                               EFLAGS pot no estar actualitzat.
+ *   - __IA32_JIT_SUPERBLOCKS__ : El JIT compta quantes vegades s'entra
+ *                                en cada bloc i, quan un bloc es torna
+ *                                calent, compila un superbloc que
+ *                                segueix el camí observat a través
+ *                                dels salts i de la pàgina següent.
+ *   - __IA32_JIT_CACHE__ : Habilita IA32_jit_cache_save i
+ *                          IA32_jit_cache_load, que guarden en un
+ *                          fitxer les pàgines compilades per a no
+ *                          tornar-les a compilar en una altra
+ *                          execució amb la mateixa memòria.
  */
 
 #ifndef __IA32_H__
@@ -50,6 +77,14 @@
 #error Per favor defineix __LITTLE_ENDIAN__ o __BIG_ENDIAN__
 #endif
 
+#if defined __IA32_JIT_NATIVE__ && defined __x86_64__ && defined __unix__
+#define IA32_JIT_NATIVE
+#endif
+
+#if defined __IA32_JIT_PROFILE__ && !defined __IA32_JIT_SWITCH__
+#define __IA32_JIT_SWITCH__
+#endif
+
 #ifndef __STDC_IEC_559__
 #error IEEE 754 floating point no suportat
 #endif
@@ -896,6 +931,15 @@ IA32_dis (
 /* INTERPRET */
 /*************/
 
+// Motiu pel qual IA32_run o IA32_jit_run han tornat.
+typedef enum
+  {
+    IA32_RUN_BUDGET= 0, // S'han executat totes les instruccions demanades
+    IA32_RUN_INTR, // Hi ha una interrupció que es pot servir
+    IA32_RUN_HALT, // El processador està aturat amb HLT
+    IA32_RUN_STOP // S'ha demanat parar (IA32_stop o IA32_jit_stop)
+  } IA32_RunExit;
+
 typedef struct IA32_Interpreter IA32_Interpreter;
 
 // Interpret d'instruccions.
@@ -954,6 +998,7 @@ struct IA32_Interpreter
   uint32_t _old_EIP;
   bool _intr;
   bool _halted;
+  bool _stop; // Demana parar IA32_run
   bool _ignore_exceptions; // Emprat en mode traça
   int  _int_counter;
   
@@ -1051,6 +1096,25 @@ IA32_exec_next_inst (
         	     IA32_Interpreter *interpreter
         	     );
 
+// Executa instruccions fins que s'executen 'budget' instruccions, hi
+// ha una interrupció que es pot servir, el processador s'atura amb HLT
+// o es crida a IA32_stop. Si en entrar hi ha una interrupció
+// pendent primer es serveix. Torna el nombre d'instruccions executades
+// i en 'reason' el motiu pel qual ha parat.
+int
+IA32_run (
+          IA32_Interpreter *interpreter,
+          const int         budget,
+          IA32_RunExit     *reason
+          );
+
+// Es pot cridar des d'un callback (per exemple d'un port) per a
+// demanar que IA32_run pare en acabar la instrucció actual.
+void
+IA32_stop (
+           IA32_Interpreter *interpreter
+           );
+
 void
 IA32_set_intr (
                IA32_Interpreter *interpreter,
@@ -1081,6 +1145,7 @@ typedef struct
   bool     error; // Pàgina errònea
   bool     svm_addr;
   bool     writing_allowed;
+  bool     global; // Bit G de la PTE
   uint64_t base_addr;
   
 } IA32_JIT_P32_L2_4KB;
@@ -1094,57 +1159,197 @@ typedef struct
   bool pse_enabled; // Açò és el valor que tenia quan es va mapejar.
   bool svm_addr;
   bool writing_allowed;
+  bool rsvd; // Pàgina de 4MB amb bits reservats no nuls
+  bool global; // Bit G de la PDE (sols 4MB)
 
-  // Pàgines
+  // Pàgines. Una pàgina de 4MB no té segon nivell (v4kB és NULL).
   bool                 is4KB;
   IA32_JIT_P32_L2_4KB *v4kB;
 
-  // Adreces
+  // Adreces. Taula de pàgines (4KB) o marc de 4MB.
   uint64_t base_addr;
   
 } IA32_JIT_P32_L1;
 
+// TLB del paginador de 32 bits. Cada entrada és una pàgina virtual de
+// 4KB ja traduïda amb els permisos avaluats per a l'estat actual
+// (veure P32_TLB_* en jit_pag.h). Hi ha una taula per a accessos
+// d'usuari i altra per a supervisor, indexades pel número de pàgina.
+#define IA32_JIT_P32_TLB_BITS 8
+#define IA32_JIT_P32_TLB_SIZE (1<<IA32_JIT_P32_TLB_BITS)
+
+typedef struct
+{
+
+  uint32_t  vpn; // Número de pàgina virtual (addr>>12)
+  uint32_t  perm; // 0 si l'entrada està buida
+  uint64_t  frame; // Adreça física de la pàgina
+  uint8_t  *host; // Memòria de l'amfitrió de la pàgina, o NULL
+  
+} IA32_JIT_P32_TLB;
+
+// Nombre d'espais d'adreces (valors de CR3) que es mantenen en
+// memòria. Les taules de tots ells es vigilen amb les escriptures, per
+// tant es poden reutilitzar directament quan es torna a carregar CR3.
+#define IA32_JIT_P32_SPACES 4
+
 typedef struct
 {
   
-  IA32_JIT_P32_L1 v[IA32_JIT_P32_L1_SIZE];
-  int             a[IA32_JIT_P32_L1_SIZE]; // Entrades actives
-  int             N; // Nombre d'entrades actives
-  uint64_t        addr_min;
-  uint64_t        addr_max;
-  uint64_t        base_addr; // Adreça base de la taula.
+  bool             valid; // Cert si conté l'espai de 'base_addr'
+  IA32_JIT_P32_L1  v[IA32_JIT_P32_L1_SIZE];
+  int              a[IA32_JIT_P32_L1_SIZE]; // Entrades actives
+  int              N; // Nombre d'entrades actives
+  uint64_t         addr_min;
+  uint64_t         addr_max;
+  uint64_t         base_addr; // Adreça base de la taula.
+  uint32_t        *pt_bitmap; // Un bit per marc físic de 4KB que
+                              // conté el directori o una taula de
+                              // pàgines actius
+  IA32_JIT_P32_TLB tlb[2][IA32_JIT_P32_TLB_SIZE]; // [0] usuari,
+                                                  // [1] supervisor
   
 } IA32_JIT_Paging32b;
 
+// Bloc [first,last] (entrades del mapa del mode 'is32') que s'ha
+// compilat sense conéixer els flags del successor 'succ' (entrada de
+// la mateixa pàgina i mode). Quan es compile 'succ' el bloc es
+// descarta per a tornar-lo a compilar. En IA32_JIT_Page.flags_deps
+// indica que el bloc ha emprat els flags de l'entrada 'succ', i s'ha
+// de descartar si es descarta el bloc de 'succ'.
 typedef struct
 {
-  uint32_t ind; // 0 vol dir NULL, i 1 part d'instrucció. 2 o major és
-                // una posició d'una instrucció.
-  bool     is32;  // Per a cada entrada de map que siga > 1 indica si
-                  // el processador estava en mode 32bits quan es va
-                  // descodificar o no. (Independentment que desrpés
-                  // amb modificadors s'intercanviara el mode)
-} IA32_JIT_PageEntry;
+  uint32_t succ;
+  uint32_t first;
+  uint32_t last;
+  uint32_t is32;
+} IA32_JIT_PageReopt;
+
+// Bloc compilat d'una pàgina. Ocupa les entrades [first,last] (la
+// primera és on comença la primera instrucció) del mapa del mode
+// 'is32'.
+typedef struct
+{
+  uint32_t first;
+  uint32_t last;
+  uint32_t is32;
+} IA32_JIT_PageBlock;
 
 typedef struct IA32_JIT_Page IA32_JIT_Page;
 
+// Arena on es reserva el bytecode i els mapes d'entrades de les
+// pàgines. La memòria es demana al sistema en blocs grans on es
+// reparteixen trossos consecutius per classes de grandària. Els
+// trossos alliberats es guarden en la llista de la seua classe per a
+// tornar-los a utilitzar.
+#define IA32_JIT_ARENA_CLASSES 20
+
+typedef struct IA32_JIT_ArenaChunk IA32_JIT_ArenaChunk;
+
+struct IA32_JIT_ArenaChunk
+{
+  IA32_JIT_ArenaChunk *next;
+  size_t               used; // Bytes ja repartits
+  size_t               live; // Bytes de trossos en ús
+};
+
+typedef struct
+{
+  IA32_JIT_ArenaChunk *chunks; // El primer és on es reparteix
+  void                *free[IA32_JIT_ARENA_CLASSES];
+  size_t               bytes; // Memòria demanada al sistema
+} IA32_JIT_Arena;
+
+// Enllaç directe entre blocs. Cada bytecode de salt té associat un
+// slot on es guarda la destinació que es va resoldre l'última
+// vegada. Sols és vàlid si 'gen' coincideix amb el _link_gen del JIT
+// i l'adreça linial, el mode i el CPL són els mateixos.
+typedef struct
+{
+  IA32_JIT_Page *page;
+  uint32_t       pos;
+  uint32_t       laddr;
+  uint32_t       gen; // 0 vol dir no resolt
+  bool           is32;
+  int            cpl;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  uint32_t       entry; // Entrada de 'page' corresponent a 'pos'
+#endif
+} IA32_JIT_PageLink;
+
 struct IA32_JIT_Page
 {
 
-  // Entrades pàgina
-  IA32_JIT_PageEntry *entries;
+  // Entrades pàgina. Vectors paral·lels amb una entrada per byte de
+  // la pàgina. 'entries' conté la posició: 0 vol dir NULL, i 1 part
+  // d'instrucció. 2 o major és una posició d'una instrucció (sempre
+  // cap en 16 bits). Una posició pot caure dins d'una instrucció
+  // d'altre flux (codi que bota a meitat d'instrucció), els dos
+  // fluxos conviuen. Per a les posicions, 'entries_info' indica els
+  // flags (OSZACP) que necessita la instrucció o les següents abans
+  // de ser sobreescrits (veure ENTRY_INFO_* en jit.c). Hi ha un mapa per
+  // mode (índex 0 16 bits, 1 32 bits) perquè el mateix codi es pot
+  // executar en els dos, cadascun es reserva en un únic bloc que
+  // apunta 'entries[is32]' sols quan es compila alguna cosa en eixe
+  // mode (NULL en cas contrari).
+  uint16_t           *entries[2];
+  uint8_t            *entries_info[2];
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  uint8_t            *entries_count[2]; // Vegades que s'ha entrat per
+                                        // un enllaç (satura)
+#endif
   int                 area_id;
   uint32_t            page_id;
-  uint32_t            first_entry; // Primera entrada de map que no és 0
-  uint32_t            last_entry; // Última entrada de map que no és 0
-  int                 overlap_next_page; // Número de bytes de
-                                         // l'última instrucció que se
-                                         // n'ixen de la pàgina actual
+  uint32_t            first_entry; // Primera entrada (dels dos mapes)
+                                   // que no és 0
+  uint32_t            last_entry; // Última entrada que no és 0
+  int                 overlap_next_page; // Màxim número de bytes
+                                         // de les últimes
+                                         // instruccions que se n'ixen
+                                         // de la pàgina actual
   
   // Instruccions
-  uint16_t *v; // El 0 i l'1 estan reservats
-  uint32_t  capacity;
-  uint32_t  N;
+  uint16_t       *v; // El 0 i l'1 estan reservats
+  uint32_t        capacity;
+  uint32_t        N;
+  IA32_JIT_Arena *arena; // D'on es reserva 'v' i 'entries'
+
+  // Enllaços
+  IA32_JIT_PageLink *links;
+  uint32_t           links_capacity;
+  uint32_t           links_N;
+
+  // Blocs (per a descartar sols els que toca una escriptura)
+  IA32_JIT_PageBlock *blocks;
+  uint32_t            blocks_capacity;
+  uint32_t            blocks_N;
+
+  // Optimització de flags entre blocs
+  IA32_JIT_PageReopt *reopts;
+  uint32_t            reopts_capacity;
+  uint32_t            reopts_N;
+  IA32_JIT_PageReopt *flags_deps;
+  uint32_t            flags_deps_capacity;
+  uint32_t            flags_deps_N;
+  bool                flags_dep_prev; // Empra flags de les entrades
+  bool                flags_dep_next; // de la pàgina anterior/següent
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  // Superblocs
+  bool                sb_dep_next; // Algun superbloc continua en la
+                                   // pàgina següent
+  bool                sb_covered; // Algun superbloc conté
+                                  // instruccions d'esta pàgina
+#endif
+
+#ifdef IA32_JIT_NATIVE
+  // Codi natiu (memòria executable)
+  uint8_t  *native;
+  uint32_t  native_capacity;
+  uint32_t  native_N;
+#endif
+  
+  // Memòria que la pàgina té comptada en IA32_JIT._bytes
+  size_t bytes;
   
   // Per a gestionar-los en una llista
   IA32_JIT_Page *next;
@@ -1157,15 +1362,47 @@ typedef struct
   IA32_Inst inst;
   uint32_t  addr;
   uint32_t  flags; // Flags que s'han de calcular
+  bool      defer_eip; // No actualitza la EIP fins la següent parada
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  int       sb; // SB_* (veure sb_build)
+#endif
 } IA32_JIT_DisEntry;
 
+// Pàgines d'una àrea. El mapa és un radix de dos nivells (veure
+// MAP_LEAF_BITS en jit.c), les fulles es reserven quan s'hi fica la
+// primera pàgina.
 typedef struct
 {
-  uint32_t        first_addr;
-  uint32_t        last_addr;
-  IA32_JIT_Page **map;
+  uint32_t         first_addr;
+  uint32_t         last_addr;
+  IA32_JIT_Page ***map;
+  uint32_t         map_size; // Entrades del primer nivell
+  int              bits_page; // Grandària de pàgina de l'àrea
+  uint32_t         page_low_mask;
+  bool             rom; // Veure IA32_JIT_MemArea
 } IA32_JIT_MemMap;
 
+#ifdef __IA32_JIT_CACHE__
+// Capçalera de cada pàgina d'un fitxer de cache (veure
+// IA32_jit_cache_save). Darrere van les entrades, el bytecode, els
+// reopts, els blocs i les dependències de flags de la pàgina.
+typedef struct
+{
+  uint32_t sum; // FNV-1a de la resta del registre. Ha d'anar primer.
+  uint32_t addr; // Adreça física de la pàgina
+  uint32_t hash[2]; // Dels bytes de la pàgina i del solapament
+  uint32_t flags; // CACHE_REC_* (veure jit_cache.h)
+  uint32_t overlap;
+  uint32_t first_entry;
+  uint32_t last_entry;
+  uint32_t N;
+  uint32_t links_N;
+  uint32_t reopts_N;
+  uint32_t blocks_N;
+  uint32_t flags_deps_N;
+} IA32_JIT_CacheRec;
+#endif
+
 typedef struct IA32_JIT IA32_JIT;
 
 struct IA32_JIT
@@ -1188,6 +1425,15 @@ struct IA32_JIT
   void (*mem_write16) (void *udata,const uint64_t addr,const uint16_t data);
   void (*mem_write32) (void *udata,const uint64_t addr,const uint32_t data);
 
+  // Callback opcional (pot ser NULL). Torna un punter a la memòria de
+  // l'amfitrió amb els 4KB físics que comencen en 'addr' si són RAM
+  // (no ROM) sense efectes laterals, NULL en cas contrari. Amb la
+  // paginació activada el JIT llig i escriu directament en ella sense
+  // passar pels callbacks anteriors. El punter ha de continuar sent
+  // vàlid fins que es cride IA32_jit_area_remapped sobre eixa zona o
+  // IA32_jit_reset.
+  uint8_t *(*mem_host_page) (void *udata,const uint64_t addr);
+
   // Callbacks ports.
   uint8_t (*port_read8) (void *udata,const uint16_t port);
   uint16_t (*port_read16) (void *udata,const uint16_t port);
@@ -1210,33 +1456,73 @@ struct IA32_JIT
   }                     _exception;
   int                  *_clock; // Ho incrementa el jit, però es reseteja.
   
+#ifdef __IA32_JIT_PROFILE__
+  uint64_t             *_prof; // Comptadors de parells de bytecodes
+#endif
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  struct
+  {
+    int      op; // LAZY_AD, LAZY_SB o LAZY_LOP
+    uint32_t sign; // Bit de signe (0x80000000 o 0x8000)
+    uint32_t op0;
+    uint32_t op1;
+    uint32_t res;
+    uint32_t mask; // Flags pendents de calcular
+  }                     _lazy;
+#endif
+  
   // -> Desenssamblar
   IA32_Disassembler  _dis;
   bool               _optimize_flags;
+#ifdef IA32_JIT_NATIVE
+  bool               _native; // Es desactiva si no hi ha memòria executable
+#endif
   IA32_JIT_DisEntry *_dis_v;
   size_t             _dis_capacity;
   
   // -> Pàgines
-  int               _bits_page;
-  uint32_t          _page_low_mask;
   IA32_JIT_MemMap  *_mem_map;
   int               _mem_map_size;
+  int              *_area_lut; // Primera àrea que toca cada bloc de
+                               // l'espai físic (-1 cap). Veure
+                               // AREA_LUT_SHIFT en jit.c.
+  uint32_t         *_code_bitmap; // Un bit per marc físic de 4KB
+                                  // que pot contindre codi compilat.
   IA32_JIT_Page    *_free_pages; // Pàgines que es poden reciclar
-  IA32_JIT_Page    *_pages; // Pàgines en ús
+  IA32_JIT_Page    *_pages; // Pàgines en ús (la primera és la
+                            // última que s'ha executat)
   IA32_JIT_Page    *_pages_tail;
+  size_t            _bytes; // Memòria de totes les pàgines
+  size_t            _max_bytes; // SIZE_MAX si no hi ha límit
+  IA32_JIT_Arena    _arena;
   IA32_JIT_Page    *_lock_page; // Impideix que una pàgina que
                                 // s'esborra es fique en _free_nodes.
   bool              _free_lock_page;
   IA32_JIT_Page    *_current_page; // Pàgina actual. Pot ser NULL
   uint32_t          _current_pos; // Posició dins de la pàgina
-  bool              _stop_after_port_write;
+  bool              _stop; // Demana parar IA32_jit_run
+  uint32_t          _link_gen; // S'incrementa cada vegada que algun
+                               // enllaç entre blocs pot ser invàlid.
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  uint32_t          _current_entry; // Entrada de _current_pos
+                                    // (sols després de goto_eip)
+#endif
+#ifdef __IA32_JIT_CACHE__
+  uint8_t                  *_cache; // Fitxer carregat (NULL si no n'hi ha)
+  const IA32_JIT_CacheRec **_cache_recs; // Ordenades per adreça
+  bool                     *_cache_used; // Per a cada _cache_recs
+  uint32_t                  _cache_N;
+#endif
 
   // Paginació
-  IA32_JIT_Paging32b *_pag32;
+  IA32_JIT_Paging32b *_pag32; // Espai actiu (_pag32_v[0])
+  IA32_JIT_Paging32b *_pag32_v[IA32_JIT_P32_SPACES]; // De més a menys
+                                                     // recent
   
   // Interrupcions
   bool _inhibit_interrupt;
   bool _intr;
+  bool _halted; // Per HLT, fins la pròxima interrupció
   bool _ignore_exceptions; // Per al mode traça
   
   // -> callbacks mem.
@@ -1312,10 +1598,21 @@ struct IA32_JIT
   
 };
 
+// Si 'rom' el contingut de l'àrea no canvia mai (BIOS, ROMs
+// d'expansió...): el JIT no vigila les escriptures sobre el seu codi
+// ni IA32_jit_addr_changed el descarta. Si l'embolcall canvia el que
+// hi ha mapat (shadow RAM...) ha de cridar IA32_jit_area_remapped.
+// Cada àrea pot tindre la seua grandària de pàgina: pàgines menudes
+// limiten el codi que es descarta quan es modifica (RAM), i grans
+// redueixen les consultes al mapa i permeten blocs més llargs (ROM,
+// codi del nucli).
 typedef struct
 {
   uint32_t addr; // Ha d'estat aliniat amb la grandària de pàgina elegida.
   size_t   size;
+  bool     rom;
+  int      bits_page; // 2^bits_page és la grandària de pàgina de
+                      // l'àrea, 0 per a utilitzar la de IA32_jit_new
 } IA32_JIT_MemArea;
 
 // Reserva memòria i inicialitza estat privat. Ningun callback
@@ -1325,8 +1622,9 @@ IA32_JIT *
 IA32_jit_new (
               IA32_CPU               *cpu,
               const int               bits_page, // 2^bits_page és la
-                                                 // grandària de cada
-                                                 // pàgina
+                                                 // grandària de pàgina
+                                                 // per defecte (veure
+                                                 // IA32_JIT_MemArea)
               const bool              optimize_flags,
               const IA32_JIT_MemArea *mem_areas,
               const int               N
@@ -1347,7 +1645,58 @@ IA32_jit_clear_areas (
                       IA32_JIT *jit
                       );
 
-// Torna cert en cas de pàgina esborrada, false si tot continua igual.
+// Fixa la memòria màxima (en bytes) que poden ocupar les pàgines
+// compilades. Quan se supera s'alliberen les pàgines lliures i
+// després les que fa més temps que no s'executen. 0 vol dir sense
+// límit (per defecte).
+void
+IA32_jit_set_max_bytes (
+                        IA32_JIT     *jit,
+                        const size_t  max_bytes
+                        );
+
+// Memòria que ocupen ara mateix les pàgines compilades (incloent les
+// lliures).
+size_t
+IA32_jit_get_bytes (
+                    IA32_JIT *jit
+                    );
+
+// Torna al sistema la memòria de les pàgines lliures i els blocs de
+// l'arena que han quedat buits.
+void
+IA32_jit_trim (
+               IA32_JIT *jit
+               );
+
+#ifdef __IA32_JIT_CACHE__
+// Guarda en 'file_name' les pàgines compilades que no depenen de les
+// seues veïnes ni tenen codi natiu. Torna false si no s'ha pogut
+// escriure el fitxer.
+bool
+IA32_jit_cache_save (
+                     IA32_JIT   *jit,
+                     const char *file_name
+                     );
+
+// Carrega un fitxer creat amb IA32_jit_cache_save (descarta el que
+// s'haguera carregat abans). Quan cal compilar una pàgina nova es
+// busca primer en el fitxer, i sols s'utilitza si els bytes de la
+// pàgina no han canviat. Torna false si el fitxer no existeix, està
+// mal format o es va crear amb altres opcions del JIT.
+bool
+IA32_jit_cache_load (
+                     IA32_JIT   *jit,
+                     const char *file_name
+                     );
+#endif
+
+// Torna cert si s'ha descartat codi compilat (sols els blocs que
+// contenen l'adreça si és possible), false si tot continua igual.
+// Les escriptures fetes pel propi JIT ja es detecten internament, sols
+// cal cridar-la quan la memòria es modifica per altres vies (DMA,
+// dispositius...). Si l'adreça no està en un marc amb codi compilat
+// ni en una taula de pàgines torna immediatament.
 bool
 IA32_jit_addr_changed (
                        IA32_JIT       *jit,
@@ -1367,6 +1716,33 @@ IA32_jit_exec_next_inst (
                          IA32_JIT *jit
                          );
 
+// Igual que IA32_run però per al JIT. Les instruccions s'executen
+// sense eixir del bucle del bytecode.
+int
+IA32_jit_run (
+              IA32_JIT     *jit,
+              const int     budget,
+              IA32_RunExit *reason
+              );
+
+// Igual que IA32_stop però per al JIT.
+void
+IA32_jit_stop (
+               IA32_JIT *jit
+               );
+
+#ifdef __IA32_JIT_PROFILE__
+// Escriu en 'f' els comptadors de parells de bytecodes consecutius
+// amb el format 'anterior següent comptador' (un per línia, sols els
+// distints de 0). L'anterior és -1 per al primer bytecode executat en
+// cada crida.
+void
+IA32_jit_profile_dump (
+                       IA32_JIT *jit,
+                       FILE     *f
+                       );
+#endif
+
 void
 IA32_jit_set_intr (
                    IA32_JIT   *jit,
@@ -2451,6 +2451,8 @@ mem_readl128 (
 #define PDE_US      0x00000004
 #define PDE_PS      0x00000080
 #define PDE_PTEADDR 0xFFFFF000
+#define PDE_4MBADDR 0xFFC00000
+#define PDE_4MBRSVD 0x003FE000 // Sense PSE-36 (MAXPHYADDR = 32)
 
 #define PTE_P       0x00000001
 #define PTE_RW      0x00000002
@@ -2597,24 +2599,34 @@ page32_translate_addr (
   // Accedeix en funció grandària.
   if (  pse_enabled && (pde&PDE_PS) != 0 ) // 4MB
     {
-      // NOTA!!! ACÍ CAL COMPROVAR RESERVED BITS. ELS RESERVED BITS EN
-      // AQUEST CAS ÉS VARIABLE DEPENENT DE LES CARACTERÍSTIQUES DE LA
-      // CPU!!!!
-      // TODO!!!!!!!
-      fprintf ( stderr, "[CAL_IMPLEMENTAR] page32_translate_addr - 4MB\n" );
-      exit ( EXIT_FAILURE );
+      
+      // Comprovació reserved bits. Depenen de MAXPHYADDR, la CPU no
+      // implementa PSE-36 i per tant són els bits 21:13.
+      if ( (pde&PDE_4MBRSVD) != 0 )
+        {
+          ecode= ECODE_P|ECODE_RSVD;
+          goto error;
+        }
+      
+      // Comprova permisos d'access
+      if ( page32_check_access ( INTERP, explicit_svm, implicit_svm,
+                                 svm_addr, writing_allowed, ifetch,
+                                 writing ) != 0 )
+        {
+          ecode= ECODE_P; // page-level protection violation
+          goto error;
+        }
+      
+      // Adreça final
+      ret= (uint64_t) ((pde&PDE_4MBADDR) | (addr&0x003FFFFF));
+      
     }
   else // 4KB
     {
       
-      // Comprovació reserved bits.
-      if ( pse_enabled ) // i PAT 
-        {
-          fprintf ( stderr, "[CAL_IMPLEMENTAR] page32_translate_addr"
-                    " - 4KB comprovació reserved bits\n" );
-          exit ( EXIT_FAILURE );
-        }
-
+      // En 32-bit paging les entrades de 4KB no tenen bits reservats
+      // (amb CR4.PSE el bit 7 de la PTE és PAT).
+      
       // Obté pte
       pte_addr= (uint64_t) ((pde&PDE_PTEADDR) | ((addr>>10)&0x00000FFC));
       pte= READU32 ( pte_addr );
@@ -6205,6 +6217,7 @@ IA32_interpreter_init (
   INTERP->_repne_repnz_enabled= false;
   INTERP->_intr= false;
   INTERP->_halted= false;
+  INTERP->_stop= false;
   INTERP->_ignore_exceptions= false;
   INTERP->_int_counter= 0;
   
@@ -6246,6 +6259,56 @@ IA32_exec_next_inst (
 } // end IA32_exec_next_inst
 
 
+int
+IA32_run (
+          PROTO_INTERP,
+          const int     budget,
+          IA32_RunExit *reason
+          )
+{
+
+  int count;
+  
+  
+  // Serveix la interrupció pendent si és el cas.
+  if ( !(INTERP->_inhibit_interrupt) &&
+       INTERP->_intr && (EFLAGS&IF_FLAG)!= 0 )
+    IA32_exec_next_inst ( interpreter );
+
+  // Executa.
+  for ( count= 0; count < budget; )
+    {
+      if ( INTERP->_halted ) { *reason= IA32_RUN_HALT; return count; }
+      if ( !(INTERP->_inhibit_interrupt) &&
+           INTERP->_intr && (EFLAGS&IF_FLAG)!= 0 )
+        { *reason= IA32_RUN_INTR; return count; }
+      IA32_exec_next_inst ( interpreter );
+      ++count;
+      // El HLT que atura la CPU es compta i ho indica.
+      if ( INTERP->_halted ) { *reason= IA32_RUN_HALT; return count; }
+      if ( INTERP->_stop )
+        {
+          INTERP->_stop= false;
+          *reason= IA32_RUN_STOP;
+          return count;
+        }
+    }
+  *reason= IA32_RUN_BUDGET;
+  
+  return count;
+  
+} // end IA32_run
+
+
+void
+IA32_stop (
+           PROTO_INTERP
+           )
+{
+  INTERP->_stop= true;
+} // end IA32_stop
+
+
 void
 IA32_interpreter_init_dis (
                            IA32_Interpreter  *interpreter,
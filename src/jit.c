@@ -27,9 +27,14 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "IA32.h"
 
+#ifdef IA32_JIT_NATIVE
+#include <sys/mman.h>
+#endif
+
 
 
 
@@ -45,6 +50,79 @@
 #define NULL_ENTRY 0
 #define PAD_ENTRY 1
 
+// Les posicions de les entrades són de 16 bits. Si en compilar una
+// instrucció el bytecode de la pàgina ja supera MAX_ENTRY_POS es
+// torna a compilar tota la pàgina. Perquè en una pàgina buida sempre
+// càpiga un bloc es limita el seu nombre d'instruccions.
+#define MAX_ENTRY_POS 0xFFFF
+#define DIS_MAX_INSTS 512
+
+// Informació d'una entrada (IA32_JIT_Page.entries_info). Els flags
+// SZAPC ocupen el mateix bit que en EFLAGS i OF es guarda en el bit 1
+// (reservat en EFLAGS). El mode és el del mapa.
+#define ENTRY_INFO_OF   0x02
+#define ENTRY_INFO_SZAPC (SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|CF_FLAG)
+#define ENTRY_INFO(FLAGS)                                       \
+  ((uint8_t) (((FLAGS)&ENTRY_INFO_SZAPC) |                      \
+              (((FLAGS)&OF_FLAG) ? ENTRY_INFO_OF : 0)))
+#define ENTRY_FLAGS(INFO)                                       \
+  ((((uint32_t) (INFO))&ENTRY_INFO_SZAPC) |                     \
+   (((INFO)&ENTRY_INFO_OF) ? OF_FLAG : 0))
+#ifdef __IA32_JIT_SUPERBLOCKS__
+#define ENTRY_BYTES (sizeof(uint16_t)+2) // Posició, informació i comptador
+#else
+#define ENTRY_BYTES (sizeof(uint16_t)+1) // Posició i informació
+#endif
+
+#define NO_LINK 0xFFFF
+
+// Registre absent en BC_*_READ32_SIB_* (veure REG32_OFF).
+#define SIB_NOREG 0xFF
+
+// Mapa de pàgines de cada àrea (IA32_JIT_MemMap.map). Cada fulla té
+// 2^MAP_LEAF_BITS pàgines.
+#define MAP_LEAF_BITS 10
+#define MAP_LEAF_MASK ((1<<MAP_LEAF_BITS)-1)
+
+// Màscara de la posició dins de la pàgina 'P', la grandària de pàgina
+// és la de la seua àrea (IA32_JIT_MemMap.bits_page).
+#define PAGE_LOW_MASK(P) (jit->_mem_map[(P)->area_id].page_low_mask)
+
+// Blocs de 2^AREA_LUT_SHIFT bytes de l'espai físic en IA32_JIT._area_lut.
+#define AREA_LUT_SHIFT 20
+#define AREA_LUT_SIZE  (1<<(32-AREA_LUT_SHIFT))
+
+// Arena (veure IA32_JIT_Arena). Les classes són ARENA_MIN_BYTES,
+// 1.5*ARENA_MIN_BYTES, 2*ARENA_MIN_BYTES, 3*ARENA_MIN_BYTES, ... Els
+// trossos més grans que l'última classe es demanen directament al
+// sistema.
+#define ARENA_MIN_BYTES   256
+#define ARENA_MAX_BYTES   \
+  ((3*ARENA_MIN_BYTES)<<((IA32_JIT_ARENA_CLASSES/2)-2))
+#define ARENA_CHUNK_BYTES (1<<20)
+
+#ifdef __IA32_JIT_SUPERBLOCKS__
+// Camí que segueix un superbloc en un salt (IA32_JIT_DisEntry.sb)
+#define SB_NONE      0 // No és un salt del superbloc
+#define SB_TAKEN     1 // Continua en la destinació
+#define SB_NOT_TAKEN 2 // Continua en la instrucció següent
+// Entrades a un bloc abans de compilar el superbloc i màxim
+// d'instruccions d'un superbloc.
+#define SB_HOT       64
+#define SB_MAX_INSTS 128
+#endif
+
+#ifdef __IA32_JIT_LAZY_FLAGS__
+#define LAZY_AD  0
+#define LAZY_SB  1
+#define LAZY_LOP 2
+#endif
+
+// Dispatch del bytecode amb 'computed goto' (extensió de GCC).
+#if defined __GNUC__ && !defined __IA32_JIT_SWITCH__
+#define JIT_THREADED
+#endif
+
 #define l_P_CS (&(l_cpu->cs))
 #define l_P_DS (&(l_cpu->ds))
 #define l_P_SS (&(l_cpu->ss))
@@ -93,6 +171,10 @@
 #define l_DH  (l_cpu->edx.b.v1)
 #define l_DL  (l_cpu->edx.b.v0)
 
+// Registre a partir del seu desplaçament en IA32_CPU (REG32_OFF/REG16_OFF).
+#define l_REG32(OFF) (*((uint32_t *) (((uint8_t *) l_cpu) + (OFF))))
+#define l_REG16(OFF) (*((uint16_t *) (((uint8_t *) l_cpu) + (OFF))))
+
 #define l_IDTR (l_cpu->idtr)
 #define l_GDTR (l_cpu->gdtr)
 #define l_LDTR (l_cpu->ldtr)
@@ -154,6 +236,7 @@
 #define CR4_PVI        0x00000002
 #define CR4_PSE        0x00000010
 #define CR4_PAE        0x00000020
+#define CR4_PGE        0x00000080
 #define CR4_OSFXSR     0x00000200
 #define CR4_OSXMMEXCPT 0x00000400
 #define CR4_SMEP       0x00100000
@@ -338,6 +421,18 @@
 #define WRITEU16(ADDR,DATA) jit->mem_write16 ( jit->udata, ADDR, DATA )
 #define WRITEU32(ADDR,DATA) jit->mem_write32 ( jit->udata, ADDR, DATA )
 
+// Marcs físics de 4KB que poden contindre codi compilat
+// (IA32_JIT._code_bitmap). Les escriptures del JIT que toquen algun
+// d'estos marcs comproven si cal esborrar pàgines (veure code_written).
+#define CODE_FRAME_BITS  12
+#define CODE_BITMAP_SIZE (1<<(32-CODE_FRAME_BITS-5))
+#define IS_CODE_FRAME(ADDR)                                             \
+  ((jit->_code_bitmap[((uint32_t) (ADDR))>>(CODE_FRAME_BITS+5)]>>       \
+    ((((uint32_t) (ADDR))>>CODE_FRAME_BITS)&0x1F))&0x1)
+#define CHECK_CODE_WRITE(ADDR,NBYTES)                                   \
+  if ( IS_CODE_FRAME(ADDR) || IS_CODE_FRAME((ADDR)+((NBYTES)-1)) )      \
+    code_written ( jit, (uint32_t) (ADDR), (NBYTES) )
+
 // Macros per a llegir del 'linear-address space'.
 #define READLB(ADDR,P_DST,ACTION_ON_ERROR,IS_DATA)                      \
   if ( jit->_mem_readl8 ( jit, ADDR, P_DST, IS_DATA ) != 0 )            \
@@ -438,6 +533,20 @@ enum {
   BC_INC11_EIP_NOSTOP,
   BC_INC12_EIP_NOSTOP,
   BC_INC14_EIP_NOSTOP,
+  BC_INC1_EIP_GOTO, // Fusió de INCn_EIP_NOSTOP+GOTO_EIP
+  BC_INC2_EIP_GOTO,
+  BC_INC3_EIP_GOTO,
+  BC_INC4_EIP_GOTO,
+  BC_INC5_EIP_GOTO,
+  BC_INC6_EIP_GOTO,
+  BC_INC7_EIP_GOTO,
+  BC_INC8_EIP_GOTO,
+  BC_INC9_EIP_GOTO,
+  BC_INC10_EIP_GOTO,
+  BC_INC11_EIP_GOTO,
+  BC_INC12_EIP_GOTO,
+  BC_INC14_EIP_GOTO,
+  BC_INC_EIP_DEFER, // Acumula l'increment fins la següent parada
   BC_WRONG_INST,  // Aquesta instrucció està sempre en bucle
   BC_INC2_PC_IF_ECX_IS_0,
   BC_INC2_PC_IF_CX_IS_0,
@@ -453,6 +562,14 @@ enum {
   BC_DECIMM_PC_IF_REPNE32,
   BC_DECIMM_PC_IF_REPE16,
   BC_DECIMM_PC_IF_REPNE16,
+  BC_NATIVE, // Executa codi natiu si el pressupost ho permet
+  BC_LAZY_FLAGS, // Calcula els flags pendents indicats
+  BC_SB_JMP32, // Salts que continuen dins del superbloc
+  BC_SB_JMP16,
+  BC_SB_BRANCH32,
+  BC_SB_BRANCH16,
+  BC_SB_GOTO, // Bota a una posició anterior del superbloc
+  BC_SB_GUARD, // Comprova l'adreça física en canviar de pàgina
   BC_UNK,
   
   // Bytecodes carrega dades
@@ -578,6 +695,9 @@ enum {
   BC_SET32_SF_EFLAGS,
   BC_SET32_ZF_EFLAGS,
   BC_SET32_PF_EFLAGS,
+  BC_SET32_AD_EFLAGS, // Fusió de BC_SET32_AD_*,SF,ZF,PF (+màscara)
+  BC_SET32_SB_EFLAGS, // Fusió de BC_SET32_SB_*,SF,ZF,PF (+màscara)
+  BC_SET32_LOP_EFLAGS, // Fusió de CLEAR_OF_CF,SF,ZF,PF (+màscara)
   BC_SET16_AD_OF_EFLAGS,
   BC_SET16_AD_AF_EFLAGS,
   BC_SET16_AD_CF_EFLAGS,
@@ -610,6 +730,9 @@ enum {
   BC_SET16_SF_EFLAGS,
   BC_SET16_ZF_EFLAGS,
   BC_SET16_PF_EFLAGS,
+  BC_SET16_AD_EFLAGS,
+  BC_SET16_SB_EFLAGS,
+  BC_SET16_LOP_EFLAGS,
   BC_SET8_AD_OF_EFLAGS,
   BC_SET8_AD_AF_EFLAGS,
   BC_SET8_AD_CF_EFLAGS,
@@ -989,6 +1112,61 @@ enum {
   BC_BRANCH32,
   BC_BRANCH32_IMM32,
   BC_BRANCH16,
+  // Fusió de BC_SET_*_COND+BC_BRANCH*. Mateix ordre que BC_SET_*_COND.
+  BC_BRANCH32_A,
+  BC_BRANCH32_AE,
+  BC_BRANCH32_B,
+  BC_BRANCH32_CXZ,
+  BC_BRANCH32_E,
+  BC_BRANCH32_ECXZ,
+  BC_BRANCH32_G,
+  BC_BRANCH32_GE,
+  BC_BRANCH32_L,
+  BC_BRANCH32_NA,
+  BC_BRANCH32_NE,
+  BC_BRANCH32_NG,
+  BC_BRANCH32_NO,
+  BC_BRANCH32_NS,
+  BC_BRANCH32_O,
+  BC_BRANCH32_P,
+  BC_BRANCH32_PO,
+  BC_BRANCH32_S,
+  BC_BRANCH32_IMM32_A,
+  BC_BRANCH32_IMM32_AE,
+  BC_BRANCH32_IMM32_B,
+  BC_BRANCH32_IMM32_CXZ,
+  BC_BRANCH32_IMM32_E,
+  BC_BRANCH32_IMM32_ECXZ,
+  BC_BRANCH32_IMM32_G,
+  BC_BRANCH32_IMM32_GE,
+  BC_BRANCH32_IMM32_L,
+  BC_BRANCH32_IMM32_NA,
+  BC_BRANCH32_IMM32_NE,
+  BC_BRANCH32_IMM32_NG,
+  BC_BRANCH32_IMM32_NO,
+  BC_BRANCH32_IMM32_NS,
+  BC_BRANCH32_IMM32_O,
+  BC_BRANCH32_IMM32_P,
+  BC_BRANCH32_IMM32_PO,
+  BC_BRANCH32_IMM32_S,
+  BC_BRANCH16_A,
+  BC_BRANCH16_AE,
+  BC_BRANCH16_B,
+  BC_BRANCH16_CXZ,
+  BC_BRANCH16_E,
+  BC_BRANCH16_ECXZ,
+  BC_BRANCH16_G,
+  BC_BRANCH16_GE,
+  BC_BRANCH16_L,
+  BC_BRANCH16_NA,
+  BC_BRANCH16_NE,
+  BC_BRANCH16_NG,
+  BC_BRANCH16_NO,
+  BC_BRANCH16_NS,
+  BC_BRANCH16_O,
+  BC_BRANCH16_P,
+  BC_BRANCH16_PO,
+  BC_BRANCH16_S,
   BC_CALL32_FAR,
   BC_CALL16_FAR,
   BC_CALL32_NEAR_REL,
@@ -1064,6 +1242,56 @@ enum {
   BC_XOR32,
   BC_XOR16,
   BC_XOR8,
+  // --> Peephole (veure peephole en jit_compile.h). Els registres es
+  //     codifiquen amb el desplaçament en IA32_CPU, els parells en
+  //     una paraula (segon<<8|primer). Importa l'ordre.
+  BC_MOV32_REG_REG,
+  BC_MOV16_REG_REG,
+  BC_SET32_IMM32_REG,
+  BC_SET16_IMM_REG,
+  BC_DS_READ32_REG,
+  BC_SS_READ32_REG,
+  BC_DS_READ16_REG,
+  BC_SS_READ16_REG,
+  BC_ADD32_REG_IMM,
+  BC_SUB32_REG_IMM,
+  BC_AND32_REG_IMM,
+  BC_OR32_REG_IMM,
+  BC_XOR32_REG_IMM,
+  BC_CMP32_REG_IMM,
+  BC_TEST32_REG_IMM,
+  BC_ADD32_REG_REG,
+  BC_SUB32_REG_REG,
+  BC_AND32_REG_REG,
+  BC_OR32_REG_REG,
+  BC_XOR32_REG_REG,
+  BC_CMP32_REG_REG,
+  BC_TEST32_REG_REG,
+  BC_ADD16_REG_IMM,
+  BC_SUB16_REG_IMM,
+  BC_AND16_REG_IMM,
+  BC_OR16_REG_IMM,
+  BC_XOR16_REG_IMM,
+  BC_CMP16_REG_IMM,
+  BC_TEST16_REG_IMM,
+  BC_ADD16_REG_REG,
+  BC_SUB16_REG_REG,
+  BC_AND16_REG_REG,
+  BC_OR16_REG_REG,
+  BC_XOR16_REG_REG,
+  BC_CMP16_REG_REG,
+  BC_TEST16_REG_REG,
+  // --> Fusió de l'adreça SIB amb la lectura de 32 bits (DS i SS). Els
+  //     operadors són: registres (índex<<8|base, SIB_NOREG si no n'hi
+  //     ha), desplaçament de l'índex i desplaçament de 32 bits.
+  BC_DS_READ32_SIB_RES,
+  BC_DS_READ32_SIB_OP0,
+  BC_DS_READ32_SIB_OP1,
+  BC_SS_READ32_SIB_RES,
+  BC_SS_READ32_SIB_OP0,
+  BC_SS_READ32_SIB_OP1,
+  BC_DS_READ32_SIB_REG,
+  BC_SS_READ32_SIB_REG,
   // --> Altres
   BC_AAD,
   BC_AAM,
@@ -1247,10 +1475,15 @@ enum {
   BC_FPU_WAIT,
   BC_FPU_XAM,
   BC_FPU_XCH,
-  BC_FPU_YL2X
+  BC_FPU_YL2X,
+
+  BC_NUM // Nombre de bytecodes
   
 };
 
+// Nombre de condicions fusionades amb cada BC_BRANCH*.
+#define BC_BRANCH_CONDS (BC_SET_S_COND-BC_SET_A_COND+1)
+
 
 // Descriptor de segment.
 typedef struct
@@ -1685,6 +1918,34 @@ static const bool PFLAG[256]=
   };
 
 
+// Desplaçament en IA32_CPU dels registres de propòsit general en
+// l'ordre de codificació (EAX,ECX,EDX,EBX,ESP,EBP,ESI,EDI), que és el
+// dels bytecodes BC_SET32_EAX_RES... i BC_SET32_RES_EAX...
+static const uint16_t REG32_OFF[8]=
+  {
+    (uint16_t) offsetof(IA32_CPU,eax.v),
+    (uint16_t) offsetof(IA32_CPU,ecx.v),
+    (uint16_t) offsetof(IA32_CPU,edx.v),
+    (uint16_t) offsetof(IA32_CPU,ebx.v),
+    (uint16_t) offsetof(IA32_CPU,esp.v),
+    (uint16_t) offsetof(IA32_CPU,ebp.v),
+    (uint16_t) offsetof(IA32_CPU,esi.v),
+    (uint16_t) offsetof(IA32_CPU,edi.v)
+  };
+
+static const uint16_t REG16_OFF[8]=
+  {
+    (uint16_t) offsetof(IA32_CPU,eax.w.v0),
+    (uint16_t) offsetof(IA32_CPU,ecx.w.v0),
+    (uint16_t) offsetof(IA32_CPU,edx.w.v0),
+    (uint16_t) offsetof(IA32_CPU,ebx.w.v0),
+    (uint16_t) offsetof(IA32_CPU,esp.w.v0),
+    (uint16_t) offsetof(IA32_CPU,ebp.w.v0),
+    (uint16_t) offsetof(IA32_CPU,esi.w.v0),
+    (uint16_t) offsetof(IA32_CPU,edi.w.v0)
+  };
+
+
 
 
 /*********************/
@@ -1802,6 +2063,34 @@ dis_mem_read_trace (
 } // end dis_mem_read_trace
 
 
+// Invalida tots els enllaços entre blocs. Es crida cada vegada que
+// una pàgina s'esborra o canvia la traducció d'adreces.
+static void
+invalidate_links (
+                  IA32_JIT *jit
+                  )
+{
+
+  IA32_JIT_Page *p;
+  uint32_t n;
+  
+  
+  if ( ++(jit->_link_gen) == 0 )
+    {
+      // Ha pegat la volta. Cal netejar tots els enllaços per a
+      // evitar coincidències amb generacions antigues.
+      for ( p= jit->_pages; p != NULL; p= p->next )
+        for ( n= 0; n < p->links_N; ++n )
+          p->links[n].gen= 0;
+      if ( jit->_lock_page != NULL )
+        for ( n= 0; n < jit->_lock_page->links_N; ++n )
+          jit->_lock_page->links[n].gen= 0;
+      jit->_link_gen= 1;
+    }
+  
+} // end invalidate_links
+
+
 /* PAGINACIÓ ******************************************************************/
 
 #include "jit_pag.h"
@@ -1827,6 +2116,15 @@ mem_readl8 (
 } // end mem_readl8
 
 
+// Veure GESTIÓ PÀGINES.
+static void
+code_written (
+              IA32_JIT       *jit,
+              const uint32_t  addr,
+              const int       nbytes
+              );
+
+
 // Torna 0 si tot ha anat bé, -1 en cas d'excepció.
 static int
 mem_writel8 (
@@ -1837,6 +2135,7 @@ mem_writel8 (
 {
 
   WRITEU8 ( (uint64_t) addr, data );
+  CHECK_CODE_WRITE ( addr, 1 );
   
   return 0;
   
@@ -1888,6 +2187,7 @@ mem_writel16 (
       WRITEU8 ( laddr+1, data>>8 );
     }
   else WRITEU16 ( laddr, data );
+  CHECK_CODE_WRITE ( addr, 2 );
   
   return 0;
   
@@ -1958,6 +2258,7 @@ mem_writel32 (
         }
     }
   else WRITEU32 ( laddr, data );
+  CHECK_CODE_WRITE ( addr, 4 );
   
   return 0;
   
@@ -2058,13 +2359,24 @@ mem_p32_read8 (
                )
 {
 
+  IA32_JIT_P32_TLB *e;
   uint64_t laddr;
 
-
-  laddr= 0;
-  if ( !paging_32b_translate ( jit, addr, &laddr, false,
-                               !reading_data, false ) )
-    return -1;
+  
+  e= paging_32b_tlb_get ( jit, addr,
+                          reading_data ? P32_TLB_READ : P32_TLB_EXEC );
+  if ( e != NULL )
+    {
+      if ( e->host != NULL ) { *dst= e->host[addr&0xFFF]; return 0; }
+      laddr= e->frame | ((uint64_t) (addr&0xFFF));
+    }
+  else
+    {
+      laddr= 0;
+      if ( !paging_32b_translate ( jit, addr, &laddr, false,
+                                   !reading_data, false ) )
+        return -1;
+    }
   *dst= READU8 ( laddr, reading_data );
   
   return 0;
@@ -2081,13 +2393,25 @@ mem_p32_write8 (
                 )
 {
 
+  IA32_JIT_P32_TLB *e;
   uint64_t laddr;
 
-
-  laddr= 0;
-  if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
-    return -1;
-  WRITEU8 ( laddr, data );
+  
+  e= paging_32b_tlb_get ( jit, addr, P32_TLB_WRITE );
+  if ( e != NULL )
+    {
+      laddr= e->frame | ((uint64_t) (addr&0xFFF));
+      if ( e->host != NULL ) e->host[addr&0xFFF]= data;
+      else                   WRITEU8 ( laddr, data );
+    }
+  else
+    {
+      laddr= 0;
+      if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
+        return -1;
+      WRITEU8 ( laddr, data );
+    }
+  CHECK_CODE_WRITE ( laddr, 1 );
   paging_32b_addr_changed ( jit, laddr );
   
   return 0;
@@ -2106,6 +2430,8 @@ mem_p32_read16 (
                 )
 {
   
+  IA32_JIT_P32_TLB *e;
+  const uint8_t *h;
   uint64_t laddr;
   uint8_t tmp;
   uint16_t data;
@@ -2114,10 +2440,26 @@ mem_p32_read16 (
   
   if ( (addr&0x1) == 0 )
     {
-      laddr= 0;
-      if ( !paging_32b_translate ( jit, addr, &laddr, false,
-                                   !reading_data, implicit_svm ) )
-        return -1;
+      e= implicit_svm ? NULL :
+        paging_32b_tlb_get ( jit, addr,
+                             reading_data ? P32_TLB_READ : P32_TLB_EXEC );
+      if ( e != NULL )
+        {
+          if ( e->host != NULL )
+            {
+              h= &(e->host[addr&0xFFF]);
+              *dst= ((uint16_t) h[0]) | (((uint16_t) h[1])<<8);
+              return 0;
+            }
+          laddr= e->frame | ((uint64_t) (addr&0xFFF));
+        }
+      else
+        {
+          laddr= 0;
+          if ( !paging_32b_translate ( jit, addr, &laddr, false,
+                                       !reading_data, implicit_svm ) )
+            return -1;
+        }
       ret= mem_readl16 ( jit, laddr, dst, reading_data, implicit_svm );
     }
   else
@@ -2151,16 +2493,35 @@ mem_p32_write16 (
                  )
 {
 
+  IA32_JIT_P32_TLB *e;
+  uint8_t *h;
   uint64_t laddr;
   int ret;
   
   
   if ( (addr&0x1) == 0 )
     {
-      laddr= 0;
-      if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
-        return -1;
-      ret= mem_writel16 ( jit, laddr, data );
+      e= paging_32b_tlb_get ( jit, addr, P32_TLB_WRITE );
+      if ( e != NULL )
+        {
+          laddr= e->frame | ((uint64_t) (addr&0xFFF));
+          if ( e->host != NULL )
+            {
+              h= &(e->host[addr&0xFFF]);
+              h[0]= (uint8_t) data;
+              h[1]= (uint8_t) (data>>8);
+              CHECK_CODE_WRITE ( laddr, 2 );
+              ret= 0;
+            }
+          else ret= mem_writel16 ( jit, laddr, data );
+        }
+      else
+        {
+          laddr= 0;
+          if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
+            return -1;
+          ret= mem_writel16 ( jit, laddr, data );
+        }
       paging_32b_addr_changed ( jit, laddr );
     }
   else
@@ -2188,6 +2549,8 @@ mem_p32_read32 (
                 )
 {
 
+  IA32_JIT_P32_TLB *e;
+  const uint8_t *h;
   uint64_t laddr;
   uint16_t tmp;
   uint32_t data;
@@ -2196,10 +2559,28 @@ mem_p32_read32 (
 
   if ( (addr&0x3) == 0 )
     {
-      laddr= 0;
-      if ( !paging_32b_translate ( jit, addr, &laddr, false,
-                                   !reading_data, implicit_svm ) )
-        return -1;
+      e= implicit_svm ? NULL :
+        paging_32b_tlb_get ( jit, addr,
+                             reading_data ? P32_TLB_READ : P32_TLB_EXEC );
+      if ( e != NULL )
+        {
+          if ( e->host != NULL )
+            {
+              h= &(e->host[addr&0xFFF]);
+              *dst=
+                ((uint32_t) h[0]) | (((uint32_t) h[1])<<8) |
+                (((uint32_t) h[2])<<16) | (((uint32_t) h[3])<<24);
+              return 0;
+            }
+          laddr= e->frame | ((uint64_t) (addr&0xFFF));
+        }
+      else
+        {
+          laddr= 0;
+          if ( !paging_32b_translate ( jit, addr, &laddr, false,
+                                       !reading_data, implicit_svm ) )
+            return -1;
+        }
       ret= mem_readl32 ( jit, laddr, dst, reading_data, implicit_svm );
     }
   else
@@ -2235,16 +2616,37 @@ mem_p32_write32 (
                  )
 {
 
+  IA32_JIT_P32_TLB *e;
+  uint8_t *h;
   uint64_t laddr;
   int ret;
   
 
   if ( (addr&0x3) == 0 )
     {
-      laddr= 0;
-      if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
-        return -1;
-      ret= mem_writel32 ( jit, laddr, data );
+      e= paging_32b_tlb_get ( jit, addr, P32_TLB_WRITE );
+      if ( e != NULL )
+        {
+          laddr= e->frame | ((uint64_t) (addr&0xFFF));
+          if ( e->host != NULL )
+            {
+              h= &(e->host[addr&0xFFF]);
+              h[0]= (uint8_t) data;
+              h[1]= (uint8_t) (data>>8);
+              h[2]= (uint8_t) (data>>16);
+              h[3]= (uint8_t) (data>>24);
+              CHECK_CODE_WRITE ( laddr, 4 );
+              ret= 0;
+            }
+          else ret= mem_writel32 ( jit, laddr, data );
+        }
+      else
+        {
+          laddr= 0;
+          if ( !paging_32b_translate ( jit, addr, &laddr, true, false, false ) )
+            return -1;
+          ret= mem_writel32 ( jit, laddr, data );
+        }
       paging_32b_addr_changed ( jit, laddr );
     }
   else
@@ -2271,13 +2673,20 @@ mem_p32_read64 (
                 )
 {
 
+  IA32_JIT_P32_TLB *e;
   uint64_t laddr;
 
 
-  laddr= 0;
-  if ( !paging_32b_translate ( jit, addr, &laddr, false,
-                               !reading_data, false ) )
-    return -1;
+  e= paging_32b_tlb_get ( jit, addr,
+                          reading_data ? P32_TLB_READ : P32_TLB_EXEC );
+  if ( e != NULL ) laddr= e->frame | ((uint64_t) (addr&0xFFF));
+  else
+    {
+      laddr= 0;
+      if ( !paging_32b_translate ( jit, addr, &laddr, false,
+                                   !reading_data, false ) )
+        return -1;
+    }
   return mem_readl64 ( jit, laddr, dst, reading_data );
   
 } // end mem_p32_read64
@@ -2293,13 +2702,20 @@ mem_p32_read128 (
                  )
 {
 
+  IA32_JIT_P32_TLB *e;
   uint64_t laddr;
 
 
-  laddr= 0;
-  if ( !paging_32b_translate ( jit, addr, &laddr, false,
-                               !reading_data, false ) )
-    return -1;
+  e= paging_32b_tlb_get ( jit, addr,
+                          reading_data ? P32_TLB_READ : P32_TLB_EXEC );
+  if ( e != NULL ) laddr= e->frame | ((uint64_t) (addr&0xFFF));
+  else
+    {
+      laddr= 0;
+      if ( !paging_32b_translate ( jit, addr, &laddr, false,
+                                   !reading_data, false ) )
+        return -1;
+    }
   return mem_readl128 ( jit, laddr, dst, reading_data );
   
 } // end mem_p32_read128
@@ -2942,6 +3358,9 @@ update_mem_callbacks (
   //
   // FALTA VIRTUAL MODE !!!!
   pag32_enabled= jit->_mem_readl8==mem_p32_read8;
+  invalidate_links ( jit );
+  // Els permisos del TLB depenen de CR0.WP i CR4.
+  paging_32b_tlb_flush_all ( jit );
   if ( jit->_cpu != NULL && (CR0&CR0_PE)!=0 ) // Protected mode.
     {
       
@@ -2961,7 +3380,7 @@ update_mem_callbacks (
           if ( (CR4&CR4_PAE) == 0 )
             {
               // Reseteja si no està ja activat.
-              if ( !pag32_enabled ) paging_32b_CR3_changed ( jit );
+              if ( !pag32_enabled ) paging_32b_reset ( jit );
               jit->_mem_readl8= mem_p32_read8;
               jit->_mem_readl16= mem_p32_read16;
               jit->_mem_readl32= mem_p32_read32;
@@ -3018,7 +3437,318 @@ update_mem_callbacks (
 } // end update_mem_callbacks
 
 
+/* ARENA **********************************************************************/
+// Classe de l'arena d'un tros de 'size' bytes. Torna en 'csize' la
+// grandària de la classe. Torna -1 si és massa gran per a l'arena.
+static int
+arena_class (
+             const size_t  size,
+             size_t       *csize
+             )
+{
+
+  int c;
+  size_t base;
+
+
+  for ( c= 0, base= ARENA_MIN_BYTES;
+        c < IA32_JIT_ARENA_CLASSES;
+        c+= 2, base<<= 1 )
+    {
+      if ( size <= base ) { *csize= base; return c; }
+      if ( size <= base+base/2 ) { *csize= base+base/2; return c+1; }
+    }
+  *csize= size;
+  
+  return -1;
+  
+} // end arena_class
+
+
+// Reserva un tros d'almenys 'size' bytes. Torna en 'csize' la
+// grandària real. Davant de cada tros es guarda el bloc al que
+// pertany (NULL si s'ha demanat directament al sistema).
+static void *
+arena_alloc (
+             IA32_JIT_Arena *a,
+             const size_t    size,
+             size_t         *csize
+             )
+{
+
+  IA32_JIT_ArenaChunk *chunk,**hdr;
+  void *ret;
+  size_t need;
+  int c;
+  
+
+  c= arena_class ( size, csize );
+  if ( c == -1 )
+    {
+      hdr= (IA32_JIT_ArenaChunk **)
+        malloc__ ( sizeof(IA32_JIT_ArenaChunk *) + *csize );
+      *hdr= NULL;
+      return (void *) (hdr+1);
+    }
+  
+  // Tros lliure de la classe.
+  if ( a->free[c] != NULL )
+    {
+      ret= a->free[c];
+      a->free[c]= *((void **) ret);
+      chunk= ((IA32_JIT_ArenaChunk **) ret)[-1];
+    }
+
+  // Nou tros al final del bloc actual.
+  else
+    {
+      need= sizeof(IA32_JIT_ArenaChunk *) + *csize;
+      chunk= a->chunks;
+      if ( chunk == NULL || ARENA_CHUNK_BYTES-chunk->used < need )
+        {
+          chunk= (IA32_JIT_ArenaChunk *) malloc__ ( ARENA_CHUNK_BYTES );
+          chunk->next= a->chunks;
+          chunk->used= sizeof(IA32_JIT_ArenaChunk);
+          chunk->live= 0;
+          a->chunks= chunk;
+          a->bytes+= ARENA_CHUNK_BYTES;
+        }
+      hdr= (IA32_JIT_ArenaChunk **) (((uint8_t *) chunk) + chunk->used);
+      chunk->used+= need;
+      *hdr= chunk;
+      ret= (void *) (hdr+1);
+    }
+  chunk->live+= *csize;
+  
+  return ret;
+  
+} // end arena_alloc
+
+
+// Allibera un tros reservat amb arena_alloc amb la mateixa 'size'.
+static void
+arena_free (
+            IA32_JIT_Arena *a,
+            void           *ptr,
+            const size_t    size
+            )
+{
+
+  IA32_JIT_ArenaChunk *chunk;
+  size_t csize;
+  int c;
+  
+
+  chunk= ((IA32_JIT_ArenaChunk **) ptr)[-1];
+  c= arena_class ( size, &csize );
+  if ( c == -1 )
+    {
+      assert ( chunk == NULL );
+      free ( ((IA32_JIT_ArenaChunk **) ptr)-1 );
+      return;
+    }
+  chunk->live-= csize;
+  *((void **) ptr)= a->free[c];
+  a->free[c]= ptr;
+  
+} // end arena_free
+
+
+// Torna al sistema els blocs que no tenen cap tros en ús.
+static void
+arena_trim (
+            IA32_JIT_Arena *a
+            )
+{
+
+  IA32_JIT_ArenaChunk *chunk,**pchunk;
+  void **p;
+  int c;
+  
+
+  // Lleva de les llistes els trossos dels blocs buits.
+  for ( c= 0; c < IA32_JIT_ARENA_CLASSES; ++c )
+    {
+      p= &(a->free[c]);
+      while ( *p != NULL )
+        {
+          if ( ((IA32_JIT_ArenaChunk **) *p)[-1]->live == 0 )
+            *p= *((void **) *p);
+          else p= (void **) *p;
+        }
+    }
+
+  // Allibera els blocs.
+  pchunk= &(a->chunks);
+  while ( (chunk= *pchunk) != NULL )
+    {
+      if ( chunk->live == 0 )
+        {
+          *pchunk= chunk->next;
+          a->bytes-= ARENA_CHUNK_BYTES;
+          free ( chunk );
+        }
+      else pchunk= &(chunk->next);
+    }
+  
+} // end arena_trim
+
+
 /* GESTIÓ PÀGINES *************************************************************/
+// Àrea que conté l'adreça física 'addr', -1 si cap.
+static int
+find_area (
+           const IA32_JIT *jit,
+           const uint32_t  addr
+           )
+{
+
+  int area;
+  
+
+  area= jit->_area_lut[addr>>AREA_LUT_SHIFT];
+  if ( area == -1 ) return -1;
+  while ( area < jit->_mem_map_size && addr > jit->_mem_map[area].last_addr )
+    ++area;
+  if ( area == jit->_mem_map_size || addr < jit->_mem_map[area].first_addr )
+    return -1;
+  
+  return area;
+  
+} // end find_area
+
+
+static IA32_JIT_Page *
+map_get (
+         const IA32_JIT_MemMap *mem_map,
+         const uint32_t         page
+         )
+{
+
+  IA32_JIT_Page **leaf;
+  
+
+  leaf= mem_map->map[page>>MAP_LEAF_BITS];
+  
+  return leaf == NULL ? NULL : leaf[page&MAP_LEAF_MASK];
+  
+} // end map_get
+
+
+// Fixa la pàgina 'page', reserva la fulla si cal.
+static void
+map_set (
+         IA32_JIT_MemMap *mem_map,
+         const uint32_t   page,
+         IA32_JIT_Page   *p
+         )
+{
+
+  IA32_JIT_Page ***leaf;
+  int n;
+  
+
+  leaf= &(mem_map->map[page>>MAP_LEAF_BITS]);
+  if ( *leaf == NULL )
+    {
+      if ( p == NULL ) return;
+      *leaf= (IA32_JIT_Page **)
+        malloc__ ( sizeof(IA32_JIT_Page *)<<MAP_LEAF_BITS );
+      for ( n= 0; n <= MAP_LEAF_MASK; ++n )
+        (*leaf)[n]= NULL;
+    }
+  (*leaf)[page&MAP_LEAF_MASK]= p;
+  
+} // end map_set
+
+
+// Marca com a marcs amb codi els que toquen [begin,last]. No es crida
+// per a les àrees ROM, les seues pàgines no es vigilen.
+static void
+mark_code_frames (
+                  IA32_JIT       *jit,
+                  const uint32_t  begin,
+                  const uint32_t  last
+                  )
+{
+
+  uint32_t f,f_e;
+  
+
+  f_e= last>>CODE_FRAME_BITS;
+  for ( f= begin>>CODE_FRAME_BITS; f <= f_e; ++f )
+    jit->_code_bitmap[f>>5]|= 1<<(f&0x1F);
+  
+} // end mark_code_frames
+
+
+// Torna cert si alguna pàgina (incloent el solapament amb la
+// següent) toca el marc que comença en 'frame'.
+static bool
+frame_has_code (
+                IA32_JIT       *jit,
+                const uint32_t  frame
+                )
+{
+
+  uint32_t f_last,b,e,page,page_b,page_e,p_b,p_e;
+  const IA32_JIT_MemMap *mem_map;
+  const IA32_JIT_Page *p;
+  int area;
+  
+
+  f_last= frame|((1<<CODE_FRAME_BITS)-1);
+  for ( area= 0; area < jit->_mem_map_size; ++area )
+    {
+      mem_map= &(jit->_mem_map[area]);
+      if ( mem_map->rom ||
+           mem_map->last_addr < frame || mem_map->first_addr > f_last )
+        continue;
+      b= frame < mem_map->first_addr ? mem_map->first_addr : frame;
+      e= f_last > mem_map->last_addr ? mem_map->last_addr : f_last;
+      page_b= (b-mem_map->first_addr)>>mem_map->bits_page;
+      page_e= (e-mem_map->first_addr)>>mem_map->bits_page;
+      if ( page_b > 0 ) --page_b; // Pot solapar
+      for ( page= page_b; page <= page_e; ++page )
+        if ( mem_map->map[page>>MAP_LEAF_BITS] == NULL )
+          page|= MAP_LEAF_MASK; // Fulla buida
+        else if ( (p= map_get ( mem_map, page )) != NULL )
+          {
+            p_b= mem_map->first_addr + (page<<mem_map->bits_page);
+            p_e= p_b + mem_map->page_low_mask + (uint32_t) p->overlap_next_page;
+            if ( p_b <= f_last && p_e >= frame ) return true;
+          }
+    }
+  
+  return false;
+  
+} // end frame_has_code
+
+
+// Nom del registre amb desplaçament 'off' (veure REG32_OFF).
+static const char *
+print_reg_name (
+                const uint16_t off,
+                const bool     is32
+                )
+{
+
+  static const char *names32[8]=
+    {"EAX","ECX","EDX","EBX","ESP","EBP","ESI","EDI"};
+  static const char *names16[8]=
+    {"AX","CX","DX","BX","SP","BP","SI","DI"};
+  int i;
+  
+  
+  for ( i= 0; i < 8; ++i )
+    if ( (is32 ? REG32_OFF[i] : REG16_OFF[i]) == off )
+      return is32 ? names32[i] : names16[i];
+  
+  return "??";
+  
+} // end print_reg_name
+
+
 static void
 print_page (
             FILE                *f,
@@ -3026,29 +3756,40 @@ print_page (
             )
 {
 
+  static const char *conds[BC_BRANCH_CONDS]=
+    {"(CF==0 && ZF==0)","(CF==0)","(CF==1)","(CX==0)","(ZF!=0)",
+     "(ECX==0)","(ZF==0 && SF==OF)","(SF==OF)","(SF!=OF)",
+     "(CF==1 || ZF==1)","(ZF==0)","(ZF==1 || SF!=OF)","(OF==0)",
+     "(SF==0)","(OF==1)","(PF==1)","(PF==0)","(SF==1)"};
   uint32_t e,ind,n;
   bool print_dots;
+  int is32;
+  uint16_t bc;
 
 
   if ( p->overlap_next_page > 0 )
     fprintf ( f, "OVERLAP: %d\n", p->overlap_next_page );
   
-  // Mapa
-  fprintf ( f, "MAP:\n" );
-  print_dots= true;
-  for ( e= p->first_entry; e <= p->last_entry; ++e )
+  // Mapes
+  for ( is32= 0; is32 < 2; ++is32 )
     {
-      ind= p->entries[e].ind;
-      if ( ind == NULL_ENTRY )
-        {
-          if ( print_dots ) { fprintf ( f, "   ...\n"); print_dots= false; }
-        }
-      else
+      if ( p->entries[is32] == NULL ) continue;
+      fprintf ( f, "MAP (%s):\n", is32 ? "32bit" : "16bit" );
+      print_dots= true;
+      for ( e= p->first_entry; e <= p->last_entry; ++e )
         {
-          print_dots= true;
-          if ( ind != PAD_ENTRY )
-            fprintf ( f, "  %08X  %u    (%s)\n",
-                      e, ind-2, p->entries[e].is32 ? "32bit" : "16bit" );
+          ind= p->entries[is32][e];
+          if ( ind == NULL_ENTRY )
+            {
+              if ( print_dots )
+                { fprintf ( f, "   ...\n"); print_dots= false; }
+            }
+          else
+            {
+              print_dots= true;
+              if ( ind != PAD_ENTRY )
+                fprintf ( f, "  %08X  %u\n", e, ind-2 );
+            }
         }
     }
 
@@ -3057,9 +3798,30 @@ print_page (
   for ( n= 2; n < p->N; ++n )
     {
       fprintf ( f, "  %010d: ", n-2 );
-      switch ( p->v[n] )
+      bc= p->v[n];
+      // Els salts fusionats imprimeixen la condició i després el salt.
+      if ( bc >= BC_BRANCH32_A && bc <= BC_BRANCH16_S )
+        {
+          fprintf ( f, "cond= %s; ",
+                    conds[(bc-BC_BRANCH32_A)%BC_BRANCH_CONDS] );
+          bc= BC_BRANCH32 + (bc-BC_BRANCH32_A)/BC_BRANCH_CONDS;
+        }
+      switch ( bc )
         {
-        case BC_GOTO_EIP: fprintf ( f, "goto EIP // Stop!\n" ); break;
+        case BC_GOTO_EIP:
+          fprintf ( f, "goto EIP (link %d) // Stop!\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_LAZY_FLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- lazy\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_NATIVE:
+          fprintf ( f, "native(%u) [%d insts] else continue\n",
+                    ((uint32_t) p->v[n+1]) | (((uint32_t) p->v[n+2])<<16),
+                    p->v[n+3] );
+          n+= 4;
+          break;
         case BC_INC1_EIP: fprintf ( f, "++EIP // Stop!\n" ); break;
         case BC_INC2_EIP: fprintf ( f, "EIP+= 2 // Stop!\n" ); break;
         case BC_INC3_EIP: fprintf ( f, "EIP+= 3 // Stop!\n" ); break;
@@ -3086,6 +3848,80 @@ print_page (
         case BC_INC11_EIP_NOSTOP: fprintf ( f, "EIP+= 11\n" ); break;
         case BC_INC12_EIP_NOSTOP: fprintf ( f, "EIP+= 12\n" ); break;
         case BC_INC14_EIP_NOSTOP: fprintf ( f, "EIP+= 14\n" ); break;
+        case BC_INC1_EIP_GOTO:
+          fprintf ( f, "EIP+= 1; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC2_EIP_GOTO:
+          fprintf ( f, "EIP+= 2; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC3_EIP_GOTO:
+          fprintf ( f, "EIP+= 3; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC4_EIP_GOTO:
+          fprintf ( f, "EIP+= 4; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC5_EIP_GOTO:
+          fprintf ( f, "EIP+= 5; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC6_EIP_GOTO:
+          fprintf ( f, "EIP+= 6; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC7_EIP_GOTO:
+          fprintf ( f, "EIP+= 7; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC8_EIP_GOTO:
+          fprintf ( f, "EIP+= 8; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC9_EIP_GOTO:
+          fprintf ( f, "EIP+= 9; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC10_EIP_GOTO:
+          fprintf ( f, "EIP+= 10; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC11_EIP_GOTO:
+          fprintf ( f, "EIP+= 11; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC12_EIP_GOTO:
+          fprintf ( f, "EIP+= 12; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC14_EIP_GOTO:
+          fprintf ( f, "EIP+= 14; goto EIP (link %d) // Stop!\n", p->v[n+2] );
+          break;
+        case BC_INC_EIP_DEFER:
+          fprintf ( f, "pending_EIP+= %d\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_SB_JMP32:
+        case BC_SB_JMP16:
+          fprintf ( f, "jmp_near(EIP+%d+%d)%s; continue\n",
+                    p->v[n+3],
+                    (int32_t) (((uint32_t) p->v[n+1]) |
+                               (((uint32_t) p->v[n+2])<<16)),
+                    p->v[n]==BC_SB_JMP16 ? "&0xFFFF" : "" );
+          n+= 3;
+          break;
+        case BC_SB_BRANCH32:
+        case BC_SB_BRANCH16:
+          fprintf ( f, "if(cond) { jmp_near(EIP+%d+%d)%s } else"
+                    " { EIP+= %d }; if(cond%s) continue; else goto EIP"
+                    " (link %d) // Stop!\n",
+                    p->v[n+3],
+                    (int32_t) (((uint32_t) p->v[n+1]) |
+                               (((uint32_t) p->v[n+2])<<16)),
+                    p->v[n]==BC_SB_BRANCH16 ? "&0xFFFF" : "",
+                    p->v[n+3], p->v[n+5] ? "" : "==false", p->v[n+4] );
+          n+= 5;
+          break;
+        case BC_SB_GOTO:
+          fprintf ( f, "goto %u\n",
+                    ((uint32_t) p->v[n+1]) | (((uint32_t) p->v[n+2])<<16) );
+          n+= 2;
+          break;
+        case BC_SB_GUARD:
+          fprintf ( f, "if(translate(EIP)!=%08Xh) goto EIP // Stop!\n",
+                    ((uint32_t) p->v[n+1]) | (((uint32_t) p->v[n+2])<<16) );
+          n+= 2;
+          break;
           /*
         case BC_INC_IMM_EIP_AND_GOTO_EIP:
           fprintf ( f, "EIP+= %d; goto EIP // Stop!\n", p->v[n+1] );
@@ -3402,6 +4238,18 @@ print_page (
         case BC_SET32_PF_EFLAGS:
           fprintf ( f, "PF <-- check_parity(res32&FFh)\n" );
           break;
+        case BC_SET32_AD_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_add(res32)\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_SET32_SB_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_sub(res32)\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_SET32_LOP_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_logic(res32)\n", p->v[n+1] );
+          ++n;
+          break;
         case BC_SET16_AD_OF_EFLAGS:
           fprintf ( f, "OF <-- check_overflow_add(res16)\n" );
           break;
@@ -3507,6 +4355,18 @@ print_page (
         case BC_SET16_ZF_EFLAGS:
           fprintf ( f, "ZF <-- res16==0\n");
           break;
+        case BC_SET16_AD_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_add(res16)\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_SET16_SB_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_sub(res16)\n", p->v[n+1] );
+          ++n;
+          break;
+        case BC_SET16_LOP_EFLAGS:
+          fprintf ( f, "EFLAGS[%04Xh] <-- check_logic(res16)\n", p->v[n+1] );
+          ++n;
+          break;
         case BC_SET16_PF_EFLAGS:
           fprintf ( f, "PF <-- check_parity(res16&FFh)\n" );
           break;
@@ -4201,21 +5061,23 @@ print_page (
           fprintf ( f, "jmp_far(selector,offset,op32=false) // Stop!\n" );
           break;
         case BC_JMP32_NEAR_REL:
-          fprintf ( f, "jmp_near(EIP+%d+%d); goto EIP // Stop!\n",
-                    p->v[n+2], (int16_t) p->v[n+1] );
-          n+= 2;
+          fprintf ( f, "jmp_near(EIP+%d+%d); goto EIP (link %d) // Stop!\n",
+                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+3] );
+          n+= 3;
           break;
         case BC_JMP16_NEAR_REL:
-          fprintf ( f, "jmp_near((EIP+%d+%d)&FFFFh); goto EIP // Stop!\n",
-                    p->v[n+2], (int16_t) p->v[n+1] );
-          n+= 2;
+          fprintf ( f, "jmp_near((EIP+%d+%d)&FFFFh); goto EIP (link %d)"
+                    " // Stop!\n",
+                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+3] );
+          n+= 3;
           break;
         case BC_JMP32_NEAR_REL32:
-          fprintf ( f, "jmp_near(EIP+%d+%d); goto EIP // Stop!\n",
+          fprintf ( f, "jmp_near(EIP+%d+%d); goto EIP (link %d) // Stop!\n",
                     p->v[n+3],
                     (int32_t) ((uint32_t) p->v[n+1]) |
-                    (((uint32_t) (p->v[n+2]))<<16) );
-          n+= 3;
+                    (((uint32_t) (p->v[n+2]))<<16),
+                    p->v[n+4] );
+          n+= 4;
           break;
         case BC_JMP32_NEAR_RES32:
           fprintf ( f, "jmp_near(res32); goto EIP // Stop!\n" );
@@ -4225,24 +5087,26 @@ print_page (
           break;
         case BC_BRANCH32:
           fprintf ( f, "if(cond) { jmp_near(EIP+%d+%d) } else"
-                    " { EIP+= %d }; goto EIP // Stop!\n",
-                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+2] );
-          n+= 2;
+                    " { EIP+= %d }; goto EIP (links %d,%d) // Stop!\n",
+                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+2],
+                    p->v[n+3], p->v[n+4] );
+          n+= 4;
           break;
         case BC_BRANCH32_IMM32:
           fprintf ( f, "if(cond) { jmp_near(EIP+%d+%d) } else"
-                    " { EIP+= %d }; goto EIP // Stop!\n",
+                    " { EIP+= %d }; goto EIP (links %d,%d) // Stop!\n",
                     p->v[n+3],
                     (int32_t) (((uint32_t) p->v[n+1]) |
                                (((uint32_t) p->v[n+2])<<16)),
-                    p->v[n+3] );
-          n+= 3;
+                    p->v[n+3], p->v[n+4], p->v[n+5] );
+          n+= 5;
           break;
         case BC_BRANCH16:
           fprintf ( f, "if(cond) { jmp_near((EIP+%d+%d)&FFFFh) } else"
-                    " { EIP+= %d }; goto EIP // Stop!\n",
-                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+2] );
-          n+= 2;
+                    " { EIP+= %d }; goto EIP (links %d,%d) // Stop!\n",
+                    p->v[n+2], (int16_t) p->v[n+1], p->v[n+2],
+                    p->v[n+3], p->v[n+4] );
+          n+= 4;
           break;
         case BC_CALL32_FAR:
           fprintf ( f, "call_far(selector,offset,op32=true) // Stop!\n" );
@@ -4507,6 +5371,297 @@ print_page (
         case BC_XOR32: fprintf ( f, "res32= op32[0] ^ op32[1]\n" ); break;
         case BC_XOR16: fprintf ( f, "res16= op16[0] ^ op16[1]\n" ); break;
         case BC_XOR8: fprintf ( f, "res8= op8[0] ^ op8[1]\n" ); break;
+        case BC_MOV32_REG_REG:
+          fprintf ( f, "res32= %s; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ) );
+          ++n;
+          break;
+        case BC_MOV16_REG_REG:
+          fprintf ( f, "res16= %s; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ) );
+          ++n;
+          break;
+        case BC_SET32_IMM32_REG:
+          fprintf ( f, "res32= %04X%04Xh; %s= res32\n",
+                    p->v[n+3], p->v[n+2], print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_SET16_IMM_REG:
+          fprintf ( f, "res16= %04Xh; %s= res16\n",
+                    p->v[n+2], print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_DS_READ32_REG:
+          fprintf ( f, "res32= READ32(DS:offset); %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ) );
+          ++n;
+          break;
+        case BC_DS_READ16_REG:
+          fprintf ( f, "res16= READ16(DS:offset); %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ) );
+          ++n;
+          break;
+        case BC_SS_READ32_REG:
+          fprintf ( f, "res32= READ32(SS:offset); %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ) );
+          ++n;
+          break;
+        case BC_SS_READ16_REG:
+          fprintf ( f, "res16= READ16(SS:offset); %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ) );
+          ++n;
+          break;
+        case BC_DS_READ32_SIB_RES:
+        case BC_DS_READ32_SIB_OP0:
+        case BC_DS_READ32_SIB_OP1:
+        case BC_SS_READ32_SIB_RES:
+        case BC_SS_READ32_SIB_OP0:
+        case BC_SS_READ32_SIB_OP1:
+        case BC_DS_READ32_SIB_REG:
+        case BC_SS_READ32_SIB_REG:
+          fprintf ( f, "offset= " );
+          if ( (p->v[n+1]&0xFF) != SIB_NOREG )
+            fprintf ( f, "%s+", print_reg_name ( p->v[n+1]&0xFF, true ) );
+          if ( (p->v[n+1]>>8) != SIB_NOREG )
+            fprintf ( f, "%s*%d+", print_reg_name ( p->v[n+1]>>8, true ),
+                      1<<p->v[n+2] );
+          fprintf ( f, "%04X%04Xh; ", p->v[n+4], p->v[n+3] );
+          if ( bc == BC_DS_READ32_SIB_REG || bc == BC_SS_READ32_SIB_REG )
+            {
+              fprintf ( f, "res32= READ32(%s:offset); %s= res32\n",
+                        bc == BC_DS_READ32_SIB_REG ? "DS" : "SS",
+                        print_reg_name ( p->v[n+5], true ) );
+              n+= 5;
+            }
+          else
+            {
+              fprintf ( f, "%s= READ32(%s:offset)\n",
+                        (bc == BC_DS_READ32_SIB_RES ||
+                         bc == BC_SS_READ32_SIB_RES) ? "res32" :
+                        ((bc == BC_DS_READ32_SIB_OP0 ||
+                          bc == BC_SS_READ32_SIB_OP0) ? "op32[0]" : "op32[1]"),
+                        bc <= BC_DS_READ32_SIB_OP1 ? "DS" : "SS" );
+              n+= 4;
+            }
+          break;
+        case BC_ADD32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] + op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2],
+                    print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_SUB32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] - op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2],
+                    print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_AND32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] & op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2],
+                    print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_OR32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] | op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2],
+                    print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_XOR32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] ^ op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2],
+                    print_reg_name ( p->v[n+1], true ) );
+          n+= 3;
+          break;
+        case BC_CMP32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] - op32[1];\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2] );
+          n+= 3;
+          break;
+        case BC_TEST32_REG_IMM:
+          fprintf ( f, "op32[0]= %s; op32[1]= %04X%04Xh;"
+                    " res32= op32[0] & op32[1];\n",
+                    print_reg_name ( p->v[n+1], true ),
+                    p->v[n+3], p->v[n+2] );
+          n+= 3;
+          break;
+        case BC_ADD32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] + op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ),
+                    print_reg_name ( p->v[n+1]&0xFF, true ) );
+          ++n;
+          break;
+        case BC_SUB32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] - op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ),
+                    print_reg_name ( p->v[n+1]&0xFF, true ) );
+          ++n;
+          break;
+        case BC_AND32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] & op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ),
+                    print_reg_name ( p->v[n+1]&0xFF, true ) );
+          ++n;
+          break;
+        case BC_OR32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] | op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ),
+                    print_reg_name ( p->v[n+1]&0xFF, true ) );
+          ++n;
+          break;
+        case BC_XOR32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] ^ op32[1]; %s= res32\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ),
+                    print_reg_name ( p->v[n+1]&0xFF, true ) );
+          ++n;
+          break;
+        case BC_CMP32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] - op32[1];\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ) );
+          ++n;
+          break;
+        case BC_TEST32_REG_REG:
+          fprintf ( f, "op32[0]= %s; op32[1]= %s;"
+                    " res32= op32[0] & op32[1];\n",
+                    print_reg_name ( p->v[n+1]&0xFF, true ),
+                    print_reg_name ( p->v[n+1]>>8, true ) );
+          ++n;
+          break;
+        case BC_ADD16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] + op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2],
+                    print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_SUB16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] - op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2],
+                    print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_AND16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] & op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2],
+                    print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_OR16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] | op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2],
+                    print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_XOR16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] ^ op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2],
+                    print_reg_name ( p->v[n+1], false ) );
+          n+= 2;
+          break;
+        case BC_CMP16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] - op16[1];\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2] );
+          n+= 2;
+          break;
+        case BC_TEST16_REG_IMM:
+          fprintf ( f, "op16[0]= %s; op16[1]= %04Xh;"
+                    " res16= op16[0] & op16[1];\n",
+                    print_reg_name ( p->v[n+1], false ),
+                    p->v[n+2] );
+          n+= 2;
+          break;
+        case BC_ADD16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] + op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ),
+                    print_reg_name ( p->v[n+1]&0xFF, false ) );
+          ++n;
+          break;
+        case BC_SUB16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] - op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ),
+                    print_reg_name ( p->v[n+1]&0xFF, false ) );
+          ++n;
+          break;
+        case BC_AND16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] & op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ),
+                    print_reg_name ( p->v[n+1]&0xFF, false ) );
+          ++n;
+          break;
+        case BC_OR16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] | op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ),
+                    print_reg_name ( p->v[n+1]&0xFF, false ) );
+          ++n;
+          break;
+        case BC_XOR16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] ^ op16[1]; %s= res16\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ),
+                    print_reg_name ( p->v[n+1]&0xFF, false ) );
+          ++n;
+          break;
+        case BC_CMP16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] - op16[1];\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ) );
+          ++n;
+          break;
+        case BC_TEST16_REG_REG:
+          fprintf ( f, "op16[0]= %s; op16[1]= %s;"
+                    " res16= op16[0] & op16[1];\n",
+                    print_reg_name ( p->v[n+1]&0xFF, false ),
+                    print_reg_name ( p->v[n+1]>>8, false ) );
+          ++n;
+          break;
         case BC_AAD:
           fprintf ( f, "AL= (AL+AH*%d)&0xFF; AH= 0\n", p->v[n+1] );
           ++n;
@@ -5146,20 +6301,23 @@ print_pages (
 
   int i;
   const IA32_JIT_MemMap *mem_map;
+  const IA32_JIT_Page *p;
   uint32_t page,page_e;
   
   
   for ( i= 0; i < jit->_mem_map_size; ++i )
     {
       mem_map= &(jit->_mem_map[i]);
-      page_e= (mem_map->last_addr-mem_map->first_addr)>>jit->_bits_page;
+      page_e= (mem_map->last_addr-mem_map->first_addr)>>mem_map->bits_page;
       for ( page= 0; page <= page_e; ++page )
-        if ( mem_map->map[page] != NULL )
+        if ( mem_map->map[page>>MAP_LEAF_BITS] == NULL )
+          page|= MAP_LEAF_MASK; // Fulla buida
+        else if ( (p= map_get ( mem_map, page )) != NULL )
           {
             fprintf ( f, "Pàgina %08Xh\n",
-                      (page<<jit->_bits_page)+mem_map->first_addr );
+                      (page<<mem_map->bits_page)+mem_map->first_addr );
             fprintf ( f, "----------------\n");
-            print_page ( f, mem_map->map[page] );
+            print_page ( f, p );
             fprintf ( f, "\n" );
             fflush ( f );
           }
@@ -5168,9 +6326,9 @@ print_pages (
 } // end print_pages
 
 
-#if 0
-// NOTA!!! Açò de moment no es gasta, però em permetria ficar un
-// número màxim de pàgines actives.
+// Fica 'page' en el cap de _pages. Les pàgines es mouen cada vegada
+// que s'executen, d'eixa manera la cua sempre té la que fa més temps
+// que no s'executa (veure shrink_pages).
 static void
 move_page_to_head (
                    IA32_JIT      *jit,
@@ -5199,12 +6357,112 @@ move_page_to_head (
     }
   
 } // end move_page_to_head
+
+
+// Memòria que ocupa la pàgina 'p'.
+static size_t
+page_bytes (
+            const IA32_JIT      *jit,
+            const IA32_JIT_Page *p
+            )
+{
+
+  size_t ret;
+  int n;
+  
+
+  ret= sizeof(IA32_JIT_Page) +
+    sizeof(uint16_t)*p->capacity +
+    sizeof(IA32_JIT_PageLink)*p->links_capacity +
+    sizeof(IA32_JIT_PageBlock)*p->blocks_capacity +
+    sizeof(IA32_JIT_PageReopt)*(p->reopts_capacity+p->flags_deps_capacity);
+  for ( n= 0; n < 2; ++n )
+    if ( p->entries[n] != NULL )
+      ret+= ENTRY_BYTES*(PAGE_LOW_MASK(p)+1);
+#ifdef IA32_JIT_NATIVE
+  ret+= p->native_capacity;
+#endif
+
+  return ret;
+  
+} // end page_bytes
+
+
+// Actualitza _bytes després de compilar en 'p'.
+static void
+update_page_bytes (
+                   IA32_JIT      *jit,
+                   IA32_JIT_Page *p
+                   )
+{
+
+  size_t tmp;
+
+  
+  tmp= page_bytes ( jit, p );
+  jit->_bytes+= tmp - p->bytes;
+  p->bytes= tmp;
+  
+} // end update_page_bytes
+
+
+// Reserva el mapa d'entrades del mode 'is32' de 'p' si no existeix.
+static void
+alloc_entries (
+               IA32_JIT      *jit,
+               IA32_JIT_Page *p,
+               const bool     is32
+               )
+{
+
+  uint32_t n;
+  size_t size;
+  
+
+  if ( p->entries[is32] != NULL ) return;
+  n= PAGE_LOW_MASK(p)+1;
+  p->entries[is32]=
+    (uint16_t *) arena_alloc ( &(jit->_arena), ENTRY_BYTES*n, &size );
+  p->entries_info[is32]= (uint8_t *) (p->entries[is32] + n);
+  memset ( p->entries[is32], 0, sizeof(uint16_t)*n ); // NULL_ENTRY
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  p->entries_count[is32]= p->entries_info[is32] + n;
+  memset ( p->entries_count[is32], 0, n );
+#endif
+  update_page_bytes ( jit, p );
+  
+} // end alloc_entries
+
+
+// Torna els mapes d'entrades de 'p' a l'arena.
+static void
+free_entries (
+              IA32_JIT      *jit,
+              IA32_JIT_Page *p
+              )
+{
+
+  int n;
+  
+
+  for ( n= 0; n < 2; ++n )
+    if ( p->entries[n] != NULL )
+      {
+        arena_free ( &(jit->_arena), p->entries[n],
+                     ENTRY_BYTES*(PAGE_LOW_MASK(p)+1) );
+        p->entries[n]= NULL;
+        p->entries_info[n]= NULL;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+        p->entries_count[n]= NULL;
 #endif
+      }
+  
+} // end free_entries
+
 
-// NOTA!! Si vullguera ficar un màxim ací podria fer que si s'ha
-// aplegat al màxim en compte de crear una nova es reciclara la més
-// vella.
-// Torna una pàgina buida i la fica en el cap de la llista pages
+// Torna una pàgina buida i la fica en el cap de la llista pages. Si
+// n'hi ha de lliures en recicla una, el límit de memòria es comprova
+// en exec_inst (veure shrink_pages).
 static IA32_JIT_Page *
 get_new_page (
               IA32_JIT *jit
@@ -5213,6 +6471,7 @@ get_new_page (
 
   IA32_JIT_Page *ret;
   uint32_t n;
+  size_t size;
   
   
   // La agafa de _free_pages
@@ -5223,13 +6482,28 @@ get_new_page (
       ret= jit->_free_pages;
       jit->_free_pages= ret->next;
       
-      // Neteja valors antics
-      for ( n= ret->first_entry; n <= ret->last_entry; ++n )
-        ret->entries[n].ind= NULL_ENTRY;
+      // Neteja valors antics (els mapes ja s'han alliberat)
       ret->first_entry= (uint32_t) -1;
       ret->last_entry= 0;
       ret->overlap_next_page= 0;
+      ret->v= (uint16_t *) arena_alloc ( &(jit->_arena),
+                                         ARENA_MIN_BYTES, &size );
+      ret->capacity= (uint32_t) (size/sizeof(uint16_t));
       ret->N= 2; // les 2 primeres estan reservades
+      ret->links_N= 0;
+      ret->blocks_N= 0;
+      ret->reopts_N= 0;
+      ret->flags_deps_N= 0;
+      ret->flags_dep_prev= false;
+      ret->flags_dep_next= false;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      ret->sb_dep_next= false;
+      ret->sb_covered= false;
+#endif
+#ifdef IA32_JIT_NATIVE
+      ret->native_N= 0;
+#endif
+      update_page_bytes ( jit, ret );
       
     }
   
@@ -5237,19 +6511,52 @@ get_new_page (
   else
     {
       ret= (IA32_JIT_Page *) malloc__ ( sizeof(IA32_JIT_Page) );
-      ret->entries=
-        (IA32_JIT_PageEntry *) malloc__ ( sizeof(IA32_JIT_PageEntry)*
-                                          (jit->_page_low_mask+1) );
-      for ( n= 0; n <= jit->_page_low_mask; ++n )
-        ret->entries[n].ind= NULL_ENTRY;
+      ret->arena= &(jit->_arena);
+      for ( n= 0; n < 2; ++n )
+        {
+          ret->entries[n]= NULL;
+          ret->entries_info[n]= NULL;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+          ret->entries_count[n]= NULL;
+#endif
+        }
       ret->first_entry= (uint32_t) -1;
       ret->last_entry= 0;
       ret->overlap_next_page= 0;
-      ret->v= (uint16_t *) malloc__ ( sizeof(uint16_t)*2 );
-      ret->capacity= 2;
+      ret->v= (uint16_t *) arena_alloc ( &(jit->_arena),
+                                         ARENA_MIN_BYTES, &size );
+      ret->capacity= (uint32_t) (size/sizeof(uint16_t));
       ret->N= 2;
+      ret->links= (IA32_JIT_PageLink *) malloc__ ( sizeof(IA32_JIT_PageLink) );
+      ret->links_capacity= 1;
+      ret->links_N= 0;
+      ret->blocks=
+        (IA32_JIT_PageBlock *) malloc__ ( sizeof(IA32_JIT_PageBlock) );
+      ret->blocks_capacity= 1;
+      ret->blocks_N= 0;
+      ret->reopts=
+        (IA32_JIT_PageReopt *) malloc__ ( sizeof(IA32_JIT_PageReopt) );
+      ret->reopts_capacity= 1;
+      ret->reopts_N= 0;
+      ret->flags_deps=
+        (IA32_JIT_PageReopt *) malloc__ ( sizeof(IA32_JIT_PageReopt) );
+      ret->flags_deps_capacity= 1;
+      ret->flags_deps_N= 0;
+      ret->flags_dep_prev= false;
+      ret->flags_dep_next= false;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      ret->sb_dep_next= false;
+      ret->sb_covered= false;
+#endif
+#ifdef IA32_JIT_NATIVE
+      ret->native= NULL;
+      ret->native_capacity= 0;
+      ret->native_N= 0;
+#endif
       ret->area_id= -1;
       ret->page_id= (uint32_t) -1;
+      ret->bytes= 0;
+      update_page_bytes ( jit, ret );
     }
 
   // Inserta en en el cap de _pages
@@ -5271,6 +6578,28 @@ get_new_page (
 } // end get_new_page
 
 
+// Fica una pàgina que no està en cap llista en _free_pages. El
+// bytecode i els mapes d'entrades tornen a l'arena i es reserven de
+// nou quan es recicla.
+static void
+add_free_page (
+               IA32_JIT      *jit,
+               IA32_JIT_Page *p
+               )
+{
+
+  free_entries ( jit, p );
+  arena_free ( &(jit->_arena), p->v, sizeof(uint16_t)*p->capacity );
+  p->v= NULL;
+  p->capacity= 0;
+  update_page_bytes ( jit, p );
+  p->prev= NULL;
+  p->next= jit->_free_pages;
+  jit->_free_pages= p;
+  
+} // end add_free_page
+
+
 static void
 remove_page (
              IA32_JIT       *jit,
@@ -5279,14 +6608,17 @@ remove_page (
              )
 {
 
-  IA32_JIT_Page *p;
+  IA32_JIT_Page *p,*q;
+  IA32_JIT_MemMap *mem_map;
 
   
   //printf("REMOVE_PAGE area:%d page:%X!!!!\n",area,page);
   // Lleva
-  p= jit->_mem_map[area].map[page];
+  mem_map= &(jit->_mem_map[area]);
+  p= map_get ( mem_map, page );
   assert ( p != NULL );
-  jit->_mem_map[area].map[page]= NULL;
+  map_set ( mem_map, page, NULL );
+  invalidate_links ( jit );
 
   // lleva de current si és el cas.
   if ( jit->_current_page == p )
@@ -5302,57 +6634,884 @@ remove_page (
   else                   jit->_pages= p->next;
   
   // Afegeix a _free_pages
-  if ( jit->_lock_page != p )
-    {
-      p->next= jit->_free_pages;
-      jit->_free_pages= p;
-      p->prev= NULL;
-    }
+  if ( jit->_lock_page != p ) add_free_page ( jit, p );
   else jit->_free_lock_page= true;
+
+  // Les pàgines veïnes que han optimitzat els flags amb les entrades
+  // d'esta (o amb superblocs que continuen en esta) també deixen de
+  // ser vàlides.
+  if ( page > 0 &&
+       (q= map_get ( mem_map, page-1 )) != NULL &&
+#ifdef __IA32_JIT_SUPERBLOCKS__
+       (q->flags_dep_next || q->sb_dep_next)
+#else
+       q->flags_dep_next
+#endif
+       )
+    remove_page ( jit, area, page-1 );
+  if ( page < ((mem_map->last_addr-mem_map->first_addr)>>mem_map->bits_page) &&
+       (q= map_get ( mem_map, page+1 )) != NULL &&
+       q->flags_dep_prev )
+    remove_page ( jit, area, page+1 );
   
 } // end remove_page
 
 
-/* COMPILAR *******************************************************************/
+// Índex del primer bloc de 'p' del mode 'is32' que toca alguna
+// entrada de [first,last], -1 si cap. Els blocs d'un mateix mode poden
+// solapar-se (fluxos d'instruccions que comencen a meitat d'altra
+// instrucció).
+static int
+find_block (
+            const IA32_JIT_Page *p,
+            const uint32_t       first,
+            const uint32_t       last,
+            const bool           is32
+            )
+{
 
-#include "jit_compile.h"
+  uint32_t n;
+  
 
+  for ( n= 0; n < p->blocks_N; ++n )
+    if ( first <= p->blocks[n].last && last >= p->blocks[n].first &&
+         p->blocks[n].is32 == (uint32_t) is32 )
+      return (int) n;
+  
+  return -1;
+  
+} // end find_block
 
-// Torna en pos la posició de la primera instrucció descodificada o
-// NULL_ENTRY per a indicar que cal esborrar i recompilar tota la
-// pàgina. Açò no és considera en realitat un error. En cas d'error
-// (cal executar l'excepció) torna false, true si no cal executar cap
-// excepció.
-static bool
-dis_insts (
-           IA32_JIT      *jit,
-           IA32_JIT_Page *p,
-           uint32_t       addr,
-           uint32_t       offset,
-           uint32_t      *pos
-           )
+
+// Índex del bloc de 'p' del mode 'is32' que comença en l'entrada
+// 'first', -1 si cap. En un mode no pot haver dos blocs que comencen
+// en la mateixa entrada.
+static int
+find_block_at (
+               const IA32_JIT_Page *p,
+               const uint32_t       first,
+               const bool           is32
+               )
 {
 
-  uint32_t last_addr,flags,e,tmp_e,beg_offset;
-  size_t n,N,tmp_size,diff;
-  int i,nbytes;
-  bool is32,end;
-  IA32_Mnemonic name;
+  uint32_t n;
+  
+
+  for ( n= 0; n < p->blocks_N; ++n )
+    if ( p->blocks[n].first == first &&
+         p->blocks[n].is32 == (uint32_t) is32 )
+      return (int) n;
   
+  return -1;
   
-  // Última adreça de la pàgina actual. S'assumix que addr és una
-  // adreça vàlida de la pàgina.
-  last_addr= (addr&(~(jit->_page_low_mask))) | (jit->_page_low_mask);
+} // end find_block_at
 
-  // Desenssambla tot el que es puga abans d'aplegar al final,
-  // trovar-se una instrucció de control de fluxe, una excepció o un
-  // solapament. També pare si el offset pega la volta 0xffffffff -> 0
-  beg_offset= offset;
-  is32= ADDR_OP_SIZE_IS_32;
-  N= 0;
-  end= false;
-  assert ( jit->_exception.vec == -1 );
-  tmp_e= addr&(jit->_page_low_mask);
+
+// Descarta el bloc 'b' de 'p'. Les seues entrades tornen a NULL i el
+// bytecode queda mort fins que es recompile tota la pàgina (veure
+// MAX_ENTRY_POS). Si 'deps' també es descarten els blocs de 'p' que
+// han optimitzat els flags amb les entrades d'este. Els blocs que es
+// solapen amb ell es descarten sempre.
+static void
+drop_block (
+            IA32_JIT       *jit,
+            IA32_JIT_Page  *p,
+            const int       b,
+            const bool      deps
+            )
+{
+
+  uint32_t first,last,e,i,is32;
+  IA32_JIT_PageReopt dep;
+  int n;
+  
+
+  first= p->blocks[b].first;
+  last= p->blocks[b].last;
+  is32= p->blocks[b].is32;
+  p->blocks[b]= p->blocks[--(p->blocks_N)];
+  if ( last == PAGE_LOW_MASK(p) &&
+       (p->entries[!is32] == NULL ||
+        p->entries[!is32][last] == NULL_ENTRY) )
+    p->overlap_next_page= 0;
+  for ( e= first; e <= last; ++e )
+    {
+      p->entries[is32][e]= NULL_ENTRY;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      p->entries_count[is32][e]= 0;
+#endif
+    }
+  invalidate_links ( jit );
+  
+  // Reopts del bloc.
+  i= 0;
+  while ( i < p->reopts_N )
+    if ( p->reopts[i].first == first && p->reopts[i].is32 == is32 )
+      p->reopts[i]= p->reopts[--(p->reopts_N)];
+    else ++i;
+
+  // Dependències. Les del bloc es lleven, i els blocs que depenen
+  // d'este es descarten (pot modificar el vector, es torna a
+  // començar).
+  i= 0;
+  while ( i < p->flags_deps_N )
+    {
+      dep= p->flags_deps[i];
+      if ( dep.is32 != is32 ) ++i;
+      else if ( dep.first == first )
+        p->flags_deps[i]= p->flags_deps[--(p->flags_deps_N)];
+      else if ( deps && dep.succ >= first && dep.succ <= last )
+        {
+          p->flags_deps[i]= p->flags_deps[--(p->flags_deps_N)];
+          n= find_block_at ( p, dep.first, is32 );
+          if ( n != -1 && p->blocks[n].last == dep.last )
+            {
+              drop_block ( jit, p, n, true );
+              i= 0;
+            }
+        }
+      else ++i;
+    }
+
+  // Blocs solapats. Les entrades que compartien ja són NULL però el
+  // seu bytecode les travessa, cal descartar-los també.
+  while ( (n= find_block ( p, first, last, (bool) is32 )) != -1 )
+    drop_block ( jit, p, n, true );
+  
+} // end drop_block
+
+
+// Torna cert si es poden descartar blocs de 'p' sense afectar a
+// altres pàgines. En cas contrari cal esborrar tota la pàgina (veure
+// remove_page).
+static bool
+blocks_droppable (
+                  IA32_JIT            *jit,
+                  const IA32_JIT_Page *p
+                  )
+{
+
+  const IA32_JIT_MemMap *mem_map;
+  const IA32_JIT_Page *q;
+  uint32_t page;
+  
+
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  // Les entrades d'una pàgina amb superblocs no es poden esborrar
+  // (veure reopt_blocks).
+  if ( p->sb_covered ) return false;
+#endif
+  mem_map= &(jit->_mem_map[p->area_id]);
+  page= p->page_id;
+  if ( page > 0 &&
+       (q= map_get ( mem_map, page-1 )) != NULL &&
+#ifdef __IA32_JIT_SUPERBLOCKS__
+       (q->flags_dep_next || q->sb_dep_next)
+#else
+       q->flags_dep_next
+#endif
+       )
+    return false;
+  if ( page < ((mem_map->last_addr-mem_map->first_addr)>>mem_map->bits_page) &&
+       (q= map_get ( mem_map, page+1 )) != NULL &&
+       q->flags_dep_prev )
+    return false;
+  
+  return true;
+  
+} // end blocks_droppable
+
+
+// Descarta el bloc de la pàgina 'page' que conté l'entrada 'e' del
+// mapa del mode 'is32'. Si no és possible esborra tota la pàgina.
+static void
+remove_block (
+              IA32_JIT       *jit,
+              const int       area,
+              const uint32_t  page,
+              const uint32_t  e,
+              const bool      is32
+              )
+{
+
+  IA32_JIT_Page *p;
+  int b;
+  
+
+  p= map_get ( &(jit->_mem_map[area]), page );
+  assert ( p != NULL );
+  if ( p->entries[is32] == NULL || p->entries[is32][e] == NULL_ENTRY )
+    return;
+  if ( !blocks_droppable ( jit, p ) ||
+       (b= find_block ( p, e, e, is32 )) == -1 )
+    {
+      remove_page ( jit, area, page );
+      return;
+    }
+  drop_block ( jit, p, b, true );
+  
+  // Si s'està executant la pàgina es para, la instrucció següent pot
+  // estar en el bloc descartat.
+  if ( jit->_current_page == p )
+    {
+      jit->_current_page= NULL;
+      jit->_current_pos= 0; // No pot ser 0
+    }
+  
+} // end remove_block
+
+
+// Elimina les pàgines que contenen 'addr' (veure
+// IA32_jit_addr_changed). Torna cert si s'ha eliminat alguna.
+static bool
+addr_changed (
+              IA32_JIT       *jit,
+              const uint32_t  addr
+              )
+{
+
+  bool ret;
+  int area,is32;
+  uint32_t page,inst;
+  IA32_JIT_Page *p,*q;
+  const IA32_JIT_MemMap *mem_map;
+  
+
+  ret= false;
+  
+  // Les àrees ROM no canvien (veure IA32_JIT_MemArea).
+  area= find_area ( jit, addr );
+  if ( area != -1 && !jit->_mem_map[area].rom )
+    {
+      mem_map= &(jit->_mem_map[area]);
+      page= (addr-mem_map->first_addr)>>mem_map->bits_page;
+      inst= (addr)&(mem_map->page_low_mask);
+      // Descarta l'últim bloc (de cada mode) de la pàgina anterior si
+      // té overlapping en eixa zona. Cada descart pot esborrar
+      // pàgines senceres (flags), per això es torna a consultar el
+      // mapa.
+      if ( page > 0 &&
+           inst < 16 &&
+           (q= map_get ( mem_map, page-1 ))!=NULL &&
+           inst < (uint32_t) (q->overlap_next_page) )
+        {
+          for ( is32= 0; is32 < 2 && map_get ( mem_map, page-1 ) != NULL;
+                ++is32 )
+            remove_block ( jit, area, page-1, mem_map->page_low_mask, is32 );
+          ret= true;
+        }
+      // Descarta els blocs si la zona està desensamblada
+      for ( is32= 0; is32 < 2; ++is32 )
+        if ( (p= map_get ( mem_map, page )) != NULL &&
+             p->entries[is32] != NULL &&
+             p->entries[is32][inst] != NULL_ENTRY )
+          {
+            remove_block ( jit, area, page, inst, is32 );
+            ret= true;
+          }
+    }
+
+  return ret;
+  
+} // end addr_changed
+
+
+// Cridada quan una escriptura de 'nbytes' bytes en 'addr' toca algun
+// marc amb codi. Com les pàgines també es lleven per altres motius
+// (LRU, remapatges...) el bitmap és conservatiu: ací s'esborren els
+// bits dels marcs que ja no tenen codi.
+static void
+code_written (
+              IA32_JIT       *jit,
+              const uint32_t  addr,
+              const int       nbytes
+              )
+{
+
+  uint32_t a,f;
+  int i;
+  
+
+  for ( i= 0, a= addr; i < nbytes; ++i, ++a )
+    if ( IS_CODE_FRAME(a) )
+      addr_changed ( jit, a );
+  for ( i= 0, a= addr; i < nbytes; ++i, ++a )
+    if ( (i == 0 || (a&((1<<CODE_FRAME_BITS)-1)) == 0) &&
+         IS_CODE_FRAME(a) &&
+         !frame_has_code ( jit, a&~((1<<CODE_FRAME_BITS)-1) ) )
+      {
+        f= a>>CODE_FRAME_BITS;
+        jit->_code_bitmap[f>>5]&= ~(1<<(f&0x1F));
+      }
+  
+} // end code_written
+
+
+/* COMPILAR *******************************************************************/
+
+#include "jit_compile.h"
+
+
+/* CODI NATIU *****************************************************************/
+
+#include "jit_native.h"
+
+
+/* LÍMIT DE MEMÒRIA ***********************************************************/
+
+// Allibera una pàgina que no està en cap llista.
+static void
+free_page (
+           IA32_JIT      *jit,
+           IA32_JIT_Page *p
+           )
+{
+
+  jit->_bytes-= p->bytes;
+  free_entries ( jit, p );
+  if ( p->v != NULL )
+    arena_free ( &(jit->_arena), p->v, sizeof(uint16_t)*p->capacity );
+  free ( p->links );
+  free ( p->blocks );
+  free ( p->reopts );
+  free ( p->flags_deps );
+#ifdef IA32_JIT_NATIVE
+  native_free ( p );
+#endif
+  free ( p );
+  
+} // end free_page
+
+
+// Allibera pàgines de _free_pages mentre se supere 'target'.
+static void
+free_free_pages (
+                 IA32_JIT     *jit,
+                 const size_t  target
+                 )
+{
+
+  IA32_JIT_Page *p;
+  
+  
+  while ( jit->_free_pages != NULL && jit->_bytes > target )
+    {
+      p= jit->_free_pages;
+      jit->_free_pages= p->next;
+      free_page ( jit, p );
+    }
+  
+} // end free_free_pages
+
+
+// Es crida quan se supera _max_bytes. Allibera les pàgines lliures i,
+// si no és suficient, esborra les pàgines que fa més temps que no
+// s'executen fins baixar a 3/4 del màxim (per a no tornar a entrar
+// de seguida). No es pot cridar mentre hi ha una pàgina bloquejada.
+// Al final torna al sistema els blocs de l'arena que han quedat buits.
+static void
+shrink_pages (
+              IA32_JIT *jit
+              )
+{
+
+  IA32_JIT_Page *p;
+  size_t target;
+  
+
+  assert ( jit->_lock_page == NULL );
+  target= jit->_max_bytes - jit->_max_bytes/4;
+  free_free_pages ( jit, target );
+  while ( jit->_bytes > target && (p= jit->_pages_tail) != NULL )
+    {
+      remove_page ( jit, p->area_id, p->page_id );
+      free_free_pages ( jit, target );
+    }
+  arena_trim ( &(jit->_arena) );
+  
+} // end shrink_pages
+
+
+// Flags que necessita 'e' o les instruccions posteriors abans
+// d'executar-se si després d'executar-se es necessiten 'out'.
+static uint32_t
+inst_live_flags (
+                 const IA32_JIT_DisEntry *e,
+                 const uint32_t           out
+                 )
+{
+
+  IA32_Mnemonic name;
+  uint32_t ret;
+  
+
+  name= e->inst.name;
+  if ( e->inst.prefix == IA32_PREFIX_NONE )
+    ret= (out&(~(INSTS_METADATA[name].chg_flags))) |
+      INSTS_METADATA[name].req_flags;
+  // Quan hi ha REP és possible no executar res, per tant chn_flags
+  // pot ser 0.
+  else
+    {
+      ret= out | INSTS_METADATA[name].req_flags;
+      if ( e->inst.prefix == IA32_PREFIX_REPE ||
+           e->inst.prefix == IA32_PREFIX_REPNE )
+        ret|= ZF_FLAG;
+    }
+
+  return ret;
+  
+} // end inst_live_flags
+
+
+// Torna cert si el bytecode de 'inst' no llig la EIP més que per a
+// generar excepcions, i per tant pot executar-se amb la EIP sense
+// actualitzar (veure BC_INC_EIP_DEFER).
+static bool
+defer_eip_ok (
+              const IA32_Inst *inst
+              )
+{
+
+  int i;
+  
+  
+  // Registres de control, depuració i segment.
+  for ( i= 0; i < 3; ++i )
+    if ( (inst->ops[i].type >= IA32_DR0 && inst->ops[i].type <= IA32_CR8) ||
+         (inst->ops[i].type >= IA32_SEG_ES &&
+          inst->ops[i].type <= IA32_SEG_GS) )
+      return false;
+  
+  switch ( inst->name )
+    {
+    case IA32_ADC32: case IA32_ADC16: case IA32_ADC8:
+    case IA32_ADD32: case IA32_ADD16: case IA32_ADD8:
+    case IA32_AND32: case IA32_AND16: case IA32_AND8:
+    case IA32_CMP32: case IA32_CMP16: case IA32_CMP8:
+    case IA32_DEC32: case IA32_DEC16: case IA32_DEC8:
+    case IA32_INC32: case IA32_INC16: case IA32_INC8:
+    case IA32_NEG32: case IA32_NEG16: case IA32_NEG8:
+    case IA32_NOT32: case IA32_NOT16: case IA32_NOT8:
+    case IA32_OR32: case IA32_OR16: case IA32_OR8:
+    case IA32_SBB32: case IA32_SBB16: case IA32_SBB8:
+    case IA32_SUB32: case IA32_SUB16: case IA32_SUB8:
+    case IA32_TEST32: case IA32_TEST16: case IA32_TEST8:
+    case IA32_XOR32: case IA32_XOR16: case IA32_XOR8:
+    case IA32_MUL32: case IA32_MUL16: case IA32_MUL8:
+    case IA32_IMUL32: case IA32_IMUL16: case IA32_IMUL8:
+    case IA32_DIV32: case IA32_DIV16: case IA32_DIV8:
+    case IA32_IDIV32: case IA32_IDIV16: case IA32_IDIV8:
+    case IA32_RCL32: case IA32_RCL16: case IA32_RCL8:
+    case IA32_RCR32: case IA32_RCR16: case IA32_RCR8:
+    case IA32_ROL32: case IA32_ROL16: case IA32_ROL8:
+    case IA32_ROR32: case IA32_ROR16: case IA32_ROR8:
+    case IA32_SAR32: case IA32_SAR16: case IA32_SAR8:
+    case IA32_SHL32: case IA32_SHL16: case IA32_SHL8:
+    case IA32_SHR32: case IA32_SHR16: case IA32_SHR8:
+    case IA32_SHLD32: case IA32_SHLD16:
+    case IA32_SHRD32: case IA32_SHRD16:
+    case IA32_MOV32: case IA32_MOV16: case IA32_MOV8:
+    case IA32_MOVSX32W: case IA32_MOVSX32B: case IA32_MOVSX16:
+    case IA32_MOVZX32W: case IA32_MOVZX32B: case IA32_MOVZX16:
+    case IA32_LEA32: case IA32_LEA16:
+    case IA32_PUSH32: case IA32_PUSH16:
+    case IA32_POP32: case IA32_POP16:
+    case IA32_PUSHA32: case IA32_PUSHA16:
+    case IA32_POPA32: case IA32_POPA16:
+    case IA32_XCHG32: case IA32_XCHG16: case IA32_XCHG8:
+    case IA32_CBW: case IA32_CWDE: case IA32_CWD: case IA32_CDQ:
+    case IA32_BSWAP:
+    case IA32_NOP:
+    case IA32_ENTER32: case IA32_ENTER16:
+    case IA32_LEAVE32: case IA32_LEAVE16:
+    case IA32_XLATB32: case IA32_XLATB16:
+    case IA32_SETA: case IA32_SETAE: case IA32_SETB: case IA32_SETE:
+    case IA32_SETG: case IA32_SETGE: case IA32_SETL: case IA32_SETNA:
+    case IA32_SETNE: case IA32_SETNG: case IA32_SETS:
+    case IA32_CLC: case IA32_STC: case IA32_CMC:
+    case IA32_CLD: case IA32_STD:
+    case IA32_LAHF: case IA32_SAHF:
+      return true;
+    default: return false;
+    }
+  
+} // end defer_eip_ok
+
+
+// Torna 0 si 'e' no és un salt proper relatiu, 1 si és incondicional
+// (JMP/CALL) i 2 si pot continuar en la següent instrucció. En 'op32'
+// torna la grandària de l'operand.
+static int
+rel_branch_type (
+                 const IA32_JIT_DisEntry *e,
+                 bool                    *op32
+                 )
+{
+
+  int ret;
+
+  
+  if ( e->inst.ops[0].type != IA32_REL8 &&
+       e->inst.ops[0].type != IA32_REL16 &&
+       e->inst.ops[0].type != IA32_REL32 )
+    return 0;
+  switch ( e->inst.name )
+    {
+    case IA32_JMP32_NEAR:
+    case IA32_CALL32_NEAR: *op32= true; ret= 1; break;
+    case IA32_JMP16_NEAR:
+    case IA32_CALL16_NEAR: *op32= false; ret= 1; break;
+    case IA32_JA32: case IA32_JAE32: case IA32_JB32: case IA32_JCXZ32:
+    case IA32_JE32: case IA32_JECXZ32: case IA32_JG32: case IA32_JGE32:
+    case IA32_JL32: case IA32_JNA32: case IA32_JNE32: case IA32_JNG32:
+    case IA32_JNO32: case IA32_JNS32: case IA32_JO32: case IA32_JP32:
+    case IA32_JPO32: case IA32_JS32: case IA32_LOOP32: case IA32_LOOPE32:
+    case IA32_LOOPNE32:
+      *op32= true; ret= 2;
+      break;
+    case IA32_JA16: case IA32_JAE16: case IA32_JB16: case IA32_JCXZ16:
+    case IA32_JE16: case IA32_JECXZ16: case IA32_JG16: case IA32_JGE16:
+    case IA32_JL16: case IA32_JNA16: case IA32_JNE16: case IA32_JNG16:
+    case IA32_JNO16: case IA32_JNS16: case IA32_JO16: case IA32_JP16:
+    case IA32_JPO16: case IA32_JS16: case IA32_LOOP16: case IA32_LOOPE16:
+    case IA32_LOOPNE16:
+      *op32= false; ret= 2;
+      break;
+    default: ret= 0;
+    }
+  
+  return ret;
+  
+} // end rel_branch_type
+
+
+// Tradueix l'adreça linial 'laddr' a física sense accedir a les
+// taules de pàgines. Sense paginació és directe, amb paginació sols
+// si està en la mateixa pàgina de 4K que 'ref_laddr' (amb adreça
+// física 'ref_addr'). Torna fals si no és possible.
+static bool
+succ_addr (
+           IA32_JIT       *jit,
+           const uint32_t  ref_laddr,
+           const uint32_t  ref_addr,
+           const uint32_t  laddr,
+           uint32_t       *addr
+           )
+{
+
+  if ( jit->_mem_readl8 == mem_readl8 )
+    *addr= laddr;
+  else if ( ((laddr^ref_laddr)&0xFFFFF000) == 0 )
+    *addr= (ref_addr&0xFFFFF000) | (laddr&0x00000FFF);
+  else return false;
+
+  return true;
+  
+} // end succ_addr
+
+
+// Afegeix {succ,first,last,is32} al vector 'v' (reopts o
+// flags_deps).
+static void
+add_reopt (
+           IA32_JIT_PageReopt **v,
+           uint32_t            *capacity,
+           uint32_t            *N,
+           const uint32_t       succ,
+           const uint32_t       first,
+           const uint32_t       last,
+           const bool           is32
+           )
+{
+
+  uint32_t tmp;
+  
+
+  if ( *N == *capacity )
+    {
+      tmp= (*capacity)*2;
+      *v= (IA32_JIT_PageReopt *)
+        realloc__ ( *v, tmp*sizeof(IA32_JIT_PageReopt) );
+      *capacity= tmp;
+    }
+  (*v)[*N].succ= succ;
+  (*v)[*N].first= first;
+  (*v)[*N].last= last;
+  (*v)[*N].is32= (uint32_t) is32;
+  ++(*N);
+  
+} // end add_reopt
+
+
+// Flags que necessita el successor en l'adreça física 'addr' d'un
+// bloc de la pàgina 'p' que no està en el bloc actual. Si està
+// compilat en 'p' o en una pàgina veïna s'empren els flags de
+// l'entrada, en cas contrari tots. Si és de 'p' i no està compilat
+// es registra per a tornar a compilar el bloc [first,last] quan es
+// compile, si està compilat es registra la dependència (veure
+// drop_block).
+static uint32_t
+succ_live_flags (
+                 IA32_JIT       *jit,
+                 IA32_JIT_Page  *p,
+                 const uint32_t  addr,
+                 const bool      is32,
+                 const uint32_t  first,
+                 const uint32_t  last
+                 )
+{
+
+  const IA32_JIT_MemMap *mem_map;
+  IA32_JIT_Page *q;
+  uint32_t page,e;
+  
+
+  // Pàgina
+  mem_map= &(jit->_mem_map[p->area_id]);
+  if ( addr < mem_map->first_addr || addr > mem_map->last_addr )
+    return 0xFFFFFFFF;
+  page= (addr-mem_map->first_addr)>>mem_map->bits_page;
+  if ( page != p->page_id && page+1 != p->page_id && page != p->page_id+1 )
+    return 0xFFFFFFFF;
+  q= map_get ( mem_map, page );
+  if ( q == NULL || q->entries[is32] == NULL ) return 0xFFFFFFFF;
+
+  // Entrada
+  e= addr&(mem_map->page_low_mask);
+  if ( q->entries[is32][e] != NULL_ENTRY && q->entries[is32][e] != PAD_ENTRY )
+    {
+      if ( page+1 == p->page_id ) p->flags_dep_prev= true;
+      else if ( page == p->page_id+1 ) p->flags_dep_next= true;
+      else
+        add_reopt ( &(p->flags_deps), &(p->flags_deps_capacity),
+                    &(p->flags_deps_N), e, first, last, is32 );
+      return ENTRY_FLAGS(q->entries_info[is32][e]) | (~OSZACP_FLAGS);
+    }
+  else if ( q == p )
+    add_reopt ( &(p->reopts), &(p->reopts_capacity), &(p->reopts_N),
+                e, first, last, is32 );
+  
+  return 0xFFFFFFFF;
+  
+} // end succ_live_flags
+
+
+// Calcula els flags que cal calcular en cada instrucció de
+// jit->_dis_v. Si 'succ_known' el bloc continua en la instrucció
+// següent a l'última (sense ser un salt).
+static void
+optimize_flags (
+                IA32_JIT       *jit,
+                IA32_JIT_Page  *p,
+                const size_t    N,
+                const uint32_t  offset0,
+                const bool      is32,
+                const bool      succ_known
+                )
+{
+
+  const IA32_JIT_DisEntry *last;
+  uint32_t ext,out,prev_out,laddr0,addr,next_addr,next_off,target,first;
+  uint32_t flags,last_e;
+  size_t n,m,succ[2];
+  int nsucc,type,i;
+  bool op32;
+  
+
+  // Successors del bloc. Els que estan dins del bloc es calculen
+  // iterant, per als de fora es consulta l'entrada.
+  last= &(jit->_dis_v[N-1]);
+  laddr0= P_CS->h.lim.addr + offset0;
+  next_addr= last->addr + (uint32_t) last->inst.real_nbytes;
+  next_off= offset0 + (next_addr-jit->_dis_v[0].addr);
+  first= jit->_dis_v[0].addr&(PAGE_LOW_MASK(p));
+  if ( ((next_addr-1)^jit->_dis_v[0].addr)&(~(PAGE_LOW_MASK(p))) )
+    last_e= PAGE_LOW_MASK(p);
+  else last_e= (next_addr-1)&(PAGE_LOW_MASK(p));
+  ext= 0;
+  nsucc= 0;
+  type= rel_branch_type ( last, &op32 );
+  if ( INSTS_METADATA[last->inst.name].branch && type == 0 )
+    ext= 0xFFFFFFFF;
+  else if ( !INSTS_METADATA[last->inst.name].branch && !succ_known )
+    ext= 0xFFFFFFFF;
+  else
+    {
+      for ( i= 0; i < 2 && ext != 0xFFFFFFFF; ++i )
+        {
+          if ( i == 0 ) // Següent instrucció
+            {
+              if ( type == 1 ) continue;
+              target= next_off;
+            }
+          else // Destinació del salt
+            {
+              if ( type == 0 ) continue;
+              if ( last->inst.ops[0].type == IA32_REL8 )
+                target= next_off +
+                  (uint32_t) ((int32_t) ((int8_t) last->inst.ops[0].u8));
+              else if ( last->inst.ops[0].type == IA32_REL16 )
+                target= next_off +
+                  (uint32_t) ((int32_t) ((int16_t) last->inst.ops[0].u16));
+              else target= next_off + last->inst.ops[0].u32;
+              if ( !op32 ) target&= 0xFFFF;
+            }
+          if ( !succ_addr ( jit, laddr0, jit->_dis_v[0].addr,
+                            P_CS->h.lim.addr + target, &addr ) )
+            { ext= 0xFFFFFFFF; continue; }
+          for ( m= 0; m < N && jit->_dis_v[m].addr != addr; ++m );
+          if ( m < N ) succ[nsucc++]= m;
+          else ext|= succ_live_flags ( jit, p, addr, is32, first, last_e );
+        }
+    }
+  
+  // Itera fins que s'estabilitza (salts cap a dins del bloc).
+  for ( n= 0; n < N; ++n ) jit->_dis_v[n].flags= 0;
+  out= ext;
+  do {
+    prev_out= out;
+    flags= out;
+    for ( n= N-1; n != (size_t) -1; --n )
+      {
+        jit->_dis_v[n].flags= flags;
+        assert ( jit->_dis_v[n].inst.name ==
+                 INSTS_METADATA[jit->_dis_v[n].inst.name].name );
+        flags= inst_live_flags ( &(jit->_dis_v[n]), flags );
+      }
+    for ( i= 0; i < nsucc; ++i )
+      out|= inst_live_flags ( &(jit->_dis_v[succ[i]]),
+                              jit->_dis_v[succ[i]].flags );
+  } while ( out != prev_out );
+  
+} // end optimize_flags
+
+
+// Registra en 'p' el bloc format per les instruccions de
+// jit->_dis_v (compilades en el mode 'is32').
+static void
+add_block (
+           IA32_JIT      *jit,
+           IA32_JIT_Page *p,
+           const size_t   N,
+           const bool     is32
+           )
+{
+
+  const IA32_JIT_DisEntry *last;
+  uint32_t next_addr,tmp;
+  
+
+  if ( p->blocks_N == p->blocks_capacity )
+    {
+      tmp= p->blocks_capacity*2;
+      p->blocks= (IA32_JIT_PageBlock *)
+        realloc__ ( p->blocks, tmp*sizeof(IA32_JIT_PageBlock) );
+      p->blocks_capacity= tmp;
+    }
+  last= &(jit->_dis_v[N-1]);
+  next_addr= last->addr + (uint32_t) last->inst.real_nbytes;
+  p->blocks[p->blocks_N].first= jit->_dis_v[0].addr&(PAGE_LOW_MASK(p));
+  if ( ((next_addr-1)^jit->_dis_v[0].addr)&(~(PAGE_LOW_MASK(p))) )
+    p->blocks[p->blocks_N].last= PAGE_LOW_MASK(p);
+  else p->blocks[p->blocks_N].last= (next_addr-1)&(PAGE_LOW_MASK(p));
+  p->blocks[p->blocks_N].is32= (uint32_t) is32;
+  ++(p->blocks_N);
+  
+} // end add_block
+
+
+// Descarta els blocs de 'p' que estaven esperant que es compilaren
+// les instruccions de jit->_dis_v (en el mode 'is32').
+static void
+reopt_blocks (
+              IA32_JIT      *jit,
+              IA32_JIT_Page *p,
+              const size_t   N,
+              const bool     is32
+              )
+{
+
+  uint32_t i,first;
+  size_t n;
+  int b;
+  
+
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  // Les entrades d'una pàgina amb superblocs no es poden esborrar
+  // (deixarien de detectar-se les escriptures sobre el codi del
+  // superbloc), es renuncia a tornar a optimitzar.
+  if ( p->sb_covered ) { p->reopts_N= 0; return; }
+#endif
+  i= 0;
+  while ( i < p->reopts_N )
+    {
+      if ( p->reopts[i].is32 != (uint32_t) is32 ) { ++i; continue; }
+      for ( n= 0;
+            n < N &&
+              (jit->_dis_v[n].addr&(PAGE_LOW_MASK(p))) !=
+              p->reopts[i].succ;
+            ++n );
+      if ( n < N )
+        {
+          // El bloc s'havia compilat suposant que el successor
+          // necessitava tots els flags, els blocs que depenen d'ell
+          // continuen sent correctes. drop_block lleva els reopts del
+          // bloc, es torna a començar.
+          first= p->reopts[i].first;
+          p->reopts[i]= p->reopts[--(p->reopts_N)];
+          b= find_block_at ( p, first, is32 );
+          if ( b != -1 )
+            {
+              drop_block ( jit, p, b, false );
+              i= 0;
+            }
+        }
+      else ++i;
+    }
+  
+} // end reopt_blocks
+
+
+// Torna en pos la posició de la primera instrucció descodificada o
+// NULL_ENTRY per a indicar que cal esborrar i recompilar tota la
+// pàgina. Açò no és considera en realitat un error. En cas d'error
+// (cal executar l'excepció) torna false, true si no cal executar cap
+// excepció.
+static bool
+dis_insts (
+           IA32_JIT      *jit,
+           IA32_JIT_Page *p,
+           uint32_t       addr,
+           uint32_t       offset,
+           uint32_t      *pos
+           )
+{
+
+  uint32_t last_addr,e,tmp_e,beg_offset;
+  size_t n,N,tmp_size,diff;
+  int i,nbytes;
+  bool is32,end,succ_known;
+#ifdef IA32_JIT_NATIVE
+  int native_n;
+  uint32_t native_pos,native_off;
+#endif
+  
+  
+  // Última adreça de la pàgina actual. S'assumix que addr és una
+  // adreça vàlida de la pàgina.
+  last_addr= (addr&(~(PAGE_LOW_MASK(p)))) | (PAGE_LOW_MASK(p));
+
+  // Desenssambla tot el que es puga abans d'aplegar al final,
+  // trovar-se una instrucció de control de fluxe, una excepció o un
+  // solapament. També pare si el offset pega la volta 0xffffffff -> 0
+  beg_offset= offset;
+  is32= ADDR_OP_SIZE_IS_32;
+  N= 0;
+  end= false;
+  succ_known= false;
+  assert ( jit->_exception.vec == -1 );
+  tmp_e= addr&(PAGE_LOW_MASK(p));
   if ( tmp_e < p->first_entry ) p->first_entry= tmp_e;
   if ( tmp_e > p->last_entry ) p->last_entry= tmp_e;
   do {
@@ -5374,10 +7533,20 @@ dis_insts (
 
     // Si una instrucció ja està desenssamblada pare (caldrà ficar un
     // goto eip) no passarà mai amb la primera instrucció.
-    e= addr&(jit->_page_low_mask);
-    if ( p->entries[e].ind != NULL_ENTRY && p->entries[e].ind != PAD_ENTRY )
+    e= addr&(PAGE_LOW_MASK(p));
+    if ( p->entries[is32][e] != NULL_ENTRY &&
+         p->entries[is32][e] != PAD_ENTRY )
       {
         assert ( N > 0 );
+        succ_known= true;
+        break;
+      }
+
+    // Limita la grandària del bloc (veure MAX_ENTRY_POS). Continua en
+    // la instrucció següent com si ja estiguera desenssamblada.
+    if ( N == DIS_MAX_INSTS )
+      {
+        succ_known= true;
         break;
       }
             
@@ -5397,9 +7566,8 @@ dis_insts (
         nbytes= jit->_dis_v[N].inst.real_nbytes;
         ++N;
 
-        // De moment etiqueta totes les entrades com a PAD i calcula
-        // overpadding. Si trova alguna no NULL acava amb
-        // error. Actualitza també addr.
+        // De moment etiqueta com a PAD les entrades NULL i calcula
+        // overpadding. Actualitza també addr.
         diff= ((size_t) last_addr-addr)+1;
         if ( diff > (size_t) nbytes )
           {
@@ -5418,59 +7586,41 @@ dis_insts (
           }
         else // Fi de pàgina (pot ser amb solapament)
           {
-            p->overlap_next_page= nbytes - ((int) diff);
+            // Altres fluxos poden haver aplegat ja al final.
+            if ( nbytes - ((int) diff) > p->overlap_next_page )
+              p->overlap_next_page= nbytes - ((int) diff);
+            if ( !jit->_mem_map[p->area_id].rom )
+              mark_code_frames ( jit, last_addr+1,
+                                 last_addr +
+                                 (uint32_t) p->overlap_next_page );
             nbytes= (int) diff;
-            p->last_entry= jit->_page_low_mask;
+            p->last_entry= PAGE_LOW_MASK(p);
+            succ_known= !end;
             end= true;
           }
+        // Si es solapa amb instruccions d'un bloc anterior (s'ha botat
+        // a meitat d'una instrucció) el bloc es manté: les entrades
+        // d'eixes instruccions continuen sent vàlides i el nou flux
+        // conviu amb ell. Un canvi en qualsevol dels bytes descarta
+        // tots els blocs solapats (veure drop_block).
         for ( i= 0; i < nbytes; ++i, ++e )
-          {
-            // Torna amb error indicant que s'ha de tornar a
-            // recompilar tota la pàgina.
-            if ( p->entries[e].ind != NULL_ENTRY )
-              {
-                *pos= NULL_ENTRY;
-                return true;
-              }
-            p->entries[e].ind= PAD_ENTRY; // De moment
-            p->entries[e].is32= is32;
-          }
+          if ( p->entries[is32][e] == NULL_ENTRY )
+            p->entries[is32][e]= PAD_ENTRY; // De moment
         // NOTA!!! En cas d'overlap podria comprovar també els bytes
         // de la pàgina següent en cas d'existir. Però com no vaig a
-        // gestionar codi entre pàgines, viaig a ser permisiu. Sí que
-        // és important esborrar la pàgina si dos instruccions de la
-        // mateixa pàgina es solapen.
+        // gestionar codi entre pàgines, viaig a ser permisiu.
         
       }
     else end= true;
     
   } while ( !end );
 
-  // Optimització de flags
+  // Optimització de flags. Té en compte els successors del bloc.
   if ( jit->_optimize_flags )
     {
-      flags= 0xFFFFFFFF;
-      for ( n= N-1; n != (size_t) -1; --n )
-        {
-          jit->_dis_v[n].flags= flags;
-          name= jit->_dis_v[n].inst.name;
-          //printf("%d %d\n",name,INSTS_METADATA[name].name);
-          assert ( name == INSTS_METADATA[name].name);
-          if ( jit->_dis_v[n].inst.prefix == IA32_PREFIX_NONE )
-            {
-              flags&= ~(INSTS_METADATA[name].chg_flags);
-              flags|= INSTS_METADATA[name].req_flags;
-            }
-          // Quan hi ha REP és possible no executar res, per tant
-          // chn_flags pot ser 0.
-          else 
-            {
-              flags|= INSTS_METADATA[name].req_flags;
-              if ( jit->_dis_v[n].inst.prefix == IA32_PREFIX_REPE ||
-                   jit->_dis_v[n].inst.prefix == IA32_PREFIX_REPNE )
-                flags|= ZF_FLAG;
-            }
-        }
+      if ( N > 0 )
+        optimize_flags ( jit, p, N, beg_offset, is32,
+                         succ_known && jit->_exception.vec == -1 );
     }
   else
     {
@@ -5478,23 +7628,85 @@ dis_insts (
         jit->_dis_v[n].flags= 0xFFFFFFFF;
     }
 
+  // Les instruccions que no lligen la EIP i van seguides d'altra
+  // igual no actualitzen la EIP, l'increment s'acumula fins la
+  // següent parada. L'última instrucció del bloc sempre l'actualitza.
+  for ( n= 0; n < N; ++n )
+    {
+      jit->_dis_v[n].defer_eip=
+        n+1 < N &&
+        defer_eip_ok ( &(jit->_dis_v[n].inst) ) &&
+        defer_eip_ok ( &(jit->_dis_v[n+1].inst) );
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      jit->_dis_v[n].sb= SB_NONE;
+#endif
+    }
+  
   // Compila a bytecode
   *pos= p->N;
+#ifdef IA32_JIT_NATIVE
+  native_n= 0;
+  native_pos= 0;
+#endif
   for ( n= 0; n < N; ++n )
     {
-      e= jit->_dis_v[n].addr&(jit->_page_low_mask);
-      p->entries[e].ind= p->N;
+      // Si la posició no cap en l'entrada cal tornar a compilar tota
+      // la pàgina.
+      if ( p->N > MAX_ENTRY_POS )
+        {
+          *pos= NULL_ENTRY;
+          return true;
+        }
+      e= jit->_dis_v[n].addr&(PAGE_LOW_MASK(p));
+      p->entries[is32][e]= (uint16_t) p->N;
+      p->entries_info[is32][e]=
+        ENTRY_INFO ( inst_live_flags ( &(jit->_dis_v[n]),
+                                       jit->_dis_v[n].flags ) );
+#ifdef IA32_JIT_NATIVE
+      // Si comença una seqüència traduible afegeix abans un
+      // BC_NATIVE. El bytecode de cada instrucció es genera igualment
+      // per si es bota a meitat seqüència o no hi ha pressupost.
+      if ( native_n == 0 && jit->_native &&
+           (i= native_run_length ( &(jit->_dis_v[n]), N-n ))
+           >= NATIVE_MIN_INSTS )
+        {
+          if ( native_compile ( p, &(jit->_dis_v[n]), i, &native_off ) )
+            {
+              native_pos= p->N;
+              native_n= i;
+              add_word ( p, BC_NATIVE );
+              add_word ( p, (uint16_t) (native_off&0xFFFF) );
+              add_word ( p, (uint16_t) (native_off>>16) );
+              add_word ( p, (uint16_t) native_n );
+              add_word ( p, 0 ); // Grandària bytecode seqüència
+            }
+          else
+            {
+              jit->warning ( jit->udata, "no s'ha pogut reservar memòria"
+                             " executable, es desactiva el codi natiu" );
+              jit->_native= false;
+            }
+        }
+#endif
       compile ( jit, &(jit->_dis_v[n]), p );
+#ifdef IA32_JIT_NATIVE
+      if ( native_n > 0 && --native_n == 0 )
+        p->v[native_pos+4]= (uint16_t) (p->N-(native_pos+5));
+#endif
     }
+  if ( N > 0 ) add_block ( jit, p, N, is32 );
   // --> Si s'ha acabat sense excepció ni branch s'afegeix un goto_eip
-  //     adicional i es transforma el INC_EIP per un no stop
+  //     adicional i es transforma el INC_EIP en un INC_EIP_GOTO, que
+  //     fa el goto_eip amb l'enllaç del GOTO_EIP següent. El
+  //     GOTO_EIP es manté perquè BC_NATIVE pot continuar en ell.
   if ( jit->_exception.vec == -1 &&
        (N == 0 || !INSTS_METADATA[jit->_dis_v[N-1].inst.name].branch ) )
     {
       if ( p->N > 0 &&
            p->v[p->N-1] >= BC_INC1_EIP && p->v[p->N-1] < BC_INC1_EIP_NOSTOP )
-        p->v[p->N-1]+= BC_INC1_EIP_NOSTOP-BC_INC1_EIP;
+        p->v[p->N-1]+= BC_INC1_EIP_GOTO-BC_INC1_EIP;
       add_word ( p, BC_GOTO_EIP );
+      add_link ( p );
     }
   
   // En cas d'excepció.
@@ -5508,8 +7720,9 @@ dis_insts (
           if ( p->N > 0 &&
                p->v[p->N-1] >= BC_INC1_EIP &&
                p->v[p->N-1] < BC_INC1_EIP_NOSTOP )
-            p->v[p->N-1]+= BC_INC1_EIP_NOSTOP-BC_INC1_EIP;
+            p->v[p->N-1]+= BC_INC1_EIP_GOTO-BC_INC1_EIP;
           add_word ( p, BC_GOTO_EIP );
+          add_link ( p );
           jit->_exception.vec= -1; // Ignora excepció.
         }
       // En cas contrari l'excepció serà la primera del bloc, i forcem
@@ -5521,12 +7734,341 @@ dis_insts (
       jit->_exception.vec= -1;
       */
     }
+
+  // Blocs que esperaven estes instruccions per a optimitzar els flags.
+  if ( p->reopts_N > 0 ) reopt_blocks ( jit, p, N, is32 );
   
   return true;
   
 } // end dis_insts
 
 
+#ifdef __IA32_JIT_SUPERBLOCKS__
+// Torna la pàgina ('p' o la següent) on l'adreça física 'addr' és
+// l'inici d'una instrucció compilada en el mode 'is32', NULL si no
+// n'hi ha.
+static IA32_JIT_Page *
+sb_page (
+         IA32_JIT            *jit,
+         const IA32_JIT_Page *p,
+         const uint32_t       addr,
+         const bool           is32
+         )
+{
+
+  const IA32_JIT_MemMap *mem_map;
+  IA32_JIT_Page *q;
+  uint32_t page,e;
+  
+  
+  mem_map= &(jit->_mem_map[p->area_id]);
+  if ( addr < mem_map->first_addr || addr > mem_map->last_addr )
+    return NULL;
+  page= (addr-mem_map->first_addr)>>mem_map->bits_page;
+  if ( page != p->page_id && page != p->page_id+1 ) return NULL;
+  q= map_get ( mem_map, page );
+  if ( q == NULL || q->entries[is32] == NULL ) return NULL;
+  e= addr&(mem_map->page_low_mask);
+  if ( q->entries[is32][e] == NULL_ENTRY || q->entries[is32][e] == PAD_ENTRY )
+    return NULL;
+  
+  return q;
+  
+} // end sb_page
+
+
+// Flags que necessita l'entrada 'addr' segons sb_page, tots si no
+// està compilada.
+static uint32_t
+sb_entry_flags (
+                IA32_JIT            *jit,
+                const IA32_JIT_Page *p,
+                const uint32_t       addr,
+                const bool           is32
+                )
+{
+
+  const IA32_JIT_Page *q;
+  
+
+  q= sb_page ( jit, p, addr, is32 );
+  if ( q == NULL ) return 0xFFFFFFFF;
+
+  return ENTRY_FLAGS(q->entries_info[is32][addr&(PAGE_LOW_MASK(q))]) |
+    (~OSZACP_FLAGS);
+  
+} // end sb_entry_flags
+
+
+// Torna en 'addr' l'adreça física del successor en 'offset' d'una
+// instrucció amb adreça linial 'laddr' i física 'ref_addr', i en
+// 'guard' si cal comprovar-la en temps d'execució perquè està en
+// altra pàgina de 4K. Torna fals si no és una instrucció compilada
+// en 'p' o la següent.
+static bool
+sb_succ (
+         IA32_JIT            *jit,
+         const IA32_JIT_Page *p,
+         const uint32_t       laddr,
+         const uint32_t       ref_addr,
+         const uint32_t       offset,
+         const bool           is32,
+         uint32_t            *addr,
+         bool                *guard
+         )
+{
+
+  uint32_t next_laddr;
+  
+
+  next_laddr= P_CS->h.lim.addr + offset;
+  if ( !succ_addr ( jit, laddr, ref_addr, next_laddr, addr ) ||
+       sb_page ( jit, p, *addr, is32 ) == NULL )
+    return false;
+  *guard= ((next_laddr^laddr)&0xFFFFF000) != 0;
+  
+  return true;
+  
+} // end sb_succ
+
+
+// Compila en 'p' un superbloc que comença en l'entrada 'e0', que ha
+// de correspondre amb la EIP actual. El superbloc segueix el camí
+// més freqüent (segons els comptadors de les entrades) a través dels
+// salts relatius, i pot continuar en la pàgina següent. Sols es
+// segueixen instruccions que ja estan compilades, d'eixa manera les
+// escriptures sobre el seu codi es detecten igual que fins ara. Els
+// salts del camí es compilen com a guardes que ixen del superbloc si
+// la condició no és l'esperada. Si el superbloc no aporta res no es
+// compila.
+static void
+sb_build (
+          IA32_JIT       *jit,
+          IA32_JIT_Page  *p,
+          const uint32_t  e0
+          )
+{
+
+  const IA32_JIT_MemMap *mem_map;
+  IA32_JIT_DisEntry *d;
+  IA32_JIT_Page *q;
+  uint32_t addr,laddr,offset,next_off,target,alt,taddr,faddr,pos0;
+  uint32_t cnt_t,cnt_f;
+  uint32_t tpos[SB_MAX_INSTS];
+  bool guard[SB_MAX_INSTS];
+  size_t n,N,m,back,tmp_size;
+  bool is32,op32,tguard,fguard,next_guard,useful,in_next;
+  int type;
+  
+  
+  // Capçalera.
+  is32= ADDR_OP_SIZE_IS_32;
+  if ( p->N > MAX_ENTRY_POS ) return; // No cabria en l'entrada
+  mem_map= &(jit->_mem_map[p->area_id]);
+  addr= mem_map->first_addr + (p->page_id<<mem_map->bits_page) + e0;
+  offset= EIP;
+  laddr= P_CS->h.lim.addr + offset;
+  
+  // Segueix el camí.
+  assert ( jit->_exception.vec == -1 );
+  N= 0;
+  back= (size_t) -1;
+  next_guard= false;
+  in_next= false;
+  do {
+
+    // Prepara memòria.
+    if ( N == jit->_dis_capacity )
+      {
+        tmp_size= jit->_dis_capacity*2;
+        jit->_dis_v=
+          (IA32_JIT_DisEntry *) realloc__
+          ( jit->_dis_v, tmp_size*sizeof(IA32_JIT_DisEntry) );
+        jit->_dis_capacity= tmp_size;
+      }
+
+    // Desenssambla. Si falla l'anterior passa a ser l'última.
+    d= &(jit->_dis_v[N]);
+    IA32_dis ( &(jit->_dis), (uint64_t) offset, &(d->inst) );
+    if ( jit->_exception.vec != -1 )
+      {
+        jit->_exception.vec= -1;
+        if ( N > 0 ) jit->_dis_v[N-1].sb= SB_NONE;
+        break;
+      }
+    d->addr= addr;
+    d->flags= 0;
+    d->sb= SB_NONE;
+    guard[N]= next_guard;
+    if ( addr-(addr&(mem_map->page_low_mask)) !=
+         mem_map->first_addr + (p->page_id<<mem_map->bits_page) )
+      in_next= true;
+    ++N;
+    
+    // Successor dins del superbloc.
+    next_off= offset + (uint32_t) d->inst.real_nbytes;
+    type= rel_branch_type ( d, &op32 );
+    if ( INSTS_METADATA[d->inst.name].branch )
+      {
+        if ( type == 0 ||
+             d->inst.name == IA32_CALL32_NEAR ||
+             d->inst.name == IA32_CALL16_NEAR ||
+             d->inst.name == IA32_LOOP32 || d->inst.name == IA32_LOOP16 ||
+             d->inst.name == IA32_LOOPE32 || d->inst.name == IA32_LOOPE16 ||
+             d->inst.name == IA32_LOOPNE32 || d->inst.name == IA32_LOOPNE16 )
+          break;
+        if ( d->inst.ops[0].type == IA32_REL8 )
+          target= next_off +
+            (uint32_t) ((int32_t) ((int8_t) d->inst.ops[0].u8));
+        else if ( d->inst.ops[0].type == IA32_REL16 )
+          target= next_off +
+            (uint32_t) ((int32_t) ((int16_t) d->inst.ops[0].u16));
+        else target= next_off + d->inst.ops[0].u32;
+        if ( !op32 )
+          {
+            if ( target > 0xFFFF ) break;
+            target&= 0xFFFF;
+          }
+        if ( type == 1 ) d->sb= SB_TAKEN;
+        else
+          {
+            // Es queda amb el successor per on s'ha entrat més
+            // vegades. L'altre és una eixida del superbloc.
+            cnt_t= cnt_f= 0;
+            if ( sb_succ ( jit, p, laddr, addr, target, is32,
+                           &taddr, &tguard ) )
+              {
+                q= sb_page ( jit, p, taddr, is32 );
+                cnt_t= q->entries_count[is32][taddr&(mem_map->page_low_mask)];
+              }
+            if ( sb_succ ( jit, p, laddr, addr, next_off, is32,
+                           &faddr, &fguard ) )
+              {
+                q= sb_page ( jit, p, faddr, is32 );
+                cnt_f= q->entries_count[is32][faddr&(mem_map->page_low_mask)];
+              }
+            if ( cnt_t == 0 && cnt_f == 0 ) break;
+            if ( cnt_t > cnt_f )
+              {
+                d->sb= SB_TAKEN;
+                d->flags= cnt_f == 0 ?
+                  0xFFFFFFFF : sb_entry_flags ( jit, p, faddr, is32 );
+              }
+            else
+              {
+                d->sb= SB_NOT_TAKEN;
+                d->flags= cnt_t == 0 ?
+                  0xFFFFFFFF : sb_entry_flags ( jit, p, taddr, is32 );
+                target= next_off;
+              }
+          }
+      }
+    else if ( d->inst.name == IA32_MOV32 && d->inst.ops[0].type == IA32_CR0 )
+      break;
+    else
+      {
+        if ( next_off < offset ) break;
+        target= next_off;
+      }
+    if ( N == SB_MAX_INSTS ) { d->sb= SB_NONE; break; }
+
+    // Següent instrucció.
+    if ( !sb_succ ( jit, p, laddr, addr, target, is32, &alt, &next_guard ) )
+      {
+        d->sb= SB_NONE;
+        break;
+      }
+    for ( m= 0; m < N && jit->_dis_v[m].addr != alt; ++m );
+    if ( m < N )
+      {
+        // Tanca el bucle.
+        back= m;
+        if ( next_guard && !guard[m] ) guard[m]= true;
+        break;
+      }
+    offset= target;
+    laddr= P_CS->h.lim.addr + offset;
+    addr= alt;
+    
+  } while ( true );
+  // Sols val la pena si va més enllà del bloc original.
+  useful= in_next || back != (size_t) -1;
+  for ( n= 0; n < N && !useful; ++n )
+    useful= guard[n] || jit->_dis_v[n].sb != SB_NONE;
+  if ( !useful || N < 2 ) return;
+
+  // Flags. Cada instrucció calcula el que necessita la següent del
+  // camí (segons el que es va registrar en la seua entrada) més el
+  // que necessita l'eixida, així el superbloc no necessita més flags
+  // a l'entrada que el bloc original.
+  for ( n= 0; n < N; ++n )
+    {
+      d= &(jit->_dis_v[n]);
+      if ( !jit->_optimize_flags ) d->flags= 0xFFFFFFFF;
+      else if ( n+1 < N )
+        d->flags|= sb_entry_flags ( jit, p, jit->_dis_v[n+1].addr, is32 );
+      else if ( back != (size_t) -1 )
+        d->flags|= sb_entry_flags ( jit, p, jit->_dis_v[back].addr, is32 );
+      else d->flags= 0xFFFFFFFF;
+    }
+  
+  // EIP diferida. Els salts del superbloc apliquen l'increment
+  // pendent.
+  for ( n= 0; n < N; ++n )
+    jit->_dis_v[n].defer_eip=
+      n+1 < N &&
+      defer_eip_ok ( &(jit->_dis_v[n].inst) ) &&
+      (defer_eip_ok ( &(jit->_dis_v[n+1].inst) ) ||
+       jit->_dis_v[n+1].sb != SB_NONE);
+  
+  // Compila.
+  pos0= p->N;
+  for ( n= 0; n < N; ++n )
+    {
+      d= &(jit->_dis_v[n]);
+      tpos[n]= p->N;
+      if ( guard[n] )
+        {
+          add_word ( p, BC_SB_GUARD );
+          add_word ( p, (uint16_t) (d->addr&0xFFFF) );
+          add_word ( p, (uint16_t) (d->addr>>16) );
+        }
+      compile ( jit, d, p );
+    }
+  if ( back != (size_t) -1 )
+    {
+      add_word ( p, BC_SB_GOTO );
+      add_word ( p, (uint16_t) (tpos[back]&0xFFFF) );
+      add_word ( p, (uint16_t) (tpos[back]>>16) );
+    }
+  else if ( !INSTS_METADATA[jit->_dis_v[N-1].inst.name].branch )
+    {
+      if ( p->v[p->N-1] >= BC_INC1_EIP && p->v[p->N-1] < BC_INC1_EIP_NOSTOP )
+        p->v[p->N-1]+= BC_INC1_EIP_GOTO-BC_INC1_EIP;
+      add_word ( p, BC_GOTO_EIP );
+      add_link ( p );
+    }
+
+  // Instal·la.
+  p->entries[is32][e0]= (uint16_t) pos0;
+  p->sb_covered= true;
+  if ( in_next )
+    {
+      p->sb_dep_next= true;
+      map_get ( mem_map, p->page_id+1 )->sb_covered= true;
+    }
+  update_page_bytes ( jit, p );
+  invalidate_links ( jit );
+  
+} // end sb_build
+#endif
+
+
+/* CACHE PERSISTENT ***********************************************************/
+
+#include "jit_cache.h"
+
+
 /* EXECUTA INSTRUCCIONS *******************************************************/
 
 #include "jit_exec.h"
@@ -5550,7 +8092,7 @@ IA32_jit_new (
   
   IA32_JIT *ret;
   size_t i,tmp;
-  int n;
+  int n,bits;
   
   
   assert ( cpu != NULL );
@@ -5567,6 +8109,7 @@ IA32_jit_new (
   ret->mem_write8= NULL;
   ret->mem_write16= NULL;
   ret->mem_write32= NULL;
+  ret->mem_host_page= NULL;
   ret->port_read8= NULL;
   ret->port_read16= NULL;
   ret->port_read32= NULL;
@@ -5577,32 +8120,67 @@ IA32_jit_new (
   // CPU
   ret->_cpu= cpu;
   
-  // Pàgines
-  ret->_bits_page= bits_page;
-  ret->_page_low_mask= (1<<bits_page)-1;
+#ifdef __IA32_JIT_PROFILE__
+  // Perfil. La fila BC_NUM és per al primer bytecode.
+  ret->_prof= (uint64_t *) malloc__ ( sizeof(uint64_t)*(BC_NUM+1)*BC_NUM );
+  for ( i= 0; i < (size_t) ((BC_NUM+1)*BC_NUM); ++i )
+    ret->_prof[i]= 0;
+#endif
+  
+  // Pàgines. Cada àrea té la seua grandària de pàgina.
   assert ( N > 0 );
   ret->_mem_map= (IA32_JIT_MemMap *) malloc__ ( sizeof(IA32_JIT_MemMap)*N );
   ret->_mem_map_size= N;
   for ( n= 0; n < N; ++n )
     {
       assert ( mem_areas[n].size > 0 );
-      tmp= mem_areas[n].size>>bits_page;
-      assert ( (mem_areas[n].addr&ret->_page_low_mask) == 0 );
+      bits= mem_areas[n].bits_page != 0 ? mem_areas[n].bits_page : bits_page;
+      assert ( bits <= 16 && bits >= 4 );
+      ret->_mem_map[n].bits_page= bits;
+      ret->_mem_map[n].page_low_mask= (1<<bits)-1;
+      tmp= mem_areas[n].size>>bits;
+      assert ( (mem_areas[n].addr&ret->_mem_map[n].page_low_mask) == 0 );
       if ( n > 0 )
         {
           assert ( mem_areas[n].addr > ret->_mem_map[n-1].last_addr );
         }
       ret->_mem_map[n].first_addr= mem_areas[n].addr;
       ret->_mem_map[n].last_addr= mem_areas[n].addr + (mem_areas[n].size-1);
+      ret->_mem_map[n].rom= mem_areas[n].rom;
       assert ( ret->_mem_map[n].first_addr <= ret->_mem_map[n].last_addr );
-      ret->_mem_map[n].map=
-        (IA32_JIT_Page **) malloc__ ( sizeof(IA32_JIT_Page *)*tmp );
-      for ( i= 0; i < tmp; ++i )
+      ret->_mem_map[n].map_size=
+        (uint32_t) ((tmp+MAP_LEAF_MASK)>>MAP_LEAF_BITS);
+      ret->_mem_map[n].map= (IA32_JIT_Page ***)
+        malloc__ ( sizeof(IA32_JIT_Page **)*ret->_mem_map[n].map_size );
+      for ( i= 0; i < ret->_mem_map[n].map_size; ++i )
         ret->_mem_map[n].map[i]= NULL;
     }
+  ret->_area_lut= (int *) malloc__ ( sizeof(int)*AREA_LUT_SIZE );
+  for ( i= 0; i < AREA_LUT_SIZE; ++i )
+    ret->_area_lut[i]= -1;
+  for ( n= N-1; n >= 0; --n )
+    for ( i= ret->_mem_map[n].first_addr>>AREA_LUT_SHIFT;
+          i <= (ret->_mem_map[n].last_addr>>AREA_LUT_SHIFT);
+          ++i )
+      ret->_area_lut[i]= n;
+  ret->_code_bitmap= (uint32_t *) malloc__ ( sizeof(uint32_t)*CODE_BITMAP_SIZE );
+  for ( i= 0; i < CODE_BITMAP_SIZE; ++i )
+    ret->_code_bitmap[i]= 0;
   ret->_free_pages= NULL;
   ret->_pages= NULL;
   ret->_pages_tail= NULL;
+  ret->_bytes= 0;
+  ret->_max_bytes= SIZE_MAX;
+  ret->_arena.chunks= NULL;
+  for ( n= 0; n < IA32_JIT_ARENA_CLASSES; ++n )
+    ret->_arena.free[n]= NULL;
+  ret->_arena.bytes= 0;
+#ifdef __IA32_JIT_CACHE__
+  ret->_cache= NULL;
+  ret->_cache_recs= NULL;
+  ret->_cache_used= NULL;
+  ret->_cache_N= 0;
+#endif
   ret->_current_page= NULL;
   ret->_current_pos= 0; // 0 no té sentit
   ret->_lock_page= NULL;
@@ -5618,6 +8196,9 @@ IA32_jit_new (
   
   // Inicialitza disassembler
   ret->_optimize_flags= optimize_flags;
+#ifdef IA32_JIT_NATIVE
+  ret->_native= true;
+#endif
   ret->_dis.udata= (void *) ret;
   ret->_dis.mem_read= dis_mem_read;
   ret->_dis.address_size_is_32= dis_address_operand_size_is_32;
@@ -5632,9 +8213,16 @@ IA32_jit_new (
   ret->_ignore_exceptions= false;
   ret->_inhibit_interrupt= false;
   ret->_intr= false;
-  ret->_stop_after_port_write= false;
+  ret->_halted= false;
+  ret->_stop= false;
+  ret->_link_gen= 1;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  ret->_lazy.mask= 0;
+#endif
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    ret->_pag32_v[n]= paging_32b_new ();
+  ret->_pag32= ret->_pag32_v[0];
   update_mem_callbacks ( ret );
-  ret->_pag32= paging_32b_new ();
   
   return ret;
   
@@ -5652,8 +8240,14 @@ IA32_jit_reset (
   jit->_inhibit_interrupt= false;
   jit->_ignore_exceptions= false;
   jit->_intr= false;
-  jit->_stop_after_port_write= false;
+  jit->_halted= false;
+  jit->_stop= false;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  jit->_lazy.mask= 0;
+#endif
   update_mem_callbacks ( jit );
+  // Si la paginació ja estava activada cal tornar a llegir les taules.
+  if ( jit->_mem_readl8 == mem_p32_read8 ) paging_32b_reset ( jit );
   
 } // end IA32_jit_reset
 
@@ -5666,10 +8260,12 @@ IA32_jit_free (
 
   IA32_JIT_Page *p,*q;
   int n;
+  uint32_t i;
 
 
   // Paginador
-  paging_32b_free ( jit->_pag32 );
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    paging_32b_free ( jit->_pag32_v[n] );
   
   // Allibera pàgines
   p= jit->_free_pages;
@@ -5677,25 +8273,36 @@ IA32_jit_free (
     {
       q= p;
       p= p->next;
-      free ( q->entries );
-      free ( q->v );
-      free ( q );
+      free_page ( jit, q );
     }
   p= jit->_pages;
   while ( p != NULL )
     {
       q= p;
       p= p->next;
-      free ( q->entries );
-      free ( q->v );
-      free ( q );
+      free_page ( jit, q );
     }
+  arena_trim ( &(jit->_arena) );
+  assert ( jit->_arena.chunks == NULL );
   for ( n= 0; n < jit->_mem_map_size; ++n )
-    free ( jit->_mem_map[n].map );
+    {
+      for ( i= 0; i < jit->_mem_map[n].map_size; ++i )
+        free ( jit->_mem_map[n].map[i] );
+      free ( jit->_mem_map[n].map );
+    }
   free ( jit->_mem_map );
+  free ( jit->_area_lut );
+  free ( jit->_code_bitmap );
+#ifdef __IA32_JIT_CACHE__
+  cache_free ( jit );
+#endif
 
   // Desessamblar
   free ( jit->_dis_v );
+
+#ifdef __IA32_JIT_PROFILE__
+  free ( jit->_prof );
+#endif
   
   free ( jit );
   
@@ -5716,59 +8323,76 @@ IA32_jit_clear_areas (
   for ( area= 0; area < jit->_mem_map_size; ++area )
     {
       mem_map= &(jit->_mem_map[area]);
-      page_e= (mem_map->last_addr-mem_map->first_addr)>>jit->_bits_page;
+      page_e= (mem_map->last_addr-mem_map->first_addr)>>mem_map->bits_page;
       for ( page= 0; page <= page_e; ++page )
-        if ( mem_map->map[page] != NULL )
+        if ( mem_map->map[page>>MAP_LEAF_BITS] == NULL )
+          page|= MAP_LEAF_MASK; // Fulla buida
+        else if ( map_get ( mem_map, page ) != NULL )
           remove_page ( jit, area, page );
     }
   
 } // end IA32_jit_clear_areas
 
 
+void
+IA32_jit_set_max_bytes (
+                        IA32_JIT     *jit,
+                        const size_t  max_bytes
+                        )
+{
+  jit->_max_bytes= max_bytes == 0 ? SIZE_MAX : max_bytes;
+} // end IA32_jit_set_max_bytes
+
+
+size_t
+IA32_jit_get_bytes (
+                    IA32_JIT *jit
+                    )
+{
+  return jit->_bytes;
+} // end IA32_jit_get_bytes
+
+
+void
+IA32_jit_trim (
+               IA32_JIT *jit
+               )
+{
+  free_free_pages ( jit, 0 );
+  arena_trim ( &(jit->_arena) );
+} // end IA32_jit_trim
+
+
+#ifdef __IA32_JIT_CACHE__
+bool
+IA32_jit_cache_save (
+                     IA32_JIT   *jit,
+                     const char *file_name
+                     )
+{
+  return cache_save ( jit, file_name );
+} // end IA32_jit_cache_save
+
+
+bool
+IA32_jit_cache_load (
+                     IA32_JIT   *jit,
+                     const char *file_name
+                     )
+{
+  return cache_load ( jit, file_name );
+} // end IA32_jit_cache_load
+#endif
+
+
 bool
 IA32_jit_addr_changed (
                        IA32_JIT       *jit,
                        const uint32_t  addr
                        )
 {
-
-  bool ret;
-  int area;
-  uint32_t page,inst;
-  IA32_JIT_Page *p,*q;
-  
-
-  ret= false;
-  
-  for ( area= 0;
-        area < jit->_mem_map_size &&
-          (addr < jit->_mem_map[area].first_addr ||
-           addr > jit->_mem_map[area].last_addr);
-        ++area );
-  if ( area != jit->_mem_map_size )
-    {
-      page= (addr-jit->_mem_map[area].first_addr)>>jit->_bits_page;
-      p= jit->_mem_map[area].map[page];
-      if ( p != NULL )
-        {
-          inst= (addr)&(jit->_page_low_mask);
-          // Elimina la pàgina anterior si té overlapping en eixa zona
-          if ( page > 0 &&
-               inst < 16 &&
-               (q= jit->_mem_map[area].map[page-1])!=NULL &&
-               inst < (uint32_t) (q->overlap_next_page) )
-            remove_page ( jit, area, page-1 );
-          // Elimina pàgina actual si la zona està desensamblada
-          if ( p->entries[inst].ind != NULL_ENTRY )
-            {
-              remove_page ( jit, area, page );
-              ret= true;
-            }
-        }
-    }
-
-  return ret;
-  
+  paging_32b_addr_changed ( jit, (uint64_t) addr );
+  return IS_CODE_FRAME(addr) ? addr_changed ( jit, addr ) : false;
 } // end IA32_jit_addr_changed
 
 
@@ -5792,24 +8416,26 @@ IA32_jit_area_remapped (
       {
 
         // Pàgines dins d'esta àrea
-        page_b= (tmp_b-jit->_mem_map[area].first_addr)>>jit->_bits_page;
+        page_b= (tmp_b-jit->_mem_map[area].first_addr)>>jit->_mem_map[area].bits_page;
         if ( last > jit->_mem_map[area].last_addr )
           page_e= (jit->_mem_map[area].last_addr-
-                   jit->_mem_map[area].first_addr)>>jit->_bits_page;
+                   jit->_mem_map[area].first_addr)>>jit->_mem_map[area].bits_page;
         else
-          page_e= (last-jit->_mem_map[area].first_addr)>>jit->_bits_page;
+          page_e= (last-jit->_mem_map[area].first_addr)>>jit->_mem_map[area].bits_page;
         
         // Elimina pàgina anterior si hi ha overlapping
-        inst_b= (tmp_b)&(jit->_page_low_mask);
+        inst_b= (tmp_b)&(jit->_mem_map[area].page_low_mask);
         if ( page_b > 0 &&
              inst_b < 16 &&
-             (p= jit->_mem_map[area].map[page_b-1])!=NULL &&
+             (p= map_get ( &(jit->_mem_map[area]), page_b-1 ))!=NULL &&
              inst_b < (uint32_t) (p->overlap_next_page) )
           remove_page ( jit, area, page_b-1 );
         
         // Elimina totes les pàgines en el rang
         for ( i= page_b; i <= page_e; ++i )
-          if ( jit->_mem_map[area].map[i] != NULL )
+          if ( jit->_mem_map[area].map[i>>MAP_LEAF_BITS] == NULL )
+            i|= MAP_LEAF_MASK; // Fulla buida
+          else if ( map_get ( &(jit->_mem_map[area]), i ) != NULL )
             remove_page ( jit, area, i );
         
         // Fica tmp_b al primer element de la següent pàgina
@@ -5817,6 +8443,11 @@ IA32_jit_area_remapped (
           tmp_b= jit->_mem_map[area+1].first_addr;
         
       }
+
+  // Els punters de l'amfitrió del TLB i les taules de pàgines poden
+  // haver canviat.
+  paging_32b_tlb_flush_all ( jit );
+  paging_32b_area_remapped ( jit, begin, last );
   
 } // end IA32_jit_area_remapped
 
@@ -5828,14 +8459,14 @@ IA32_jit_exec_next_inst (
 {
   
   uint8_t ivec;
+  IA32_RunExit reason;
   
   
   if ( !jit->_intr ||
        jit->_inhibit_interrupt ||
        (EFLAGS&IF_FLAG) == 0 )
     {
-      jit->_inhibit_interrupt= false;
-      exec_inst ( jit );
+      if ( !jit->_halted ) exec_inst ( jit, 1, &reason );
     }
   else
     {
@@ -5854,6 +8485,77 @@ IA32_jit_exec_next_inst (
 } // end IA32_jit_exec_next_inst
 
 
+int
+IA32_jit_run (
+              IA32_JIT     *jit,
+              const int     budget,
+              IA32_RunExit *reason
+              )
+{
+
+  // Serveix la interrupció pendent si és el cas.
+  if ( jit->_intr &&
+       !jit->_inhibit_interrupt &&
+       (EFLAGS&IF_FLAG) != 0 )
+    {
+      IA32_jit_exec_next_inst ( jit );
+      if ( jit->_intr && (EFLAGS&IF_FLAG) != 0 )
+        {
+          *reason= IA32_RUN_INTR;
+          return 0;
+        }
+    }
+  // Mentre està aturada no s'executa (ni es compta) res.
+  if ( jit->_halted )
+    {
+      *reason= IA32_RUN_HALT;
+      return 0;
+    }
+  if ( budget <= 0 )
+    {
+      *reason= IA32_RUN_BUDGET;
+      return 0;
+    }
+  
+  return exec_inst ( jit, budget, reason );
+  
+} // end IA32_jit_run
+
+
+void
+IA32_jit_stop (
+               IA32_JIT *jit
+               )
+{
+  jit->_stop= true;
+} // end IA32_jit_stop
+
+
+#ifdef __IA32_JIT_PROFILE__
+void
+IA32_jit_profile_dump (
+                       IA32_JIT *jit,
+                       FILE     *f
+                       )
+{
+
+  int prev,next;
+  uint64_t count;
+  
+  
+  for ( prev= 0; prev <= BC_NUM; ++prev )
+    for ( next= 0; next < BC_NUM; ++next )
+      {
+        count= jit->_prof[prev*BC_NUM+next];
+        if ( count != 0 )
+          fprintf ( f, "%d %d %llu\n", prev==BC_NUM ? -1 : prev, next,
+                    (unsigned long long) count );
+      }
+  
+} // end IA32_jit_profile_dump
+#endif
+
+
 void
 IA32_jit_set_intr (
                    IA32_JIT   *jit,
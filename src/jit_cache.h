@@ -0,0 +1,1030 @@
+/*
+ * Copyright 2023-2025 Adrià Giménez Pastor.
+ *
+ * This file is part of adriagipas/IA32.
+ *
+ * adriagipas/IA32 is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * adriagipas/IA32 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with adriagipas/IA32.  If not, see <https://www.gnu.org/licenses/>.
+ */
+/*
+ *  jit_cache.h - Conté la part de 'jit.c' que guarda i carrega de
+ *                fitxer les pàgines compilades.
+ *
+ */
+/*
+ * NOTA!! El fitxer és una capçalera seguida de les pàgines. Cada
+ * pàgina és un IA32_JIT_CacheRec seguit de les entrades
+ * [first_entry,last_entry] (posicions i informació) de cada mapa
+ * (mode) que té la pàgina (veure CACHE_REC_MAP), el bytecode, els
+ * reopts, els blocs i les dependències de flags, tot aliniat a 4
+ * bytes. Es llig sencer en memòria i les
+ * pàgines es copien des d'ahí sense modificar mai el buffer (veure
+ * _cache_used). Com el fitxer no és de confiança, cada pàgina porta
+ * una suma de comprovació i, a més, abans d'acceptar-la es comprova
+ * que el bytecode, els enllaços, les entrades i la resta d'índexs no
+ * ixen de la pàgina (veure cache_rec_valid). Els enllaços no es
+ * guarden, es tornen a resoldre. Sols es guarden pàgines que no
+ * depenen de les seues veïnes (flags i superblocs) i sense codi
+ * natiu. Es guarda l'ordre dels bytes de l'amfitrió, un fitxer d'una
+ * màquina amb altre ordre es rebutja.
+ */
+
+#ifdef __IA32_JIT_CACHE__
+
+
+// MACROS
+
+#define CACHE_MAGIC   "IA32JITC"
+#define CACHE_ENDIAN  0x01020304
+#define CACHE_VERSION 4
+
+#define CACHE_ALIGN(X) (((X)+3)&(~((size_t) 3)))
+
+// IA32_JIT_CacheRec.flags
+#define CACHE_REC_SB_COVERED 0x00000001
+#define CACHE_REC_MAP16      0x00000002
+#define CACHE_REC_MAP32      0x00000004
+#define CACHE_REC_MAP(IS32) ((IS32) ? CACHE_REC_MAP32 : CACHE_REC_MAP16)
+#define CACHE_REC_FLAGS      0x00000007
+
+#define CACHE_SUM_INIT 0x811C9DC5
+
+
+// TIPUS
+
+typedef struct
+{
+  char     magic[8];
+  uint32_t endian;
+  uint32_t version;
+  uint32_t opts; // Veure cache_opts
+  uint32_t pages; // Veure cache_pages
+  uint32_t N; // Pàgines
+} cache_header_t;
+
+
+// CONSTANTS
+
+// Nombre d'arguments (uint16_t) que segueixen a cada bytecode. Sols
+// s'utilitza per a recórrer el bytecode d'un fitxer, ha de coincidir
+// amb el que consumeix exec_inst.
+static const uint8_t BC_NARGS[BC_NUM]=
+  {
+    [BC_GOTO_EIP]= 1,
+    [BC_INC_EIP_DEFER]= 1,
+    [BC_WRONG_INST]= 1,
+    [BC_INCIMM_PC_IF_CX_IS_0]= 1,
+    [BC_INCIMM_PC_IF_ECX_IS_0]= 1,
+    [BC_DECIMM_PC_IF_REPE32]= 1,
+    [BC_DECIMM_PC_IF_REPNE32]= 1,
+    [BC_DECIMM_PC_IF_REPE16]= 1,
+    [BC_DECIMM_PC_IF_REPNE16]= 1,
+    [BC_NATIVE]= 4,
+    [BC_LAZY_FLAGS]= 1,
+    [BC_SB_JMP32]= 3,
+    [BC_SB_JMP16]= 3,
+    [BC_SB_BRANCH32]= 5,
+    [BC_SB_BRANCH16]= 5,
+    [BC_SB_GOTO]= 2,
+    [BC_SB_GUARD]= 2,
+    [BC_UNK]= 1,
+    [BC_SET32_IMM_SELECTOR_OFFSET]= 3,
+    [BC_SET32_IMM_OFFSET]= 2,
+    [BC_SET16_IMM_SELECTOR_OFFSET]= 2,
+    [BC_SET16_IMM_OFFSET]= 1,
+    [BC_SET16_IMM_PORT]= 1,
+    [BC_ADD32_IMM_OFFSET]= 2,
+    [BC_ADD16_IMM_OFFSET]= 1,
+    [BC_ADD16_IMM_OFFSET16]= 1,
+    [BC_SET_IMM_COUNT]= 1,
+    [BC_SET32_AD_EFLAGS]= 1,
+    [BC_SET32_SB_EFLAGS]= 1,
+    [BC_SET32_LOP_EFLAGS]= 1,
+    [BC_SET16_AD_EFLAGS]= 1,
+    [BC_SET16_SB_EFLAGS]= 1,
+    [BC_SET16_LOP_EFLAGS]= 1,
+    [BC_SET32_SIMM_RES]= 1,
+    [BC_SET32_SIMM_OP0]= 1,
+    [BC_SET32_SIMM_OP1]= 1,
+    [BC_SET32_IMM32_RES]= 2,
+    [BC_SET32_IMM32_OP0]= 2,
+    [BC_SET32_IMM32_OP1]= 2,
+    [BC_SET16_IMM_RES]= 1,
+    [BC_SET16_IMM_OP0]= 1,
+    [BC_SET16_IMM_OP1]= 1,
+    [BC_SET8_IMM_RES]= 1,
+    [BC_SET8_IMM_OP0]= 1,
+    [BC_SET8_IMM_OP1]= 1,
+    [BC_JMP32_NEAR_REL]= 3,
+    [BC_JMP16_NEAR_REL]= 3,
+    [BC_JMP32_NEAR_REL32]= 4,
+    [BC_BRANCH32]= 4,
+    [BC_BRANCH32_IMM32]= 5,
+    [BC_BRANCH16]= 4,
+    [BC_BRANCH32_A ... BC_BRANCH32_S]= 4,
+    [BC_BRANCH32_IMM32_A ... BC_BRANCH32_IMM32_S]= 5,
+    [BC_BRANCH16_A ... BC_BRANCH16_S]= 4,
+    [BC_CALL32_FAR]= 1,
+    [BC_CALL16_FAR]= 1,
+    [BC_CALL32_NEAR_REL]= 2,
+    [BC_CALL16_NEAR_REL]= 2,
+    [BC_CALL32_NEAR_REL32]= 3,
+    [BC_CALL32_NEAR_RES32]= 1,
+    [BC_CALL16_NEAR_RES16]= 1,
+    [BC_IRET32]= 1,
+    [BC_IRET16]= 1,
+    [BC_MOV32_REG_REG]= 1,
+    [BC_MOV16_REG_REG]= 1,
+    [BC_SET32_IMM32_REG]= 3,
+    [BC_SET16_IMM_REG]= 2,
+    [BC_DS_READ32_REG]= 1,
+    [BC_SS_READ32_REG]= 1,
+    [BC_DS_READ16_REG]= 1,
+    [BC_SS_READ16_REG]= 1,
+    [BC_ADD32_REG_IMM]= 3,
+    [BC_SUB32_REG_IMM]= 3,
+    [BC_AND32_REG_IMM]= 3,
+    [BC_OR32_REG_IMM]= 3,
+    [BC_XOR32_REG_IMM]= 3,
+    [BC_CMP32_REG_IMM]= 3,
+    [BC_TEST32_REG_IMM]= 3,
+    [BC_ADD32_REG_REG]= 1,
+    [BC_SUB32_REG_REG]= 1,
+    [BC_AND32_REG_REG]= 1,
+    [BC_OR32_REG_REG]= 1,
+    [BC_XOR32_REG_REG]= 1,
+    [BC_CMP32_REG_REG]= 1,
+    [BC_TEST32_REG_REG]= 1,
+    [BC_ADD16_REG_IMM]= 2,
+    [BC_SUB16_REG_IMM]= 2,
+    [BC_AND16_REG_IMM]= 2,
+    [BC_OR16_REG_IMM]= 2,
+    [BC_XOR16_REG_IMM]= 2,
+    [BC_CMP16_REG_IMM]= 2,
+    [BC_TEST16_REG_IMM]= 2,
+    [BC_ADD16_REG_REG]= 1,
+    [BC_SUB16_REG_REG]= 1,
+    [BC_AND16_REG_REG]= 1,
+    [BC_OR16_REG_REG]= 1,
+    [BC_XOR16_REG_REG]= 1,
+    [BC_CMP16_REG_REG]= 1,
+    [BC_TEST16_REG_REG]= 1,
+    [BC_DS_READ32_SIB_RES]= 4,
+    [BC_DS_READ32_SIB_OP0]= 4,
+    [BC_DS_READ32_SIB_OP1]= 4,
+    [BC_SS_READ32_SIB_RES]= 4,
+    [BC_SS_READ32_SIB_OP0]= 4,
+    [BC_SS_READ32_SIB_OP1]= 4,
+    [BC_DS_READ32_SIB_REG]= 5,
+    [BC_SS_READ32_SIB_REG]= 5,
+    [BC_ENTER16]= 2,
+    [BC_ENTER32]= 2,
+    [BC_HALT]= 1,
+    [BC_INT16]= 2,
+    [BC_INT32]= 2,
+    [BC_INTO16]= 1,
+    [BC_INTO32]= 1,
+    [BC_RET32_RES_INC_ESP]= 1,
+    [BC_RET32_RES_INC_SP]= 1,
+    [BC_RET16_RES_INC_ESP]= 1,
+    [BC_RET16_RES_INC_SP]= 1,
+    [BC_INC_ESP_AND_GOTO_EIP]= 1,
+    [BC_INC_SP_AND_GOTO_EIP]= 1,
+    [BC_FPU_FREE]= 1,
+    [BC_FPU_REG_ST]= 1,
+    [BC_FPU_SELECT_ST_REG]= 1,
+    [BC_FPU_SELECT_ST_REG2]= 1
+  };
+
+
+// FUNCIONS
+
+// Opcions del JIT que afecten al bytecode generat.
+static uint32_t
+cache_opts (
+            const IA32_JIT *jit
+            )
+{
+
+  uint32_t ret;
+
+
+  ret= ((uint32_t) BC_NUM)<<16;
+  if ( jit->_optimize_flags ) ret|= 0x100;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  ret|= 0x200;
+#endif
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  ret|= 0x400;
+#endif
+
+  return ret;
+
+} // end cache_opts
+
+
+// Resum (FNV-1a) de les àrees i la grandària de pàgina de
+// cadascuna. Les pàgines d'un fitxer sols es poden utilitzar si
+// coincideixen.
+static uint32_t
+cache_pages (
+             const IA32_JIT *jit
+             )
+{
+
+  uint32_t h,v[3];
+  int n,i,j;
+
+
+  h= 0x811C9DC5;
+  for ( n= 0; n < jit->_mem_map_size; ++n )
+    {
+      v[0]= jit->_mem_map[n].first_addr;
+      v[1]= jit->_mem_map[n].last_addr;
+      v[2]= (uint32_t) jit->_mem_map[n].bits_page;
+      for ( i= 0; i < 3; ++i )
+        for ( j= 0; j < 32; j+= 8 )
+          {
+            h^= (v[i]>>j)&0xFF;
+            h*= 0x01000193;
+          }
+    }
+
+  return h;
+
+} // end cache_pages
+
+
+// Hash (FNV-1a) de 'nbytes' bytes de memòria física a partir de
+// 'addr'.
+static void
+cache_hash (
+            IA32_JIT       *jit,
+            const uint32_t  addr,
+            const uint32_t  nbytes,
+            uint32_t        hash[2]
+            )
+{
+
+  uint64_t h;
+  uint32_t i;
+
+
+  h= 0xCBF29CE484222325ULL;
+  for ( i= 0; i < nbytes; ++i )
+    {
+      h^= (uint64_t) jit->mem_read8 ( jit->udata,
+                                      (uint64_t) (uint32_t) (addr+i),
+                                      false );
+      h*= 0x00000100000001B3ULL;
+    }
+  hash[0]= (uint32_t) h;
+  hash[1]= (uint32_t) (h>>32);
+
+} // end cache_hash
+
+
+// Continua la suma (FNV-1a) 'h' amb 'size' bytes de 'data' i
+// 'asize-size' zeros, el mateix que escriu cache_write.
+static uint32_t
+cache_sum (
+           uint32_t      h,
+           const void   *data,
+           const size_t  size,
+           const size_t  asize
+           )
+{
+
+  const uint8_t *mem;
+  size_t i;
+
+
+  mem= (const uint8_t *) data;
+  for ( i= 0; i < size; ++i )
+    {
+      h^= mem[i];
+      h*= 0x01000193;
+    }
+  for ( ; i < asize; ++i )
+    h*= 0x01000193;
+
+  return h;
+
+} // end cache_sum
+
+
+// Bytes que ocupa 'rec' en el fitxer (capçalera inclosa).
+static size_t
+cache_rec_size (
+                const IA32_JIT_CacheRec *rec
+                )
+{
+
+  size_t ne,nmaps;
+
+
+  ne= (size_t) (rec->last_entry-rec->first_entry) + 1;
+  nmaps= ((rec->flags&CACHE_REC_MAP16) ? 1 : 0) +
+    ((rec->flags&CACHE_REC_MAP32) ? 1 : 0);
+
+  return sizeof(IA32_JIT_CacheRec) +
+    nmaps*CACHE_ALIGN ( ne*(sizeof(uint16_t)+1) ) +
+    CACHE_ALIGN ( sizeof(uint16_t)*rec->N ) +
+    sizeof(IA32_JIT_PageReopt)*rec->reopts_N +
+    sizeof(IA32_JIT_PageBlock)*rec->blocks_N +
+    sizeof(IA32_JIT_PageReopt)*rec->flags_deps_N;
+
+} // end cache_rec_size
+
+
+// Comprova que els camps de 'rec' tenen sentit abans de calcular la
+// seua grandària.
+static bool
+cache_rec_ok (
+              const IA32_JIT          *jit,
+              const IA32_JIT_CacheRec *rec
+              )
+{
+
+  int area;
+
+
+  area= find_area ( jit, rec->addr );
+  
+  return
+    area != -1 &&
+    (rec->addr&jit->_mem_map[area].page_low_mask) == 0 &&
+    (rec->flags&~CACHE_REC_FLAGS) == 0 &&
+    (rec->flags&(CACHE_REC_MAP16|CACHE_REC_MAP32)) != 0 &&
+    rec->first_entry <= rec->last_entry &&
+    rec->last_entry <= jit->_mem_map[area].page_low_mask &&
+    rec->overlap < 16 &&
+    rec->N > 2 && rec->N <= MAX_ENTRY_POS+1 &&
+    rec->links_N <= NO_LINK;
+} // end cache_rec_ok
+
+
+// Comprova que els 'N' reopts (o dependències de flags) de 'rec' estan
+// dins de la pàgina i en un mapa que té.
+static bool
+cache_reopts_ok (
+                 const IA32_JIT_CacheRec  *rec,
+                 const IA32_JIT_PageReopt *reopts,
+                 const uint32_t            N,
+                 const uint32_t            mask
+                 )
+{
+
+  uint32_t i;
+
+
+  for ( i= 0; i < N; ++i )
+    if ( reopts[i].succ > mask || reopts[i].first > reopts[i].last ||
+         reopts[i].last > mask || reopts[i].is32 > 1 ||
+         !(rec->flags&CACHE_REC_MAP(reopts[i].is32)) )
+      return false;
+
+  return true;
+
+} // end cache_reopts_ok
+
+
+// Comprova que 'rec' (sencer en memòria) no pot fer que exec_inst
+// isca de la pàgina: el bytecode es pot recórrer amb BC_NARGS, els
+// enllaços són < links_N, els salts interns i les entrades apunten a
+// l'inici d'un bytecode i els reopts, blocs i dependències de flags
+// estan dins de la pàgina. 'start' té espai per a rec->N bytes.
+static bool
+cache_rec_valid (
+                 const IA32_JIT          *jit,
+                 const IA32_JIT_CacheRec *rec,
+                 uint8_t                 *start
+                 )
+{
+
+  const uint8_t *mem;
+  const uint16_t *entries,*v;
+  const IA32_JIT_PageReopt *reopts;
+  const IA32_JIT_PageBlock *blocks;
+  uint32_t n,i,mask,target,l[2];
+  size_t ne;
+  uint16_t bc;
+  int is32,nl;
+
+
+  mask= jit->_mem_map[find_area ( jit, rec->addr )].page_low_mask;
+  ne= (size_t) (rec->last_entry-rec->first_entry) + 1;
+  mem= (const uint8_t *) (rec+1);
+  for ( is32= 0; is32 < 2; ++is32 )
+    if ( rec->flags&CACHE_REC_MAP(is32) )
+      mem+= CACHE_ALIGN ( ne*(sizeof(uint16_t)+1) );
+  v= (const uint16_t *) mem;
+  
+  // Bytecode i enllaços.
+  memset ( start, 0, rec->N );
+  bc= BC_NUM;
+  for ( n= 2; n < rec->N; n+= 1+BC_NARGS[bc] )
+    {
+      bc= v[n];
+      if ( bc >= BC_NUM || bc == BC_NATIVE || n+BC_NARGS[bc] >= rec->N )
+        return false;
+      start[n]= 1;
+      nl= 0;
+      switch ( bc )
+        {
+        case BC_GOTO_EIP: l[nl++]= v[n+1]; break;
+        case BC_JMP32_NEAR_REL:
+        case BC_JMP16_NEAR_REL:
+          l[nl++]= v[n+3];
+          break;
+        case BC_JMP32_NEAR_REL32:
+        case BC_SB_BRANCH32:
+        case BC_SB_BRANCH16:
+          l[nl++]= v[n+4];
+          break;
+        case BC_BRANCH32:
+        case BC_BRANCH16:
+        case BC_BRANCH32_A ... BC_BRANCH32_S:
+        case BC_BRANCH16_A ... BC_BRANCH16_S:
+          l[nl++]= v[n+3]; l[nl++]= v[n+4];
+          break;
+        case BC_BRANCH32_IMM32:
+        case BC_BRANCH32_IMM32_A ... BC_BRANCH32_IMM32_S:
+          l[nl++]= v[n+4]; l[nl++]= v[n+5];
+          break;
+        case BC_INC1_EIP_GOTO ... BC_INC14_EIP_GOTO:
+          // Utilitza l'enllaç del BC_GOTO_EIP següent.
+          if ( n+1 >= rec->N || v[n+1] != BC_GOTO_EIP ) return false;
+          break;
+        default: break;
+        }
+      while ( nl > 0 )
+        if ( l[--nl] >= rec->links_N && l[nl] != NO_LINK )
+          return false;
+    }
+
+  // L'últim bytecode no pot continuar (ni reprendre) en el següent.
+  switch ( bc )
+    {
+    case BC_GOTO_EIP:
+    case BC_WRONG_INST:
+    case BC_SB_GOTO:
+    case BC_UNK:
+    case BC_JMP32_FAR ... BC_IRET16:
+    case BC_HALT ... BC_INTO32:
+    case BC_RET32_FAR:
+    case BC_RET16_FAR:
+    case BC_RET32_RES ... BC_INC_SP_AND_GOTO_EIP:
+      break;
+    default: return false;
+    }
+
+  // Salts dins de la pàgina.
+  for ( n= 2; n < rec->N; n+= 1+BC_NARGS[v[n]] )
+    {
+      switch ( v[n] )
+        {
+        case BC_INC2_PC_IF_ECX_IS_0:
+        case BC_INC2_PC_IF_CX_IS_0:
+          target= n+3;
+          break;
+        case BC_INC4_PC_IF_ECX_IS_0:
+        case BC_INC4_PC_IF_CX_IS_0:
+          target= n+5;
+          break;
+        case BC_INCIMM_PC_IF_CX_IS_0:
+        case BC_INCIMM_PC_IF_ECX_IS_0:
+          target= n+2+v[n+1];
+          break;
+        case BC_DEC1_PC_IF_REP32:
+        case BC_DEC1_PC_IF_REP16:
+          target= n-1;
+          break;
+        case BC_DEC3_PC_IF_REP32:
+        case BC_DEC3_PC_IF_REP16:
+          target= n-3;
+          break;
+        case BC_DECIMM_PC_IF_REPE32:
+        case BC_DECIMM_PC_IF_REPNE32:
+        case BC_DECIMM_PC_IF_REPE16:
+        case BC_DECIMM_PC_IF_REPNE16:
+          target= n-v[n+1];
+          break;
+        case BC_SB_GOTO:
+          target= ((uint32_t) v[n+1]) | (((uint32_t) v[n+2])<<16);
+          break;
+        default: continue;
+        }
+      if ( target >= rec->N || !start[target] ) return false;
+    }
+
+  // Entrades.
+  mem= (const uint8_t *) (rec+1);
+  for ( is32= 0; is32 < 2; ++is32 )
+    if ( rec->flags&CACHE_REC_MAP(is32) )
+      {
+        entries= (const uint16_t *) mem;
+        for ( i= 0; i < ne; ++i )
+          if ( entries[i] != NULL_ENTRY && entries[i] != PAD_ENTRY &&
+               (entries[i] >= rec->N || !start[entries[i]]) )
+            return false;
+        mem+= CACHE_ALIGN ( ne*(sizeof(uint16_t)+1) );
+      }
+
+  // Reopts, blocs i dependències de flags.
+  mem= (const uint8_t *) v + CACHE_ALIGN ( sizeof(uint16_t)*rec->N );
+  reopts= (const IA32_JIT_PageReopt *) mem;
+  if ( !cache_reopts_ok ( rec, reopts, rec->reopts_N, mask ) ) return false;
+  blocks= (const IA32_JIT_PageBlock *) (reopts+rec->reopts_N);
+  for ( i= 0; i < rec->blocks_N; ++i )
+    if ( blocks[i].first > blocks[i].last ||
+         blocks[i].last > mask || blocks[i].is32 > 1 ||
+         !(rec->flags&CACHE_REC_MAP(blocks[i].is32)) )
+      return false;
+  reopts= (const IA32_JIT_PageReopt *) (blocks+rec->blocks_N);
+
+  return cache_reopts_ok ( rec, reopts, rec->flags_deps_N, mask );
+
+} // end cache_rec_valid
+
+
+static int
+cache_rec_cmp (
+               const void *a,
+               const void *b
+               )
+{
+
+  const IA32_JIT_CacheRec *ra,*rb;
+
+
+  ra= *((const IA32_JIT_CacheRec * const *) a);
+  rb= *((const IA32_JIT_CacheRec * const *) b);
+
+  return ra->addr < rb->addr ? -1 : (ra->addr > rb->addr ? 1 : 0);
+
+} // end cache_rec_cmp
+
+
+// Índex en _cache_recs de la pàgina amb adreça física 'addr', -1 si
+// no n'hi ha.
+static int32_t
+cache_find (
+            const IA32_JIT *jit,
+            const uint32_t  addr
+            )
+{
+
+  uint32_t beg,end,mid;
+  const IA32_JIT_CacheRec *rec;
+
+
+  beg= 0; end= jit->_cache_N;
+  while ( beg < end )
+    {
+      mid= beg + (end-beg)/2;
+      rec= jit->_cache_recs[mid];
+      if ( rec->addr == addr ) return (int32_t) mid;
+      else if ( rec->addr < addr ) beg= mid+1;
+      else end= mid;
+    }
+
+  return -1;
+
+} // end cache_find
+
+
+static void
+cache_free (
+            IA32_JIT *jit
+            )
+{
+
+  free ( jit->_cache );
+  free ( jit->_cache_recs );
+  free ( jit->_cache_used );
+  jit->_cache= NULL;
+  jit->_cache_recs= NULL;
+  jit->_cache_used= NULL;
+  jit->_cache_N= 0;
+
+} // end cache_free
+
+
+// Si la cache té la pàgina 'p' (acabada de crear) i els bytes no han
+// canviat, la copia en 'p'. Cada pàgina de la cache s'intenta
+// utilitzar sols una vegada, si després s'esborra es compila de nou.
+static void
+cache_fill_page (
+                 IA32_JIT      *jit,
+                 IA32_JIT_Page *p
+                 )
+{
+
+  const IA32_JIT_CacheRec *rec;
+  const uint8_t *mem;
+  uint32_t addr,hash[2],n;
+  int32_t ind;
+  size_t ne,size;
+  int is32;
+
+
+  // Busca.
+  addr= jit->_mem_map[p->area_id].first_addr +
+    (p->page_id<<jit->_mem_map[p->area_id].bits_page);
+  ind= cache_find ( jit, addr );
+  if ( ind == -1 || jit->_cache_used[ind] ) return;
+  jit->_cache_used[ind]= true;
+  rec= jit->_cache_recs[ind];
+  cache_hash ( jit, addr, PAGE_LOW_MASK(p)+1+rec->overlap, hash );
+  if ( hash[0] != rec->hash[0] || hash[1] != rec->hash[1] ) return;
+
+  // Entrades.
+  mem= (const uint8_t *) (rec+1);
+  ne= (size_t) (rec->last_entry-rec->first_entry) + 1;
+  for ( is32= 0; is32 < 2; ++is32 )
+    if ( rec->flags&CACHE_REC_MAP(is32) )
+      {
+        alloc_entries ( jit, p, is32 );
+        memcpy ( &(p->entries[is32][rec->first_entry]), mem,
+                 sizeof(uint16_t)*ne );
+        memcpy ( &(p->entries_info[is32][rec->first_entry]),
+                 mem + sizeof(uint16_t)*ne, ne );
+        mem+= CACHE_ALIGN ( ne*(sizeof(uint16_t)+1) );
+      }
+  p->first_entry= rec->first_entry;
+  p->last_entry= rec->last_entry;
+  p->overlap_next_page= (int) rec->overlap;
+  if ( rec->overlap > 0 && !jit->_mem_map[p->area_id].rom )
+    mark_code_frames ( jit, addr + PAGE_LOW_MASK(p) + 1,
+                       addr + PAGE_LOW_MASK(p) + rec->overlap );
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  p->sb_covered= (rec->flags&CACHE_REC_SB_COVERED)!=0;
+#endif
+
+  // Bytecode.
+  if ( p->capacity < rec->N )
+    {
+      arena_free ( p->arena, p->v, sizeof(uint16_t)*p->capacity );
+      p->v= (uint16_t *) arena_alloc ( p->arena,
+                                       sizeof(uint16_t)*rec->N, &size );
+      p->capacity= (uint32_t) (size/sizeof(uint16_t));
+    }
+  memcpy ( p->v, mem, sizeof(uint16_t)*rec->N );
+  p->N= rec->N;
+  mem+= CACHE_ALIGN ( sizeof(uint16_t)*rec->N );
+
+  // Enllaços (sense resoldre).
+  if ( p->links_capacity < rec->links_N )
+    {
+      p->links= (IA32_JIT_PageLink *)
+        realloc__ ( p->links, sizeof(IA32_JIT_PageLink)*rec->links_N );
+      p->links_capacity= rec->links_N;
+    }
+  for ( n= 0; n < rec->links_N; ++n )
+    p->links[n].gen= 0;
+  p->links_N= rec->links_N;
+
+  // Reopts.
+  if ( p->reopts_capacity < rec->reopts_N )
+    {
+      p->reopts= (IA32_JIT_PageReopt *)
+        realloc__ ( p->reopts, sizeof(IA32_JIT_PageReopt)*rec->reopts_N );
+      p->reopts_capacity= rec->reopts_N;
+    }
+  memcpy ( p->reopts, mem, sizeof(IA32_JIT_PageReopt)*rec->reopts_N );
+  p->reopts_N= rec->reopts_N;
+  mem+= sizeof(IA32_JIT_PageReopt)*rec->reopts_N;
+
+  // Blocs.
+  if ( p->blocks_capacity < rec->blocks_N )
+    {
+      p->blocks= (IA32_JIT_PageBlock *)
+        realloc__ ( p->blocks, sizeof(IA32_JIT_PageBlock)*rec->blocks_N );
+      p->blocks_capacity= rec->blocks_N;
+    }
+  memcpy ( p->blocks, mem, sizeof(IA32_JIT_PageBlock)*rec->blocks_N );
+  p->blocks_N= rec->blocks_N;
+  mem+= sizeof(IA32_JIT_PageBlock)*rec->blocks_N;
+
+  // Dependències de flags.
+  if ( p->flags_deps_capacity < rec->flags_deps_N )
+    {
+      p->flags_deps= (IA32_JIT_PageReopt *)
+        realloc__ ( p->flags_deps,
+                    sizeof(IA32_JIT_PageReopt)*rec->flags_deps_N );
+      p->flags_deps_capacity= rec->flags_deps_N;
+    }
+  memcpy ( p->flags_deps, mem,
+           sizeof(IA32_JIT_PageReopt)*rec->flags_deps_N );
+  p->flags_deps_N= rec->flags_deps_N;
+
+  update_page_bytes ( jit, p );
+
+} // end cache_fill_page
+
+
+// Escriu 'size' bytes i completa amb zeros fins a 'asize'.
+static bool
+cache_write (
+             FILE         *f,
+             const void   *data,
+             const size_t  size,
+             const size_t  asize
+             )
+{
+
+  static const uint8_t zeros[4]= {0,0,0,0};
+
+
+  if ( size > 0 && fwrite ( data, size, 1, f ) != 1 ) return false;
+  if ( asize > size && fwrite ( zeros, asize-size, 1, f ) != 1 )
+    return false;
+
+  return true;
+
+} // end cache_write
+
+
+// Torna cert si 'p' es pot guardar en la cache.
+static bool
+cache_page_ok (
+               const IA32_JIT_Page *p
+               )
+{
+
+  if ( p->N <= 2 || p->flags_dep_prev || p->flags_dep_next ) return false;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  if ( p->sb_dep_next ) return false;
+#endif
+#ifdef IA32_JIT_NATIVE
+  if ( p->native_N > 0 ) return false;
+#endif
+
+  return true;
+
+} // end cache_page_ok
+
+
+static bool
+cache_save_page (
+                 IA32_JIT            *jit,
+                 FILE                *f,
+                 const IA32_JIT_Page *p
+                 )
+{
+
+  IA32_JIT_CacheRec rec;
+  const void *data[9];
+  size_t ne,size[9],asize[9];
+  int is32,n,i;
+  bool ret;
+
+
+  rec.addr= jit->_mem_map[p->area_id].first_addr +
+    (p->page_id<<jit->_mem_map[p->area_id].bits_page);
+  rec.flags= 0;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  if ( p->sb_covered ) rec.flags|= CACHE_REC_SB_COVERED;
+#endif
+  for ( is32= 0; is32 < 2; ++is32 )
+    if ( p->entries[is32] != NULL ) rec.flags|= CACHE_REC_MAP(is32);
+  rec.overlap= (uint32_t) p->overlap_next_page;
+  rec.first_entry= p->first_entry;
+  rec.last_entry= p->last_entry;
+  rec.N= p->N;
+  rec.links_N= p->links_N;
+  rec.reopts_N= p->reopts_N;
+  rec.blocks_N= p->blocks_N;
+  rec.flags_deps_N= p->flags_deps_N;
+  cache_hash ( jit, rec.addr, PAGE_LOW_MASK(p)+1+rec.overlap, rec.hash );
+  ne= (size_t) (rec.last_entry-rec.first_entry) + 1;
+
+  // Parts del registre. La capçalera sense 'sum', que és el primer
+  // camp i tots són uint32_t.
+  n= 0;
+  data[n]= &(rec.addr);
+  size[n]= asize[n]= sizeof(rec)-sizeof(rec.sum); ++n;
+  for ( is32= 0; is32 < 2; ++is32 )
+    if ( p->entries[is32] != NULL )
+      {
+        data[n]= &(p->entries[is32][rec.first_entry]);
+        size[n]= asize[n]= sizeof(uint16_t)*ne; ++n;
+        data[n]= &(p->entries_info[is32][rec.first_entry]);
+        size[n]= ne;
+        asize[n]= CACHE_ALIGN ( ne*(sizeof(uint16_t)+1) ) -
+          sizeof(uint16_t)*ne;
+        ++n;
+      }
+  data[n]= p->v;
+  size[n]= sizeof(uint16_t)*p->N;
+  asize[n]= CACHE_ALIGN ( sizeof(uint16_t)*p->N ); ++n;
+  data[n]= p->reopts;
+  size[n]= asize[n]= sizeof(IA32_JIT_PageReopt)*p->reopts_N; ++n;
+  data[n]= p->blocks;
+  size[n]= asize[n]= sizeof(IA32_JIT_PageBlock)*p->blocks_N; ++n;
+  data[n]= p->flags_deps;
+  size[n]= asize[n]= sizeof(IA32_JIT_PageReopt)*p->flags_deps_N; ++n;
+
+  // Suma i escriu.
+  rec.sum= CACHE_SUM_INIT;
+  for ( i= 0; i < n; ++i )
+    rec.sum= cache_sum ( rec.sum, data[i], size[i], asize[i] );
+  ret= cache_write ( f, &(rec.sum), sizeof(rec.sum), sizeof(rec.sum) );
+  for ( i= 0; i < n && ret; ++i )
+    ret= cache_write ( f, data[i], size[i], asize[i] );
+  
+  return ret;
+
+} // end cache_save_page
+
+
+// Guarda les pàgines compilades i les de la cache carregada que no
+// s'han utilitzat (no hi ha pàgina compilada en eixa adreça).
+static bool
+cache_save (
+            IA32_JIT   *jit,
+            const char *file_name
+            )
+{
+
+  FILE *f;
+  cache_header_t h;
+  const IA32_JIT_Page *p;
+  const IA32_JIT_CacheRec *rec;
+  uint32_t n;
+  int area;
+  bool ret;
+
+
+  f= fopen ( file_name, "wb" );
+  if ( f == NULL ) return false;
+
+  // Capçalera. El nombre de pàgines s'actualitza al final.
+  memcpy ( h.magic, CACHE_MAGIC, sizeof(h.magic) );
+  h.endian= CACHE_ENDIAN;
+  h.version= CACHE_VERSION;
+  h.opts= cache_opts ( jit );
+  h.pages= cache_pages ( jit );
+  h.N= 0;
+  ret= cache_write ( f, &h, sizeof(h), sizeof(h) );
+
+  // Pàgines.
+  for ( p= jit->_pages; p != NULL && ret; p= p->next )
+    if ( cache_page_ok ( p ) )
+      {
+        ret= cache_save_page ( jit, f, p );
+        ++h.N;
+      }
+  for ( n= 0; n < jit->_cache_N && ret; ++n )
+    {
+      if ( jit->_cache_used[n] ) continue;
+      rec= jit->_cache_recs[n];
+      area= find_area ( jit, rec->addr );
+      if ( area != -1 &&
+           map_get ( &(jit->_mem_map[area]),
+                     (rec->addr-jit->_mem_map[area].first_addr)>>
+                     jit->_mem_map[area].bits_page ) != NULL )
+        continue;
+      ret= cache_write ( f, rec, cache_rec_size ( rec ),
+                         cache_rec_size ( rec ) );
+      ++h.N;
+    }
+
+  // Actualitza capçalera.
+  if ( ret )
+    ret= fseek ( f, 0, SEEK_SET ) == 0 &&
+      cache_write ( f, &h, sizeof(h), sizeof(h) );
+  if ( fclose ( f ) != 0 ) ret= false;
+
+  return ret;
+
+} // end cache_save
+
+
+// Comprova el contingut del fitxer i crea l'índex de pàgines en
+// 'recs'. No modifica 'buf'.
+static bool
+cache_parse (
+             const IA32_JIT           *jit,
+             const uint8_t            *buf,
+             const size_t              size,
+             const IA32_JIT_CacheRec **recs
+             )
+{
+
+  const cache_header_t *h;
+  const IA32_JIT_CacheRec *rec;
+  uint8_t *start;
+  size_t off,rsize;
+  uint32_t n;
+  bool ret;
+
+
+  h= (const cache_header_t *) buf;
+  if ( memcmp ( h->magic, CACHE_MAGIC, sizeof(h->magic) ) != 0 ||
+       h->endian != CACHE_ENDIAN ||
+       h->version != CACHE_VERSION ||
+       h->opts != cache_opts ( jit ) ||
+       h->pages != cache_pages ( jit ) )
+    return false;
+  start= (uint8_t *) malloc__ ( MAX_ENTRY_POS+1 );
+  off= sizeof(cache_header_t);
+  ret= true;
+  for ( n= 0; n < h->N && ret; ++n )
+    {
+      rec= (const IA32_JIT_CacheRec *) (buf+off);
+      if ( size-off < sizeof(IA32_JIT_CacheRec) ||
+           !cache_rec_ok ( jit, rec ) ||
+           size-off < (rsize= cache_rec_size ( rec )) ||
+           cache_sum ( CACHE_SUM_INIT, &(rec->addr),
+                       rsize-sizeof(rec->sum),
+                       rsize-sizeof(rec->sum) ) != rec->sum ||
+           !cache_rec_valid ( jit, rec, start ) )
+        ret= false;
+      else
+        {
+          recs[n]= rec;
+          off+= rsize;
+        }
+    }
+  free ( start );
+
+  return ret;
+
+} // end cache_parse
+
+
+static bool
+cache_load (
+            IA32_JIT   *jit,
+            const char *file_name
+            )
+{
+
+  FILE *f;
+  long size;
+  uint8_t *buf;
+  const IA32_JIT_CacheRec **recs;
+  uint32_t N,n;
+
+
+  cache_free ( jit );
+
+  // Llig el fitxer.
+  f= fopen ( file_name, "rb" );
+  if ( f == NULL ) return false;
+  if ( fseek ( f, 0, SEEK_END ) != 0 ||
+       (size= ftell ( f )) < (long) sizeof(cache_header_t) ||
+       fseek ( f, 0, SEEK_SET ) != 0 )
+    {
+      fclose ( f );
+      return false;
+    }
+  buf= (uint8_t *) malloc__ ( (size_t) size );
+  if ( fread ( buf, (size_t) size, 1, f ) != 1 )
+    {
+      free ( buf );
+      fclose ( f );
+      return false;
+    }
+  fclose ( f );
+
+  // Índex.
+  N= ((const cache_header_t *) buf)->N;
+  if ( (size_t) N > (size_t) size/sizeof(IA32_JIT_CacheRec) )
+    {
+      free ( buf );
+      return false;
+    }
+  recs= (const IA32_JIT_CacheRec **)
+    malloc__ ( sizeof(IA32_JIT_CacheRec *)*(N > 0 ? N : 1) );
+  if ( !cache_parse ( jit, buf, (size_t) size, recs ) )
+    {
+      free ( recs );
+      free ( buf );
+      return false;
+    }
+  qsort ( recs, N, sizeof(IA32_JIT_CacheRec *), cache_rec_cmp );
+  jit->_cache= buf;
+  jit->_cache_recs= recs;
+  jit->_cache_used= (bool *) malloc__ ( sizeof(bool)*(N > 0 ? N : 1) );
+  for ( n= 0; n < N; ++n )
+    jit->_cache_used[n]= false;
+  jit->_cache_N= N;
+
+  return true;
+
+} // end cache_load
+
+#endif // __IA32_JIT_CACHE__
@@ -48,24 +48,63 @@ add_word (
 {
 
   uint32_t tmp;
-
+  uint16_t *v;
+  size_t size;
+  
   
   if ( p->N == p->capacity )
     {
-      tmp= p->capacity*2;
+      // Dins de l'arena n'hi ha prou amb demanar una paraula més per a
+      // passar a la següent classe. Fora es dobla.
+      if ( p->capacity*sizeof(uint16_t) < ARENA_MAX_BYTES )
+        tmp= p->capacity+1;
+      else tmp= p->capacity*2;
       if ( tmp < p->capacity )
         {
           fprintf ( stderr, "cannot allocate memory\n" );
           exit ( EXIT_FAILURE );
         }
-      p->v= (uint16_t *) realloc__ ( p->v, tmp*sizeof(uint16_t) );
-      p->capacity= tmp;
+      v= (uint16_t *) arena_alloc ( p->arena, tmp*sizeof(uint16_t), &size );
+      memcpy ( v, p->v, p->N*sizeof(uint16_t) );
+      arena_free ( p->arena, p->v, p->capacity*sizeof(uint16_t) );
+      p->v= v;
+      p->capacity= (uint32_t) (size/sizeof(uint16_t));
     }
   p->v[p->N++]= word;
   
 } // end add_word
 
 
+// Reserva un slot d'enllaç i afegeix el seu índex. Si no queden
+// slots lliures s'afegeix NO_LINK.
+static void
+add_link (
+          IA32_JIT_Page *p
+          )
+{
+
+  uint32_t tmp;
+
+  
+  if ( p->links_N == NO_LINK )
+    {
+      add_word ( p, NO_LINK );
+      return;
+    }
+  if ( p->links_N == p->links_capacity )
+    {
+      tmp= p->links_capacity*2;
+      p->links= (IA32_JIT_PageLink *) realloc__ ( p->links,
+                                                  tmp*sizeof(IA32_JIT_PageLink) );
+      p->links_capacity= tmp;
+    }
+  p->links[p->links_N].gen= 0;
+  add_word ( p, (uint16_t) p->links_N );
+  ++(p->links_N);
+  
+} // end add_link
+
+
 // Torna cert si ho ha processat
 static void
 update_eip (
@@ -75,6 +114,12 @@ update_eip (
             )
 {
 
+  if ( stop && e->defer_eip )
+    {
+      add_word ( p, BC_INC_EIP_DEFER );
+      add_word ( p, (uint16_t) e->inst.real_nbytes );
+      return;
+    }
   switch ( e->inst.real_nbytes )
     {
     case 1: add_word ( p, BC_INC1_EIP ); break;
@@ -101,6 +146,30 @@ update_eip (
 } // end update_eip
 
 
+// Afegeix un bytecode de flags fusionat seguit de la màscara dels
+// flags a actualitzar. Sols val la pena si hi ha més d'un flag (o
+// sempre amb __IA32_JIT_LAZY_FLAGS__), torna cert si l'ha afegit.
+static bool
+add_fused_flags (
+                 IA32_JIT_Page  *p,
+                 const uint16_t  bc,
+                 const uint16_t  mask
+                 )
+{
+
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  if ( mask == 0 ) return false;
+#else
+  if ( (mask&(mask-1)) == 0 ) return false;
+#endif
+  add_word ( p, bc );
+  add_word ( p, mask );
+  
+  return true;
+  
+} // end add_fused_flags
+
+
 static void
 compile_set_count (
                    const IA32_JIT_DisEntry *e,
@@ -491,6 +560,83 @@ compile_get_rm32_read_mem (
 } // end compile_get_rm32_read_mem
 
 
+// Cert si l'operador 'op' és una adreça SIB en DS o SS, que es
+// calcula i es llig amb un únic bytecode (BC_*_READ32_SIB_*).
+static bool
+sib_read_fusable (
+                  const IA32_JIT_DisEntry *e,
+                  const int                op
+                  )
+{
+
+  switch ( e->inst.ops[op].type )
+    {
+    case IA32_ADDR32_SIB:
+    case IA32_ADDR32_SIB_DISP8:
+    case IA32_ADDR32_SIB_DISP32:
+      return e->inst.ops[op].data_seg == IA32_DS ||
+        e->inst.ops[op].data_seg == IA32_SS;
+    default: return false;
+    }
+  
+} // end sib_read_fusable
+
+
+// Equivalent a compile_get_addr+compile_get_rm32_read_mem per a
+// adreces SIB (veure sib_read_fusable). Els registres es codifiquen
+// amb el desplaçament en IA32_CPU i tots els desplaçaments immediats
+// se sumen en un.
+static void
+compile_get_rm32_sib_read (
+                           const IA32_JIT_DisEntry *e,
+                           IA32_JIT_Page           *p,
+                           const int                op,
+                           const bool               use_res
+                           )
+{
+
+  uint16_t base,index,shift;
+  uint32_t disp;
+  int val,scale;
+  
+  
+  // Base. IA32_SIB_VAL_DISP32 està entre ESP i EBP.
+  val= e->inst.ops[op].sib_val;
+  disp= 0;
+  if ( val == IA32_SIB_VAL_DISP32 )
+    {
+      base= SIB_NOREG;
+      disp= e->inst.ops[op].sib_u32;
+    }
+  else base= REG32_OFF[val < IA32_SIB_VAL_DISP32 ? val : val-1];
+  
+  // Índex. Per cada escala van EAX,ECX,EDX,EBX,EBP,ESI,EDI (no ESP).
+  scale= e->inst.ops[op].sib_scale;
+  if ( scale == IA32_SIB_SCALE_NONE ) { index= SIB_NOREG; shift= 0; }
+  else
+    {
+      --scale;
+      index= REG32_OFF[scale%7 < 4 ? scale%7 : scale%7+1];
+      shift= (uint16_t) (scale/7);
+    }
+  
+  // Desplaçament
+  if ( e->inst.ops[op].type == IA32_ADDR32_SIB_DISP8 )
+    disp+= (uint32_t) ((int32_t) ((int8_t) e->inst.ops[op].u8));
+  else if ( e->inst.ops[op].type == IA32_ADDR32_SIB_DISP32 )
+    disp+= e->inst.ops[op].u32;
+  
+  add_word ( p, (e->inst.ops[op].data_seg == IA32_DS ?
+                 BC_DS_READ32_SIB_OP0 : BC_SS_READ32_SIB_OP0) +
+             (use_res ? -1 : op) );
+  add_word ( p, base | (index<<8) );
+  add_word ( p, shift );
+  add_word ( p, (uint16_t) (disp&0xFFFF) );
+  add_word ( p, (uint16_t) (disp>>16) );
+  
+} // end compile_get_rm32_sib_read
+
+
 // Torna cert si ho ha processat
 static bool
 compile_get_rm32_op (
@@ -566,6 +712,11 @@ compile_get_rm32_op (
       add_word ( p, BC_SET32_GS_OP0 + (use_res ? -1 : op) );
       break;
     default: // Intenta operacions de memòria.
+      if ( !apply_bitoffset_op1 && sib_read_fusable ( e, op ) )
+        {
+          compile_get_rm32_sib_read ( e, p, op, use_res );
+          break;
+        }
       ret= compile_get_addr ( e, p, op );
       if ( ret )
         {
@@ -844,6 +995,9 @@ compile_lop32 (
                const bool               write
                )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o EAX)
   if ( !compile_get_rm32_op ( e, p, 0, false, false ) )
@@ -879,11 +1033,17 @@ compile_lop32 (
   if ( write ) write_res32 ( e, p, 0 );
   
   // Flags
+  mask= e->flags&(SF_FLAG|ZF_FLAG|PF_FLAG);
   if ( (e->flags&OF_FLAG)!=0 || (e->flags&CF_FLAG)!=0 )
-    add_word ( p, BC_CLEAR_OF_CF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+    mask|= OF_FLAG|CF_FLAG;
+  if ( !add_fused_flags ( p, BC_SET32_LOP_EFLAGS, mask ) )
+    {
+      if ( (e->flags&OF_FLAG)!=0 || (e->flags&CF_FLAG)!=0 )
+        add_word ( p, BC_CLEAR_OF_CF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -993,6 +1153,9 @@ compile_add32_like (
                     const bool               use_carry
                     )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o EAX)
   if ( !compile_get_rm32_op ( e, p, 0, false, false ) )
@@ -1034,13 +1197,18 @@ compile_add32_like (
   write_res32 ( e, p, 0 );
   
   // Flags
-  if ( e->flags&OF_FLAG ) add_word ( p, BC_SET32_AD_OF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
-  if ( e->flags&AF_FLAG ) add_word ( p, BC_SET32_AD_AF_EFLAGS );
-  if ( (e->flags&CF_FLAG) && update_cflag )
-    add_word ( p, BC_SET32_AD_CF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+  mask= e->flags&(OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|
+                  (update_cflag ? CF_FLAG : 0));
+  if ( !add_fused_flags ( p, BC_SET32_AD_EFLAGS, mask ) )
+    {
+      if ( e->flags&OF_FLAG ) add_word ( p, BC_SET32_AD_OF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
+      if ( e->flags&AF_FLAG ) add_word ( p, BC_SET32_AD_AF_EFLAGS );
+      if ( (e->flags&CF_FLAG) && update_cflag )
+        add_word ( p, BC_SET32_AD_CF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -1059,6 +1227,9 @@ compile_sub32_like (
                     const bool               neg_op
                     )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o EAX)
   if ( !compile_get_rm32_op ( e, p, 0, false, false ) )
@@ -1098,13 +1269,19 @@ compile_sub32_like (
   if ( write_result ) write_res32 ( e, p, 0 );
   
   // Flags
-  if ( e->flags&OF_FLAG ) add_word ( p, BC_SET32_SB_OF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
-  if ( e->flags&AF_FLAG ) add_word ( p, BC_SET32_SB_AF_EFLAGS );
-  if ( (e->flags&CF_FLAG) && update_cflag )
-    add_word ( p, neg_op ? BC_SET32_NEG_CF_EFLAGS : BC_SET32_SB_CF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+  mask= e->flags&(OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|
+                  (update_cflag ? CF_FLAG : 0));
+  if ( neg_op || !add_fused_flags ( p, BC_SET32_SB_EFLAGS, mask ) )
+    {
+      if ( e->flags&OF_FLAG ) add_word ( p, BC_SET32_SB_OF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET32_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET32_ZF_EFLAGS );
+      if ( e->flags&AF_FLAG ) add_word ( p, BC_SET32_SB_AF_EFLAGS );
+      if ( (e->flags&CF_FLAG) && update_cflag )
+        add_word ( p, neg_op ? BC_SET32_NEG_CF_EFLAGS :
+                   BC_SET32_SB_CF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET32_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -1980,6 +2157,9 @@ compile_lop16 (
                const bool               write
                )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o AX)
   if ( !compile_get_rm16_op ( e, p, 0, false ) )
@@ -2014,11 +2194,17 @@ compile_lop16 (
   if ( write ) write_res16 ( e, p, 0 );
   
   // Flags
+  mask= e->flags&(SF_FLAG|ZF_FLAG|PF_FLAG);
   if ( (e->flags&OF_FLAG)!=0 || (e->flags&CF_FLAG)!=0 )
-    add_word ( p, BC_CLEAR_OF_CF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+    mask|= OF_FLAG|CF_FLAG;
+  if ( !add_fused_flags ( p, BC_SET16_LOP_EFLAGS, mask ) )
+    {
+      if ( (e->flags&OF_FLAG)!=0 || (e->flags&CF_FLAG)!=0 )
+        add_word ( p, BC_CLEAR_OF_CF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -2244,6 +2430,9 @@ compile_add16_like (
                     const bool               use_carry
                     )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o AX)
   if ( !compile_get_rm16_op ( e, p, 0, false ) )
@@ -2284,13 +2473,18 @@ compile_add16_like (
   write_res16 ( e, p, 0 );
   
   // Flags
-  if ( e->flags&OF_FLAG ) add_word ( p, BC_SET16_AD_OF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
-  if ( e->flags&AF_FLAG ) add_word ( p, BC_SET16_AD_AF_EFLAGS );
-  if ( (e->flags&CF_FLAG) && update_cflag )
-    add_word ( p, BC_SET16_AD_CF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+  mask= e->flags&(OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|
+                  (update_cflag ? CF_FLAG : 0));
+  if ( !add_fused_flags ( p, BC_SET16_AD_EFLAGS, mask ) )
+    {
+      if ( e->flags&OF_FLAG ) add_word ( p, BC_SET16_AD_OF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
+      if ( e->flags&AF_FLAG ) add_word ( p, BC_SET16_AD_AF_EFLAGS );
+      if ( (e->flags&CF_FLAG) && update_cflag )
+        add_word ( p, BC_SET16_AD_CF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -2309,6 +2503,9 @@ compile_sub16_like (
                     const bool               neg_op
                     )
 {
+
+  uint16_t mask;
+  
   
   // Operador 0 (típicament rm o AX)
   if ( !compile_get_rm16_op ( e, p, 0, false ) )
@@ -2348,13 +2545,19 @@ compile_sub16_like (
   if ( write_result ) write_res16 ( e, p, 0 );
   
   // Flags
-  if ( e->flags&OF_FLAG ) add_word ( p, BC_SET16_SB_OF_EFLAGS );
-  if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
-  if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
-  if ( e->flags&AF_FLAG ) add_word ( p, BC_SET16_SB_AF_EFLAGS );
-  if ( (e->flags&CF_FLAG) && update_cflag )
-    add_word ( p, neg_op ? BC_SET16_NEG_CF_EFLAGS : BC_SET16_SB_CF_EFLAGS );
-  if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+  mask= e->flags&(OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|
+                  (update_cflag ? CF_FLAG : 0));
+  if ( neg_op || !add_fused_flags ( p, BC_SET16_SB_EFLAGS, mask ) )
+    {
+      if ( e->flags&OF_FLAG ) add_word ( p, BC_SET16_SB_OF_EFLAGS );
+      if ( e->flags&SF_FLAG ) add_word ( p, BC_SET16_SF_EFLAGS );
+      if ( e->flags&ZF_FLAG ) add_word ( p, BC_SET16_ZF_EFLAGS );
+      if ( e->flags&AF_FLAG ) add_word ( p, BC_SET16_SB_AF_EFLAGS );
+      if ( (e->flags&CF_FLAG) && update_cflag )
+        add_word ( p, neg_op ? BC_SET16_NEG_CF_EFLAGS :
+                   BC_SET16_SB_CF_EFLAGS );
+      if ( e->flags&PF_FLAG ) add_word ( p, BC_SET16_PF_EFLAGS );
+    }
   
   // EIP
   update_eip ( e, p, true );
@@ -3817,6 +4020,46 @@ compile_setcc (
 } // end compile_setcc
 
 
+#ifdef __IA32_JIT_SUPERBLOCKS__
+// Salt relatiu dins d'un superbloc (veure sb_build). Si 'bc_cond' és
+// BC_UNK el salt és incondicional.
+static void
+compile_sb_branch (
+                   const IA32_JIT_DisEntry *e,
+                   IA32_JIT_Page           *p,
+                   const uint16_t           bc_cond,
+                   const bool               is32
+                   )
+{
+
+  uint32_t rel;
+  
+  
+  if ( e->inst.ops[0].type == IA32_REL8 )
+    rel= (uint32_t) ((int32_t) ((int8_t) e->inst.ops[0].u8));
+  else if ( e->inst.ops[0].type == IA32_REL16 )
+    rel= (uint32_t) ((int32_t) ((int16_t) e->inst.ops[0].u16));
+  else rel= e->inst.ops[0].u32;
+  if ( bc_cond == BC_UNK )
+    add_word ( p, is32 ? BC_SB_JMP32 : BC_SB_JMP16 );
+  else
+    {
+      add_word ( p, bc_cond );
+      add_word ( p, is32 ? BC_SB_BRANCH32 : BC_SB_BRANCH16 );
+    }
+  add_word ( p, (uint16_t) (rel&0xFFFF) );
+  add_word ( p, (uint16_t) (rel>>16) );
+  add_word ( p, e->inst.real_nbytes );
+  if ( bc_cond != BC_UNK )
+    {
+      add_link ( p ); // Eixida
+      add_word ( p, e->sb == SB_TAKEN );
+    }
+  
+} // end compile_sb_branch
+#endif
+
+
 static void
 compile_jcc (
              const IA32_JIT_DisEntry *e,
@@ -3826,13 +4069,37 @@ compile_jcc (
              )
 {
 
-  // Fixa cond
-  add_word ( p, bc_cond );
+  uint16_t bc_b32,bc_b32_imm32,bc_b16;
+  
+  
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  if ( e->sb != SB_NONE )
+    {
+      compile_sb_branch ( e, p, bc_cond, is32 );
+      return;
+    }
+#endif
+  // Fixa cond. Les condicions que depenen sols dels flags o de
+  // (E)CX es fusionen amb el branch, les de LOOP (decrementen (E)CX)
+  // es fixen abans.
+  if ( bc_cond >= BC_SET_A_COND && bc_cond <= BC_SET_S_COND )
+    {
+      bc_b32= BC_BRANCH32_A + (bc_cond-BC_SET_A_COND);
+      bc_b32_imm32= BC_BRANCH32_IMM32_A + (bc_cond-BC_SET_A_COND);
+      bc_b16= BC_BRANCH16_A + (bc_cond-BC_SET_A_COND);
+    }
+  else
+    {
+      add_word ( p, bc_cond );
+      bc_b32= BC_BRANCH32;
+      bc_b32_imm32= BC_BRANCH32_IMM32;
+      bc_b16= BC_BRANCH16;
+    }
   
   // Sols accepta REL16, REL32 o REL8
   if ( e->inst.ops[0].type == IA32_REL8 )
     {
-      add_word ( p, is32 ? BC_BRANCH32 : BC_BRANCH16 );
+      add_word ( p, is32 ? bc_b32 : bc_b16 );
       /*
       add_word ( p, is32 ?
                  BC_JMP32_NEAR_REL_IF_COND :
@@ -3840,6 +4107,8 @@ compile_jcc (
       */
       add_word ( p, (uint16_t) ((int16_t) ((int8_t) e->inst.ops[0].u8)) );
       add_word ( p, e->inst.real_nbytes );
+      add_link ( p ); // Salt
+      add_link ( p ); // No salt
       /*
       add_word ( p, 0 );
       add_word ( p, 0 ); // Padding
@@ -3853,10 +4122,12 @@ compile_jcc (
   else if ( e->inst.ops[0].type == IA32_REL16 )
     {
       assert ( !is32 );
-      add_word ( p, BC_BRANCH16 );
+      add_word ( p, bc_b16 );
       //add_word ( p, BC_JMP16_NEAR_REL_IF_COND );
       add_word ( p, e->inst.ops[0].u16 );
       add_word ( p, e->inst.real_nbytes );
+      add_link ( p ); // Salt
+      add_link ( p ); // No salt
       /*
       add_word ( p, 0 );
       add_word ( p, 0 ); // Padding
@@ -3869,11 +4140,13 @@ compile_jcc (
   else if ( e->inst.ops[0].type == IA32_REL32 )
     {
       assert ( is32 );
-      add_word ( p, BC_BRANCH32_IMM32 );
+      add_word ( p, bc_b32_imm32 );
       //add_word ( p, BC_JMP32_NEAR_REL32_IF_COND );
       add_word ( p, (uint16_t) (e->inst.ops[0].u32&0xFFFF) );
       add_word ( p, (uint16_t) (e->inst.ops[0].u32>>16) );
       add_word ( p, e->inst.real_nbytes );
+      add_link ( p ); // Salt
+      add_link ( p ); // No salt
       /*
       add_word ( p, 0 ); // Padding
       add_word ( p, BC_INC_IMM_EIP_AND_GOTO_EIP );
@@ -3984,6 +4257,13 @@ compile_jmp_near_like (
                        )
 {
 
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  if ( e->sb != SB_NONE )
+    {
+      compile_sb_branch ( e, p, BC_UNK, op32 );
+      return;
+    }
+#endif
   // Operadors
   if ( e->inst.ops[0].type == IA32_REL32 )
     {
@@ -4001,6 +4281,7 @@ compile_jmp_near_like (
       add_word ( p, (uint16_t) (e->inst.ops[0].u32&0xFFFF) );
       add_word ( p, (uint16_t) (e->inst.ops[0].u32>>16) );
       add_word ( p, e->inst.real_nbytes );
+      if ( !is_call ) add_link ( p );
     }
   else if ( e->inst.ops[0].type == IA32_REL16 )
     {
@@ -4010,6 +4291,7 @@ compile_jmp_near_like (
         add_word ( p, op32 ? BC_JMP32_NEAR_REL : BC_JMP16_NEAR_REL );
       add_word ( p, e->inst.ops[0].u16 );
       add_word ( p, e->inst.real_nbytes );
+      if ( !is_call ) add_link ( p );
     }
   else if ( e->inst.ops[0].type == IA32_REL8 )
     {
@@ -4021,6 +4303,7 @@ compile_jmp_near_like (
       add_word ( p, op32 ? BC_JMP32_NEAR_REL : BC_JMP16_NEAR_REL );
       add_word ( p, (uint16_t) ((int16_t) ((int8_t) e->inst.ops[0].u8)) );
       add_word ( p, e->inst.real_nbytes );
+      add_link ( p );
     }
   else if ( op32 && compile_get_rm32_op ( e, p, 0, true, false ) )
     {
@@ -6434,6 +6717,326 @@ compile_fxch (
 } // end compile_fxch
 
 
+#ifdef __IA32_JIT_LAZY_FLAGS__
+// Torna els flags pendents que cal calcular abans d'executar 'e'. Les
+// instruccions que no estan en la llista es consideren perilloses
+// (poden llegir o modificar EFLAGS sense indicar-ho en
+// INSTS_METADATA) i calculen tots els flags.
+static uint32_t
+lazy_flags_req (
+                const IA32_JIT_DisEntry *e
+                )
+{
+
+  uint32_t req;
+  
+  
+  switch ( e->inst.name )
+    {
+      // Registren els flags de manera mandrosa.
+    case IA32_ADD32: case IA32_ADD16:
+    case IA32_SUB32: case IA32_SUB16:
+    case IA32_CMP32: case IA32_CMP16:
+    case IA32_INC32: case IA32_INC16:
+    case IA32_DEC32: case IA32_DEC16:
+    case IA32_AND32: case IA32_AND16:
+    case IA32_OR32: case IA32_OR16:
+    case IA32_XOR32: case IA32_XOR16:
+    case IA32_TEST32: case IA32_TEST16:
+      // Calculen ZF elles mateixes (BC_BRANCH*_E/NE).
+    case IA32_JE32: case IA32_JE16:
+    case IA32_JNE32: case IA32_JNE16:
+      // No toquen OSZACP.
+    case IA32_MOV32: case IA32_MOV16: case IA32_MOV8:
+    case IA32_MOVSX32W: case IA32_MOVSX32B: case IA32_MOVSX16:
+    case IA32_MOVZX32W: case IA32_MOVZX32B: case IA32_MOVZX16:
+    case IA32_LEA32: case IA32_LEA16:
+    case IA32_PUSH32: case IA32_PUSH16:
+    case IA32_POP32: case IA32_POP16:
+    case IA32_PUSHA32: case IA32_PUSHA16:
+    case IA32_POPA32: case IA32_POPA16:
+    case IA32_XCHG32: case IA32_XCHG16: case IA32_XCHG8:
+    case IA32_NOT32: case IA32_NOT16: case IA32_NOT8:
+    case IA32_CBW: case IA32_CWDE: case IA32_CWD: case IA32_CDQ:
+    case IA32_BSWAP:
+    case IA32_NOP:
+    case IA32_ENTER32: case IA32_ENTER16:
+    case IA32_LEAVE32: case IA32_LEAVE16:
+    case IA32_XLATB32: case IA32_XLATB16:
+    case IA32_LODS32: case IA32_LODS16: case IA32_LODS8:
+    case IA32_STOS32: case IA32_STOS16: case IA32_STOS8:
+    case IA32_MOVS32: case IA32_MOVS16: case IA32_MOVS8:
+    case IA32_CLD: case IA32_STD: case IA32_CLI: case IA32_STI:
+    case IA32_JMP32_NEAR: case IA32_JMP16_NEAR:
+    case IA32_CALL32_NEAR: case IA32_CALL16_NEAR:
+    case IA32_RET32_NEAR: case IA32_RET16_NEAR:
+    case IA32_LOOP32: case IA32_LOOP16:
+    case IA32_JCXZ32: case IA32_JCXZ16:
+    case IA32_JECXZ32: case IA32_JECXZ16:
+      return 0;
+    default:
+      // Sols llegeixen flags (Jcc, SETcc, LAHF...)
+      req= INSTS_METADATA[e->inst.name].req_flags;
+      if ( INSTS_METADATA[e->inst.name].chg_flags == 0 &&
+           (req&(~OSZACP_FLAGS)) == 0 && req != 0 )
+        return req;
+      return OSZACP_FLAGS;
+    }
+  
+} // end lazy_flags_req
+#endif
+
+
+// Torna el registre (0-7) si 'bc' és un dels bytecodes
+// BC_SETnn_<REG>_<kind> de la família que comença en 'first'
+// (BC_SET32_EAX_RES o BC_SET16_AX_RES), on 'kind' és 0 (RES), 1 (OP0)
+// o 2 (OP1). En cas contrari torna -1.
+static int
+peephole_reg_op (
+                 const uint16_t bc,
+                 const uint16_t first,
+                 const int      kind
+                 )
+{
+
+  if ( bc < first || bc >= first+3*8 || (bc-first)%3 != kind )
+    return -1;
+
+  return (bc-first)/3;
+  
+} // end peephole_reg_op
+
+
+// Torna el registre (0-7) si 'bc' és BC_SETnn_RES_<REG> de la família
+// que comença en 'first' (BC_SET32_RES_EAX o BC_SET16_RES_AX), -1 en
+// cas contrari.
+static int
+peephole_reg_res (
+                  const uint16_t bc,
+                  const uint16_t first
+                  )
+{
+  return (bc >= first && bc < first+8) ? (bc-first) : -1;
+} // end peephole_reg_res
+
+
+// Substituïx les paraules [beg,beg+n) per les 'm' de 'w' (m <= n)
+// desplaçant la resta del bytecode de la instrucció.
+static void
+peephole_replace (
+                  IA32_JIT_Page  *p,
+                  const uint32_t  beg,
+                  const uint32_t  n,
+                  const uint16_t *w,
+                  const uint32_t  m
+                  )
+{
+
+  uint32_t i;
+  
+  
+  for ( i= 0; i < m; ++i )
+    p->v[beg+i]= w[i];
+  if ( m < n )
+    {
+      memmove ( &(p->v[beg+m]), &(p->v[beg+n]),
+                sizeof(uint16_t)*(p->N-(beg+n)) );
+      p->N-= n-m;
+    }
+  
+} // end peephole_replace
+
+
+// Peephole sobre el bytecode que s'acaba de generar per a 'e' a
+// partir de la posició 'beg'. Els operadors que van i tornen per
+// op32[]/res32 es reemplacen per bytecodes que operen directament
+// sobre els registres: MOV reg,reg, MOV reg,imm, MOV reg,[mem] (DS i
+// SS, també amb adreça SIB fusionada) i
+// ADD/SUB/AND/OR/XOR/CMP/TEST reg,reg|imm. Els temporals es continuen
+// assignant perquè els flags que venen després els lligen.
+static void
+peephole (
+          const IA32_JIT_DisEntry *e,
+          IA32_JIT_Page           *p,
+          const uint32_t           beg
+          )
+{
+
+  static const uint16_t ALU32_IMM[]=
+    {BC_ADD32_REG_IMM,BC_SUB32_REG_IMM,BC_AND32_REG_IMM,BC_OR32_REG_IMM,
+     BC_XOR32_REG_IMM,BC_CMP32_REG_IMM,BC_TEST32_REG_IMM};
+  static const uint16_t ALU16_IMM[]=
+    {BC_ADD16_REG_IMM,BC_SUB16_REG_IMM,BC_AND16_REG_IMM,BC_OR16_REG_IMM,
+     BC_XOR16_REG_IMM,BC_CMP16_REG_IMM,BC_TEST16_REG_IMM};
+  
+  uint16_t *v,w[4];
+  uint32_t n,i,imm,end;
+  int a,b,alu;
+  bool is32;
+  
+  
+  v= &(p->v[beg]);
+  n= p->N-beg;
+  if ( n < 2 ) return;
+  
+  // MOV reg,reg
+  if ( (a= peephole_reg_op ( v[0], BC_SET32_EAX_RES, 0 )) != -1 &&
+       (b= peephole_reg_res ( v[1], BC_SET32_RES_EAX )) != -1 )
+    {
+      v[0]= BC_MOV32_REG_REG;
+      v[1]= REG32_OFF[a] | (REG32_OFF[b]<<8);
+      return;
+    }
+  if ( (a= peephole_reg_op ( v[0], BC_SET16_AX_RES, 0 )) != -1 &&
+       (b= peephole_reg_res ( v[1], BC_SET16_RES_AX )) != -1 )
+    {
+      v[0]= BC_MOV16_REG_REG;
+      v[1]= REG16_OFF[a] | (REG16_OFF[b]<<8);
+      return;
+    }
+  
+  // MOV reg,imm
+  if ( n >= 4 && v[0] == BC_SET32_IMM32_RES &&
+       (b= peephole_reg_res ( v[3], BC_SET32_RES_EAX )) != -1 )
+    {
+      v[3]= v[2]; v[2]= v[1]; v[1]= REG32_OFF[b];
+      v[0]= BC_SET32_IMM32_REG;
+      return;
+    }
+  if ( n >= 3 && v[0] == BC_SET16_IMM_RES &&
+       (b= peephole_reg_res ( v[2], BC_SET16_RES_AX )) != -1 )
+    {
+      v[2]= v[1]; v[1]= REG16_OFF[b];
+      v[0]= BC_SET16_IMM_REG;
+      return;
+    }
+
+  // MOV reg,[mem]. La lectura i l'assignació són les últimes abans
+  // d'actualitzar la EIP.
+  if ( (e->inst.name == IA32_MOV32 || e->inst.name == IA32_MOV16) &&
+       e->inst.ops[0].type >= IA32_AX && e->inst.ops[0].type <= IA32_EDI )
+    {
+      end= p->N - (e->defer_eip ? 2 : 1);
+      if ( end < beg+2 ) return;
+      if ( e->inst.name == IA32_MOV32 )
+        {
+          if ( (b= peephole_reg_res ( p->v[end-1], BC_SET32_RES_EAX ))
+               == -1 )
+            return;
+          if ( sib_read_fusable ( e, 1 ) ) // Lectura de 5 paraules
+            {
+              if ( end < beg+6 ) return;
+              if ( p->v[end-6] == BC_DS_READ32_SIB_RES )
+                p->v[end-6]= BC_DS_READ32_SIB_REG;
+              else if ( p->v[end-6] == BC_SS_READ32_SIB_RES )
+                p->v[end-6]= BC_SS_READ32_SIB_REG;
+              else return;
+            }
+          else if ( p->v[end-2] == BC_DS_READ32_RES )
+            p->v[end-2]= BC_DS_READ32_REG;
+          else if ( p->v[end-2] == BC_SS_READ32_RES )
+            p->v[end-2]= BC_SS_READ32_REG;
+          else return;
+          p->v[end-1]= REG32_OFF[b];
+        }
+      else
+        {
+          if ( (b= peephole_reg_res ( p->v[end-1], BC_SET16_RES_AX ))
+               == -1 )
+            return;
+          if ( p->v[end-2] == BC_DS_READ16_RES )
+            p->v[end-2]= BC_DS_READ16_REG;
+          else if ( p->v[end-2] == BC_SS_READ16_RES )
+            p->v[end-2]= BC_SS_READ16_REG;
+          else return;
+          p->v[end-1]= REG16_OFF[b];
+        }
+      return;
+    }
+  
+  // ALU reg,reg|imm. Com que es desplaça el bytecode sols es
+  // considera per a instruccions que no generen salts interns.
+  switch ( e->inst.name )
+    {
+    case IA32_ADD32: case IA32_SUB32: case IA32_AND32: case IA32_OR32:
+    case IA32_XOR32: case IA32_CMP32: case IA32_TEST32:
+    case IA32_ADD16: case IA32_SUB16: case IA32_AND16: case IA32_OR16:
+    case IA32_XOR16: case IA32_CMP16: case IA32_TEST16:
+      break;
+    default: return;
+    }
+  is32= true;
+  if ( (a= peephole_reg_op ( v[0], BC_SET32_EAX_RES, 1 )) == -1 )
+    {
+      if ( (a= peephole_reg_op ( v[0], BC_SET16_AX_RES, 1 )) == -1 )
+        return;
+      is32= false;
+    }
+  b= -1;
+  imm= 0;
+  if ( is32 )
+    {
+      if ( (b= peephole_reg_op ( v[1], BC_SET32_EAX_RES, 2 )) != -1 ) i= 2;
+      else if ( v[1] == BC_SET32_1_OP1 ) { imm= 1; i= 2; }
+      else if ( v[1] == BC_SET32_SIMM_OP1 && n > 2 )
+        { imm= (uint32_t) ((int32_t) ((int16_t) v[2])); i= 3; }
+      else if ( v[1] == BC_SET32_IMM32_OP1 && n > 3 )
+        { imm= ((uint32_t) v[2]) | (((uint32_t) v[3])<<16); i= 4; }
+      else return;
+    }
+  else
+    {
+      if ( (b= peephole_reg_op ( v[1], BC_SET16_AX_RES, 2 )) != -1 ) i= 2;
+      else if ( v[1] == BC_SET16_1_OP1 ) { imm= 1; i= 2; }
+      else if ( v[1] == BC_SET16_IMM_OP1 && n > 2 ) { imm= v[2]; i= 3; }
+      else return;
+    }
+  if ( i >= n ) return;
+  if      ( v[i] == (is32 ? BC_ADD32 : BC_ADD16) ) alu= 0;
+  else if ( v[i] == (is32 ? BC_SUB32 : BC_SUB16) ) alu= 1;
+  else if ( v[i] == (is32 ? BC_AND32 : BC_AND16) ) alu= 2;
+  else if ( v[i] == (is32 ? BC_OR32 : BC_OR16) ) alu= 3;
+  else if ( v[i] == (is32 ? BC_XOR32 : BC_XOR16) ) alu= 4;
+  else return;
+  ++i;
+  // Sense escriptura del resultat sols poden ser CMP i TEST.
+  if ( i < n &&
+       peephole_reg_res ( v[i], is32 ? BC_SET32_RES_EAX : BC_SET16_RES_AX )
+       == a )
+    ++i;
+  else if ( alu == 1 ) alu= 5;
+  else if ( alu == 2 ) alu= 6;
+  else return;
+  
+  // Reemplaça.
+  if ( b != -1 )
+    {
+      w[0]= (is32 ? ALU32_IMM[alu] : ALU16_IMM[alu]) +
+        (BC_ADD32_REG_REG-BC_ADD32_REG_IMM);
+      w[1]= is32 ?
+        (REG32_OFF[a] | (REG32_OFF[b]<<8)) :
+        (REG16_OFF[a] | (REG16_OFF[b]<<8));
+      peephole_replace ( p, beg, i, w, 2 );
+    }
+  else if ( is32 )
+    {
+      w[0]= ALU32_IMM[alu];
+      w[1]= REG32_OFF[a];
+      w[2]= (uint16_t) (imm&0xFFFF);
+      w[3]= (uint16_t) (imm>>16);
+      peephole_replace ( p, beg, i, w, 4 );
+    }
+  else
+    {
+      w[0]= ALU16_IMM[alu];
+      w[1]= REG16_OFF[a];
+      w[2]= (uint16_t) imm;
+      peephole_replace ( p, beg, i, w, 3 );
+    }
+  
+} // end peephole
+
+
 static void
 compile (
          const IA32_JIT          *jit,
@@ -6442,6 +7045,20 @@ compile (
          )
 {
 
+  uint32_t beg;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  uint32_t bits;
+  
+  
+  bits= lazy_flags_req ( e );
+  if ( bits != 0 )
+    {
+      add_word ( p, BC_LAZY_FLAGS );
+      add_word ( p, (uint16_t) bits );
+    }
+#endif
+  
+  beg= p->N;
   switch ( e->inst.name )
     {
     case IA32_AAD: compile_aam_like ( e, p, BC_AAD ); break;
@@ -7156,5 +7773,6 @@ compile (
                 e->addr );
       exit ( EXIT_FAILURE );
     }
-    
+  peephole ( e, p, beg );
+  
 } // end compile
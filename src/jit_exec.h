@@ -5913,6 +5913,8 @@ interruption (
               const bool     use_error_code
               )
 {
+
+  jit->_halted= false;
   
   return
     ( PROTECTED_MODE_ACTIVATED ) ?
@@ -5923,6 +5925,79 @@ interruption (
 } // end interruption
 
 
+#ifdef __IA32_JIT_LAZY_FLAGS__
+// Calcula i escriu en EFLAGS els flags de 'bits' que estan pendents
+// de l'última operació registrada en jit->_lazy.
+static void
+lazy_flags_eval (
+                 IA32_JIT       *jit,
+                 const uint32_t  bits
+                 )
+{
+
+  uint32_t b,op0,op1,res,sign,flags;
+  
+  
+  b= bits&jit->_lazy.mask;
+  if ( b == 0 ) return;
+  op0= jit->_lazy.op0;
+  op1= jit->_lazy.op1;
+  res= jit->_lazy.res;
+  sign= jit->_lazy.sign;
+  flags= 0;
+  if ( (b&SF_FLAG) && (res&sign) ) flags|= SF_FLAG;
+  if ( (b&ZF_FLAG) && res == 0 ) flags|= ZF_FLAG;
+  if ( (b&PF_FLAG) && PFLAG[(uint8_t) (res&0xff)] ) flags|= PF_FLAG;
+  switch ( jit->_lazy.op )
+    {
+    case LAZY_AD:
+      if ( (b&OF_FLAG) && ((~(op0^op1))&(op0^res)&sign) ) flags|= OF_FLAG;
+      if ( (b&AF_FLAG) && (((op0^op1)^res)&0x10) ) flags|= AF_FLAG;
+      if ( (b&CF_FLAG) && (((op0&op1) | ((op0|op1)&(~res)))&sign) )
+        flags|= CF_FLAG;
+      break;
+    case LAZY_SB:
+      if ( (b&OF_FLAG) && (((op0^op1)&(op0^res))&sign) ) flags|= OF_FLAG;
+      if ( (b&AF_FLAG) && !(((op0^(~op1))^res)&0x10) ) flags|= AF_FLAG;
+      if ( (b&CF_FLAG) &&
+           !(((op0&(~op1)) | ((op0|(~op1))&(~res)))&sign) )
+        flags|= CF_FLAG;
+      break;
+    default: break; // LAZY_LOP: OF i CF a 0
+    }
+  EFLAGS= (EFLAGS&(~b)) | flags;
+  jit->_lazy.mask&= ~b;
+  
+} // end lazy_flags_eval
+
+
+// Registra una operació els flags 'mask' de la qual es calcularan
+// quan facen falta. Abans calcula els pendents que no es sobreescriuen.
+static void
+lazy_flags_set (
+                IA32_JIT       *jit,
+                const int       op,
+                const uint32_t  sign,
+                const uint32_t  op0,
+                const uint32_t  op1,
+                const uint32_t  res,
+                const uint32_t  mask
+                )
+{
+
+  if ( jit->_lazy.mask&(~mask) )
+    lazy_flags_eval ( jit, jit->_lazy.mask&(~mask) );
+  jit->_lazy.op= op;
+  jit->_lazy.sign= sign;
+  jit->_lazy.op0= op0;
+  jit->_lazy.op1= op1;
+  jit->_lazy.res= res;
+  jit->_lazy.mask= mask;
+  
+} // end lazy_flags_set
+#endif
+
+
 #define MAX_NESTED_EXCEPTIONS 5
 
 static void
@@ -5937,6 +6012,9 @@ exception_body (
   
   
   // Prepara
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  lazy_flags_eval ( jit, OSZACP_FLAGS );
+#endif
   ok= false;
   counter= 0;
   if ( jit->_exception.vec == -1 )
@@ -6000,63 +6078,68 @@ goto_eip_body (
 {
 
   uint32_t addr,page,inst,pos;
-  const IA32_JIT_MemMap *mem_map;
+  IA32_JIT_MemMap *mem_map;
   int area;
   IA32_JIT_Page *p;
+  bool is32;
   
 
+  is32= ADDR_OP_SIZE_IS_32;
   addr= P_CS->h.lim.addr + (EIP);
   if ( !translate_addr ( jit, &addr ) )
     return false;
-  area= 0;
-  mem_map= jit->_mem_map;
+  area= find_area ( jit, addr );
+  if ( area == -1 )
+    {
+      fprintf ( FERROR,
+                "[EE] IA32 JIT - pàgina fora de rang (ADDR: %08X)\n",
+                addr );
+      exit ( EXIT_FAILURE );
+    }
+  mem_map= &(jit->_mem_map[area]);
+  page= (addr-mem_map->first_addr)>>mem_map->bits_page;
+  inst= addr&(mem_map->page_low_mask);
   do {
-    if ( addr >= mem_map->first_addr && addr <= mem_map->last_addr )
+    
+    // Fixa la pàgina.
+    p= jit->_current_page= map_get ( mem_map, page );
+    if ( p == NULL )
       {
-        page= (addr-mem_map->first_addr)>>jit->_bits_page;
-        inst= addr&(jit->_page_low_mask);
-        do {
-
-          // Fixa la pàgina.
-          p= jit->_current_page= mem_map->map[page];
-          if ( p == NULL )
-            {
-              p= jit->_current_page=
-                mem_map->map[page]=
-                get_new_page ( jit );
-              p->page_id= page;
-              p->area_id= area;
-            }
-
-          // Fixa la posició
-          pos= jit->_current_pos= p->entries[inst].ind;
-          if ( pos != NULL_ENTRY )
-            {
-              if ( pos != PAD_ENTRY &&
-                   p->entries[inst].is32==ADDR_OP_SIZE_IS_32 )
-                return true; // FET !!!!!
-              else remove_page ( jit, area, page ); // Esborra i repeteix
-            }
-          else
-            {
-              if ( !dis_insts ( jit, p, addr, EIP, &jit->_current_pos ) )
-                {
-                  remove_page ( jit, area, page );
-                  return false;
-                }
-              if ( jit->_current_pos != NULL_ENTRY ) return true; // FET !!!
-              else remove_page ( jit, area, page ); // Esborra i repeteix
-            }
-        } while ( true );
+        p= jit->_current_page= get_new_page ( jit );
+        map_set ( mem_map, page, p );
+        p->page_id= page;
+        p->area_id= area;
+        if ( !mem_map->rom )
+          mark_code_frames ( jit,
+                             addr&~(mem_map->page_low_mask),
+                             addr|(mem_map->page_low_mask) );
+#ifdef __IA32_JIT_CACHE__
+        if ( jit->_cache != NULL ) cache_fill_page ( jit, p );
+#endif
+      }
+    else if ( p != jit->_pages ) move_page_to_head ( jit, p );
+    
+    // Fixa la posició en el mapa del mode actual (cada mode té la
+    // seua traducció).
+    alloc_entries ( jit, p, is32 );
+    pos= jit->_current_pos= p->entries[is32][inst];
+#ifdef __IA32_JIT_SUPERBLOCKS__
+    jit->_current_entry= inst;
+#endif
+    if ( pos != NULL_ENTRY && pos != PAD_ENTRY ) return true; // FET !!!!!
+    
+    // Compila. Si es bota a meitat d'una instrucció ja compilada
+    // (PAD) el nou flux conviu amb l'anterior.
+    if ( !dis_insts ( jit, p, addr, EIP, &jit->_current_pos ) )
+      {
+        remove_page ( jit, area, page );
+        return false;
       }
-    else { ++area; ++mem_map; }
-  } while ( area < jit->_mem_map_size );
-
-  // ERROR
-  fprintf ( FERROR,
-            "[EE] IA32 JIT - pàgina fora de rang (ADDR: %08X)\n",
-            addr );
-  exit ( EXIT_FAILURE );
+    update_page_bytes ( jit, p );
+    if ( jit->_current_pos != NULL_ENTRY ) return true; // FET !!!
+    else remove_page ( jit, area, page ); // Esborra i repeteix
+  } while ( true );
+  
   return false; // CALLA
   
 } // end goto_eip_body
@@ -6087,20 +6170,192 @@ goto_eip (
 } // end goto_eip
 
 
+#ifdef __IA32_JIT_SUPERBLOCKS__
+// Compta una entrada en el bloc 'e' de la pàgina actual 'q' (la EIP
+// apunta a ell). Quan es torna calent es compila el superbloc i es
+// continua en ell.
 static void
+sb_count (
+          IA32_JIT       *jit,
+          IA32_JIT_Page  *q,
+          const uint32_t  e
+          )
+{
+
+  uint8_t *count;
+  bool is32;
+  
+  
+  is32= ADDR_OP_SIZE_IS_32;
+  count= &(q->entries_count[is32][e]);
+  if ( *count != 0xFF && ++(*count) == SB_HOT )
+    {
+      sb_build ( jit, q, e );
+      jit->_current_pos= q->entries[is32][e];
+    }
+  
+} // end sb_count
+#endif
+
+
+// Com goto_eip però primer consulta l'enllaç 'link' de la pàgina
+// 'p'. Si l'enllaç no és vàlid fa un goto_eip normal i l'actualitza
+// amb el resultat.
+static void
+goto_eip_link (
+               IA32_JIT       *jit,
+               IA32_JIT_Page  *p,
+               const uint16_t  link
+               )
+{
+
+  IA32_JIT_PageLink *l;
+  
+  
+  if ( link == NO_LINK ) { goto_eip ( jit ); return; }
+  
+  // Enllaç vàlid.
+  l= &(p->links[link]);
+  if ( l->gen == jit->_link_gen &&
+       l->laddr == P_CS->h.lim.addr + (EIP) &&
+       l->is32 == ADDR_OP_SIZE_IS_32 &&
+       l->cpl == CPL )
+    {
+      jit->_current_page= l->page;
+      jit->_current_pos= l->pos;
+      if ( l->page != jit->_pages ) move_page_to_head ( jit, l->page );
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      sb_count ( jit, l->page, l->entry );
+#endif
+      return;
+    }
+
+  // Resol i actualitza. Si 'p' s'ha esborrat no passa res perquè és
+  // la pàgina bloquejada i els seus enllaços es descarten. Cal tornar
+  // a calcular 'l' perquè compilar en 'p' pot reubicar els enllaços.
+  goto_eip ( jit );
+  l= &(p->links[link]);
+  l->page= jit->_current_page;
+  l->pos= jit->_current_pos;
+  l->laddr= P_CS->h.lim.addr + (EIP);
+  l->is32= ADDR_OP_SIZE_IS_32;
+  l->cpl= CPL;
+  l->gen= jit->_link_gen;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+  l->entry= jit->_current_entry;
+  sb_count ( jit, jit->_current_page, jit->_current_entry );
+#endif
+  
+} // end goto_eip_link
+
+
+#ifdef JIT_THREADED
+#define BC_CASE(BC) case BC: L_ ## BC
+#define BC_DEFAULT default: L_BC_DEFAULT
+#define BC_NEXT do { ++pos; goto *BC_LABELS[p->v[pos]]; } while(0)
+#else
+#define BC_CASE(BC) case BC
+#define BC_DEFAULT default
+#define BC_NEXT break
+#endif
+
+// Condicions dels salts condicionals, compartides per BC_SET_*_COND i
+// pels BC_BRANCH*_* fusionats. Sols E i NE consulten els flags
+// mandrosos, la resta ja estan calculats (veure lazy_flags_req).
+#ifdef __IA32_JIT_LAZY_FLAGS__
+#define COND_E                                                          \
+  ((jit->_lazy.mask&ZF_FLAG) ?                                          \
+   (jit->_lazy.res==0) : ((l_EFLAGS&ZF_FLAG)!=0))
+#define COND_NE                                                         \
+  ((jit->_lazy.mask&ZF_FLAG) ?                                          \
+   (jit->_lazy.res!=0) : ((l_EFLAGS&ZF_FLAG)==0))
+#else
+#define COND_E  ((l_EFLAGS&ZF_FLAG)!=0)
+#define COND_NE ((l_EFLAGS&ZF_FLAG)==0)
+#endif
+#define COND_A    ((l_EFLAGS&(ZF_FLAG|CF_FLAG))==0)
+#define COND_AE   ((l_EFLAGS&CF_FLAG)==0)
+#define COND_B    ((l_EFLAGS&CF_FLAG)!=0)
+#define COND_CXZ  (l_CX==0)
+#define COND_ECXZ (l_ECX==0)
+#define COND_G                                                          \
+  (((l_EFLAGS&ZF_FLAG)==0) &&                                           \
+   !(((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0)))
+#define COND_GE   (!(((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0)))
+#define COND_L    (((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0))
+#define COND_NA   ((l_EFLAGS&(ZF_FLAG|CF_FLAG))!=0)
+#define COND_NG                                                         \
+  (((l_EFLAGS&ZF_FLAG)!=0) ||                                           \
+   (((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0)))
+#define COND_NO   ((l_EFLAGS&OF_FLAG)==0)
+#define COND_NS   ((l_EFLAGS&SF_FLAG)==0)
+#define COND_O    ((l_EFLAGS&OF_FLAG)!=0)
+#define COND_P    ((l_EFLAGS&PF_FLAG)!=0)
+#define COND_PO   ((l_EFLAGS&PF_FLAG)==0)
+#define COND_S    ((l_EFLAGS&SF_FLAG)!=0)
+
+// Adreça d'un BC_*_READ32_SIB_*. 'v' apunta al primer operador.
+static uint32_t
+sib_offset (
+            IA32_CPU       *l_cpu,
+            const uint16_t *v
+            )
+{
+
+  uint32_t ret;
+  
+  
+  ret= ((uint32_t) v[2]) | (((uint32_t) v[3])<<16);
+  if ( (v[0]&0xFF) != SIB_NOREG ) ret+= l_REG32(v[0]&0xFF);
+  if ( (v[0]>>8) != SIB_NOREG ) ret+= l_REG32(v[0]>>8)<<v[1];
+  
+  return ret;
+  
+} // end sib_offset
+
+
+// Dins de exec_inst la EIP pot tindre increments pendents
+// (BC_INC_EIP_DEFER), abans de processar una excepció cal aplicar-los
+// perquè la EIP apunte a la instrucció que falla.
+#define exception(JIT)                                                  \
+  do {                                                                  \
+    l_EIP+= eip_pending;                                                \
+    eip_pending= 0;                                                     \
+    exception ( JIT );                                                  \
+  } while(0)
+
+// Executa instruccions fins a 'budget' (com a mínim una). Torna el
+// nombre d'instruccions executades i en 'reason' el motiu pel qual
+// ha parat. No comprova si hi ha interrupcions abans d'executar la
+// primera instrucció.
+static int
 exec_inst (
-           IA32_JIT *jit
+           IA32_JIT     *jit,
+           const int     budget,
+           IA32_RunExit *reason
            )
 {
 
   IA32_CPU *l_cpu;
   IA32_JIT_Page *p;
   uint32_t pos;
+  int ninsts;
+  uint32_t eip_pending;
+  bool halted;
+#ifdef JIT_THREADED
+#include "jit_exec_labels.h"
+#endif
+#ifdef __IA32_JIT_PROFILE__
+  int prof_prev;
+#endif
   // -> Registres adicionals
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
   uint64_t res64,tmp64;
   uint32_t offset,op32[2],res32,next_eip,tmp32;
+#ifndef __IA32_JIT_LAZY_FLAGS__
+  uint32_t flags;
+#endif
   uint16_t selector,op16[2],res16,port,tmp16;
   uint8_t op8[2],res8,tmp8;
   bool cond,tmp_bool,fpu_ok;
@@ -6118,6 +6373,16 @@ exec_inst (
   // simplement jit->_current_page serà NULL i per tant el valor de
   // current_pos serà irrellevant.
   
+  l_cpu= jit->_cpu;
+  ninsts= 0;
+#ifdef __IA32_JIT_PROFILE__
+  prof_prev= BC_NUM;
+#endif
+ next_inst:
+  jit->_inhibit_interrupt= false;
+  halted= false;
+  eip_pending= 0;
+  
   // Inicialitza current_page si cal
   if ( jit->_current_page == NULL )
     goto_eip ( jit );
@@ -6126,326 +6391,493 @@ exec_inst (
   jit->_lock_page= p= jit->_current_page;
   
   // Itera
-  l_cpu= jit->_cpu;
-  pos= jit->_current_pos;;
+  pos= jit->_current_pos;
   do {
+#ifdef __IA32_JIT_PROFILE__
+    ++(jit->_prof[prof_prev*BC_NUM + p->v[pos]]);
+    prof_prev= p->v[pos];
+#endif
     switch ( p->v[pos] )
       {
         
         // FINALS INSTRUCCIÓ
-      case BC_GOTO_EIP: goto_eip ( jit ); goto stop; break;
-      case BC_INC1_EIP: ++l_EIP; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC2_EIP: l_EIP+= 2; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC3_EIP: l_EIP+= 3; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC4_EIP: l_EIP+= 4; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC5_EIP: l_EIP+= 5; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC6_EIP: l_EIP+= 6; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC7_EIP: l_EIP+= 7; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC8_EIP: l_EIP+= 8; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC9_EIP: l_EIP+= 9; jit->_current_pos= pos+1; goto stop; break;
-      case BC_INC10_EIP:
+      BC_CASE(BC_GOTO_EIP):
+        goto_eip_link ( jit, p, p->v[pos+1] );
+        goto stop;
+#ifdef IA32_JIT_NATIVE
+      BC_CASE(BC_NATIVE):
+        // Sols s'executa si caben totes les instruccions en el
+        // pressupost, en cas contrari continua amb el bytecode.
+        if ( budget-ninsts >= (int) p->v[pos+3] )
+          {
+            l_EIP+= eip_pending;
+            eip_pending= 0;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+            lazy_flags_eval ( jit, OSZACP_FLAGS );
+#endif
+            ((native_func_t *) (void *)
+             (p->native +
+              (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16))))
+              ( l_cpu );
+            ninsts+= ((int) p->v[pos+3]) - 1;
+            pos+= 5 + (uint32_t) p->v[pos+4];
+            if ( p->v[pos] == BC_GOTO_EIP )
+              goto_eip_link ( jit, p, p->v[pos+1] );
+            else jit->_current_pos= pos;
+            goto stop;
+          }
+        else pos+= 4;
+        BC_NEXT;
+#endif
+#ifdef __IA32_JIT_LAZY_FLAGS__
+      BC_CASE(BC_LAZY_FLAGS):
+        lazy_flags_eval ( jit, p->v[++pos] );
+        BC_NEXT;
+#endif
+      BC_CASE(BC_INC1_EIP): ++l_EIP; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC2_EIP): l_EIP+= 2; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC3_EIP): l_EIP+= 3; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC4_EIP): l_EIP+= 4; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC5_EIP): l_EIP+= 5; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC6_EIP): l_EIP+= 6; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC7_EIP): l_EIP+= 7; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC8_EIP): l_EIP+= 8; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC9_EIP): l_EIP+= 9; jit->_current_pos= pos+1; goto stop;
+      BC_CASE(BC_INC10_EIP):
         l_EIP+= 10; jit->_current_pos= pos+1;
         goto stop;
-        break;
-      case BC_INC11_EIP:
+      BC_CASE(BC_INC11_EIP):
         l_EIP+= 11; jit->_current_pos= pos+1;
         goto stop;
-        break;
-      case BC_INC12_EIP:
+      BC_CASE(BC_INC12_EIP):
         l_EIP+= 12; jit->_current_pos= pos+1;
         goto stop;
-        break;
-      case BC_INC14_EIP:
+      BC_CASE(BC_INC14_EIP):
         l_EIP+= 14; jit->_current_pos= pos+1;
         goto stop;
-        break;
-      case BC_INC1_EIP_NOSTOP: ++l_EIP; break;
-      case BC_INC2_EIP_NOSTOP: l_EIP+= 2; break;
-      case BC_INC3_EIP_NOSTOP: l_EIP+= 3; break;
-      case BC_INC4_EIP_NOSTOP: l_EIP+= 4; break;
-      case BC_INC5_EIP_NOSTOP: l_EIP+= 5; break;
-      case BC_INC6_EIP_NOSTOP: l_EIP+= 6; break;
-      case BC_INC7_EIP_NOSTOP: l_EIP+= 7; break;
-      case BC_INC8_EIP_NOSTOP: l_EIP+= 8; break;
-      case BC_INC9_EIP_NOSTOP: l_EIP+= 9; break;
-      case BC_INC10_EIP_NOSTOP: l_EIP+= 10; break;
-      case BC_INC11_EIP_NOSTOP: l_EIP+= 11; break;
-      case BC_INC12_EIP_NOSTOP: l_EIP+= 12; break;
-      case BC_INC14_EIP_NOSTOP: l_EIP+= 14; break;
-      case BC_WRONG_INST:
+      BC_CASE(BC_INC1_EIP_NOSTOP): ++l_EIP; BC_NEXT;
+      BC_CASE(BC_INC2_EIP_NOSTOP): l_EIP+= 2; BC_NEXT;
+      BC_CASE(BC_INC3_EIP_NOSTOP): l_EIP+= 3; BC_NEXT;
+      BC_CASE(BC_INC4_EIP_NOSTOP): l_EIP+= 4; BC_NEXT;
+      BC_CASE(BC_INC5_EIP_NOSTOP): l_EIP+= 5; BC_NEXT;
+      BC_CASE(BC_INC6_EIP_NOSTOP): l_EIP+= 6; BC_NEXT;
+      BC_CASE(BC_INC7_EIP_NOSTOP): l_EIP+= 7; BC_NEXT;
+      BC_CASE(BC_INC8_EIP_NOSTOP): l_EIP+= 8; BC_NEXT;
+      BC_CASE(BC_INC9_EIP_NOSTOP): l_EIP+= 9; BC_NEXT;
+      BC_CASE(BC_INC10_EIP_NOSTOP): l_EIP+= 10; BC_NEXT;
+      BC_CASE(BC_INC11_EIP_NOSTOP): l_EIP+= 11; BC_NEXT;
+      BC_CASE(BC_INC12_EIP_NOSTOP): l_EIP+= 12; BC_NEXT;
+      BC_CASE(BC_INC14_EIP_NOSTOP): l_EIP+= 14; BC_NEXT;
+      BC_CASE(BC_INC_EIP_DEFER):
+        // Continua sense passar per stop mentre no calga parar.
+        eip_pending+= (uint32_t) p->v[++pos];
+        if ( ++ninsts < budget &&
+             jit->_current_page == p &&
+             !jit->_stop &&
+             !jit->_intr )
+          BC_NEXT;
+        --ninsts;
+        jit->_current_pos= pos+1;
+        goto stop;
+#ifdef __IA32_JIT_SUPERBLOCKS__
+      BC_CASE(BC_SB_JMP32):
+        l_EIP+= eip_pending; eip_pending= 0;
+        offset= l_EIP +
+          ((uint32_t) (p->v[pos+3])) +
+          (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
+        pos+= 3;
+        if ( !jmp_near ( jit, offset ) ) { exception ( jit ); goto stop; }
+        goto sb_next;
+      BC_CASE(BC_SB_JMP16):
+        l_EIP+= eip_pending; eip_pending= 0;
+        offset= l_EIP +
+          ((uint32_t) (p->v[pos+3])) +
+          (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
+        // Si pega la volta ja no és la destinació del superbloc.
+        tmp_bool= offset <= 0xFFFF;
+        pos+= 3;
+        if ( !jmp_near ( jit, offset&0xFFFF ) )
+          { exception ( jit ); goto stop; }
+        if ( !tmp_bool ) { goto_eip ( jit ); goto stop; }
+        goto sb_next;
+      BC_CASE(BC_SB_BRANCH32):
+        l_EIP+= eip_pending; eip_pending= 0;
+        if ( cond )
+          {
+            offset= l_EIP +
+              ((uint32_t) (p->v[pos+3])) +
+              (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
+            if ( !jmp_near ( jit, offset ) ) { exception ( jit ); goto stop; }
+          }
+        else l_EIP+= (uint32_t) (p->v[pos+3]);
+        tmp_bool= true;
+        goto sb_branch;
+      BC_CASE(BC_SB_BRANCH16):
+        l_EIP+= eip_pending; eip_pending= 0;
+        tmp_bool= true;
+        if ( cond )
+          {
+            offset= l_EIP +
+              ((uint32_t) (p->v[pos+3])) +
+              (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
+            tmp_bool= offset <= 0xFFFF;
+            if ( !jmp_near ( jit, offset&0xFFFF ) )
+              { exception ( jit ); goto stop; }
+          }
+        else l_EIP+= (uint32_t) (p->v[pos+3]);
+      sb_branch:
+        // Ix del superbloc si no és el camí esperat.
+        if ( cond != (p->v[pos+5]!=0) || !tmp_bool )
+          {
+            goto_eip_link ( jit, p, p->v[pos+4] );
+            goto stop;
+          }
+        pos+= 5;
+      sb_next:
+        // Continua en el superbloc mentre no calga parar.
+        if ( ++ninsts < budget &&
+             jit->_current_page == p &&
+             !jit->_stop &&
+             !jit->_intr )
+          BC_NEXT;
+        --ninsts;
+        jit->_current_pos= pos+1;
+        goto stop;
+      BC_CASE(BC_SB_GOTO):
+        pos= (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16)) - 1;
+        BC_NEXT;
+      BC_CASE(BC_SB_GUARD):
+        // No és una instrucció, si falla no es compta.
+        l_EIP+= eip_pending; eip_pending= 0;
+        tmp32= P_CS->h.lim.addr + l_EIP;
+        if ( !translate_addr ( jit, &tmp32 ) )
+          {
+            exception ( jit );
+            --ninsts;
+            goto stop;
+          }
+        if ( tmp32 !=
+             (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16)) )
+          {
+            goto_eip ( jit );
+            --ninsts;
+            goto stop;
+          }
+        pos+= 2;
+        BC_NEXT;
+#endif
+      BC_CASE(BC_INC1_EIP_GOTO):
+        l_EIP+= 1+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC2_EIP_GOTO):
+        l_EIP+= 2+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC3_EIP_GOTO):
+        l_EIP+= 3+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC4_EIP_GOTO):
+        l_EIP+= 4+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC5_EIP_GOTO):
+        l_EIP+= 5+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC6_EIP_GOTO):
+        l_EIP+= 6+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC7_EIP_GOTO):
+        l_EIP+= 7+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC8_EIP_GOTO):
+        l_EIP+= 8+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC9_EIP_GOTO):
+        l_EIP+= 9+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC10_EIP_GOTO):
+        l_EIP+= 10+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC11_EIP_GOTO):
+        l_EIP+= 11+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC12_EIP_GOTO):
+        l_EIP+= 12+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_INC14_EIP_GOTO):
+        l_EIP+= 14+eip_pending; eip_pending= 0;
+        goto_eip_link ( jit, p, p->v[pos+2] );
+        goto stop;
+      BC_CASE(BC_WRONG_INST):
         jit->_exception.vec= (int) p->v[++pos];
         jit->_exception.with_selector= false;
         exception ( jit );
         goto stop;
-        break;
-      case BC_INC2_PC_IF_ECX_IS_0: if ( l_ECX == 0 ) pos+= 2; break;
-      case BC_INC2_PC_IF_CX_IS_0: if ( l_CX == 0 ) pos+= 2; break;
-      case BC_INC4_PC_IF_ECX_IS_0: if ( l_ECX == 0 ) pos+= 4; break;
-      case BC_INC4_PC_IF_CX_IS_0: if ( l_CX == 0 ) pos+= 4; break;
-      case BC_INCIMM_PC_IF_CX_IS_0:
+      BC_CASE(BC_INC2_PC_IF_ECX_IS_0): if ( l_ECX == 0 ) pos+= 2; BC_NEXT;
+      BC_CASE(BC_INC2_PC_IF_CX_IS_0): if ( l_CX == 0 ) pos+= 2; BC_NEXT;
+      BC_CASE(BC_INC4_PC_IF_ECX_IS_0): if ( l_ECX == 0 ) pos+= 4; BC_NEXT;
+      BC_CASE(BC_INC4_PC_IF_CX_IS_0): if ( l_CX == 0 ) pos+= 4; BC_NEXT;
+      BC_CASE(BC_INCIMM_PC_IF_CX_IS_0):
         tmp16= p->v[++pos];
         if ( l_CX == 0 ) pos+= (uint32_t) tmp16;
-        break;
-      case BC_INCIMM_PC_IF_ECX_IS_0:
+        BC_NEXT;
+      BC_CASE(BC_INCIMM_PC_IF_ECX_IS_0):
         tmp16= p->v[++pos];
         if ( l_ECX == 0 ) pos+= (uint32_t) tmp16;
-        break;
-      case BC_DEC1_PC_IF_REP32:
+        BC_NEXT;
+      BC_CASE(BC_DEC1_PC_IF_REP32):
         if ( --l_ECX != 0 ) { jit->_current_pos= pos-1; goto stop; }
-        break;
-      case BC_DEC1_PC_IF_REP16:
+        BC_NEXT;
+      BC_CASE(BC_DEC1_PC_IF_REP16):
         if ( --l_CX != 0 ) { jit->_current_pos= pos-1; goto stop; }
-        break;
-      case BC_DEC3_PC_IF_REP32:
+        BC_NEXT;
+      BC_CASE(BC_DEC3_PC_IF_REP32):
         if ( --l_ECX != 0 ) { jit->_current_pos= pos-3; goto stop; }
-        break;
-      case BC_DEC3_PC_IF_REP16:
+        BC_NEXT;
+      BC_CASE(BC_DEC3_PC_IF_REP16):
         if ( --l_CX != 0 ) { jit->_current_pos= pos-3; goto stop; }
-        break;
-      case BC_DECIMM_PC_IF_REPE32:
+        BC_NEXT;
+      BC_CASE(BC_DECIMM_PC_IF_REPE32):
         tmp16= p->v[++pos];
         if ( --l_ECX != 0 && (l_EFLAGS&ZF_FLAG)!=0 )
           { jit->_current_pos= pos-1-((int) tmp16); goto stop;}
-        break;
-      case BC_DECIMM_PC_IF_REPNE32:
+        BC_NEXT;
+      BC_CASE(BC_DECIMM_PC_IF_REPNE32):
         tmp16= p->v[++pos];
         if ( --l_ECX != 0 && (l_EFLAGS&ZF_FLAG)==0 )
           { jit->_current_pos= pos-1-((int) tmp16); goto stop;}
-        break;
-      case BC_DECIMM_PC_IF_REPE16:
+        BC_NEXT;
+      BC_CASE(BC_DECIMM_PC_IF_REPE16):
         tmp16= p->v[++pos];
         if ( --l_CX != 0 && (l_EFLAGS&ZF_FLAG)!=0 )
           { jit->_current_pos= pos-1-((int) tmp16); goto stop;}
-        break;
-      case BC_DECIMM_PC_IF_REPNE16:
+        BC_NEXT;
+      BC_CASE(BC_DECIMM_PC_IF_REPNE16):
         tmp16= p->v[++pos];
         if ( --l_CX != 0 && (l_EFLAGS&ZF_FLAG)==0 )
           { jit->_current_pos= pos-1-((int) tmp16); goto stop;}
-        break;
-      case BC_UNK:
+        BC_NEXT;
+      BC_CASE(BC_UNK):
         fprintf ( FERROR, "[EE] Instrucció desconeguda %X\n", p->v[++pos] );
         exit ( EXIT_FAILURE );
         goto stop;
-        break;
         
         // CARREGA DADES
         // --> Assignació offsets (i selectors)
-      case BC_SET32_IMM_SELECTOR_OFFSET:
+      BC_CASE(BC_SET32_IMM_SELECTOR_OFFSET):
         selector= p->v[pos+1];
         offset= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
         pos+= 3;
-        break;
-      case BC_SET32_IMM_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMM_OFFSET):
         offset= ((uint32_t) p->v[pos+1]) | (((uint32_t) (p->v[pos+2]))<<16);
         pos+= 2;
-        break;
-      case BC_SET16_IMM_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_SET16_IMM_SELECTOR_OFFSET):
         selector= p->v[++pos];
         offset= (uint32_t) (p->v[++pos]);
-        break;
-      case BC_SET16_IMM_OFFSET: offset= (uint32_t) (p->v[++pos]); break;
-      case BC_SET16_IMM_PORT: port= p->v[++pos]; break;
-      case BC_SET32_EAX_OFFSET: offset= l_EAX; break;
-      case BC_SET32_ECX_OFFSET: offset= l_ECX; break;
-      case BC_SET32_EDX_OFFSET: offset= l_EDX; break;
-      case BC_SET32_EBX_OFFSET: offset= l_EBX; break;
-      case BC_SET32_EBX_AL_OFFSET: offset= l_EBX + ((uint32_t) l_AL); break;
-      case BC_SET32_EBP_OFFSET: offset= l_EBP; break;
-      case BC_SET32_ESI_OFFSET: offset= l_ESI; break;
-      case BC_SET32_EDI_OFFSET: offset= l_EDI; break;
-      case BC_SET32_ESP_OFFSET: offset= l_ESP; break;
-      case BC_SET16_SI_OFFSET: offset= (uint32_t) l_SI; break;
-      case BC_SET16_DI_OFFSET: offset= (uint32_t) l_DI; break;
-      case BC_SET16_BP_OFFSET: offset= (uint32_t) l_BP; break;
-      case BC_SET16_BP_SI_OFFSET: offset= (uint32_t) (l_BP+l_SI)&0xFFFF; break;
-      case BC_SET16_BP_DI_OFFSET: offset= (uint32_t) (l_BP+l_DI)&0xFFFF; break;
-      case BC_SET16_BX_OFFSET: offset= (uint32_t) l_BX; break;
-      case BC_SET16_BX_AL_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_SET16_IMM_OFFSET): offset= (uint32_t) (p->v[++pos]); BC_NEXT;
+      BC_CASE(BC_SET16_IMM_PORT): port= p->v[++pos]; BC_NEXT;
+      BC_CASE(BC_SET32_EAX_OFFSET): offset= l_EAX; BC_NEXT;
+      BC_CASE(BC_SET32_ECX_OFFSET): offset= l_ECX; BC_NEXT;
+      BC_CASE(BC_SET32_EDX_OFFSET): offset= l_EDX; BC_NEXT;
+      BC_CASE(BC_SET32_EBX_OFFSET): offset= l_EBX; BC_NEXT;
+      BC_CASE(BC_SET32_EBX_AL_OFFSET): offset= l_EBX + ((uint32_t) l_AL); BC_NEXT;
+      BC_CASE(BC_SET32_EBP_OFFSET): offset= l_EBP; BC_NEXT;
+      BC_CASE(BC_SET32_ESI_OFFSET): offset= l_ESI; BC_NEXT;
+      BC_CASE(BC_SET32_EDI_OFFSET): offset= l_EDI; BC_NEXT;
+      BC_CASE(BC_SET32_ESP_OFFSET): offset= l_ESP; BC_NEXT;
+      BC_CASE(BC_SET16_SI_OFFSET): offset= (uint32_t) l_SI; BC_NEXT;
+      BC_CASE(BC_SET16_DI_OFFSET): offset= (uint32_t) l_DI; BC_NEXT;
+      BC_CASE(BC_SET16_BP_OFFSET): offset= (uint32_t) l_BP; BC_NEXT;
+      BC_CASE(BC_SET16_BP_SI_OFFSET): offset= (uint32_t) (l_BP+l_SI)&0xFFFF; BC_NEXT;
+      BC_CASE(BC_SET16_BP_DI_OFFSET): offset= (uint32_t) (l_BP+l_DI)&0xFFFF; BC_NEXT;
+      BC_CASE(BC_SET16_BX_OFFSET): offset= (uint32_t) l_BX; BC_NEXT;
+      BC_CASE(BC_SET16_BX_AL_OFFSET):
         offset= (uint32_t) (l_BX + (uint16_t) l_AL);
-        break;
-      case BC_SET16_BX_SI_OFFSET: offset= (uint32_t) (l_BX+l_SI)&0xFFFF; break;
-      case BC_SET16_BX_DI_OFFSET: offset= (uint32_t) (l_BX+l_DI)&0xFFFF; break;
-      case BC_SET16_DX_PORT: port= l_DX; break;
-      case BC_ADD32_BITOFFSETOP1_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_SET16_BX_SI_OFFSET): offset= (uint32_t) (l_BX+l_SI)&0xFFFF; BC_NEXT;
+      BC_CASE(BC_SET16_BX_DI_OFFSET): offset= (uint32_t) (l_BX+l_DI)&0xFFFF; BC_NEXT;
+      BC_CASE(BC_SET16_DX_PORT): port= l_DX; BC_NEXT;
+      BC_CASE(BC_ADD32_BITOFFSETOP1_OFFSET):
         offset+= (uint32_t) (((int32_t) (op32[1]>>5))<<2);
-        break;
-      case BC_ADD32_IMM_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_ADD32_IMM_OFFSET):
         offset+= (((uint32_t) p->v[pos+1]) | (((uint32_t) (p->v[pos+2]))<<16));
         pos+= 2;
-        break;
-      case BC_ADD32_EAX_OFFSET: offset+= l_EAX; break;
-      case BC_ADD32_ECX_OFFSET: offset+= l_ECX; break;
-      case BC_ADD32_EDX_OFFSET: offset+= l_EDX; break;
-      case BC_ADD32_EBX_OFFSET: offset+= l_EBX; break;
-      case BC_ADD32_EBP_OFFSET: offset+= l_EBP; break;
-      case BC_ADD32_ESI_OFFSET: offset+= l_ESI; break;
-      case BC_ADD32_EDI_OFFSET: offset+= l_EDI; break;
-      case BC_ADD32_EAX_2_OFFSET: offset+= (l_EAX<<1); break;
-      case BC_ADD32_ECX_2_OFFSET: offset+= (l_ECX<<1); break;
-      case BC_ADD32_EDX_2_OFFSET: offset+= (l_EDX<<1); break;
-      case BC_ADD32_EBX_2_OFFSET: offset+= (l_EBX<<1); break;
-      case BC_ADD32_EBP_2_OFFSET: offset+= (l_EBP<<1); break;
-      case BC_ADD32_ESI_2_OFFSET: offset+= (l_ESI<<1); break;
-      case BC_ADD32_EDI_2_OFFSET: offset+= (l_EDI<<1); break;
-      case BC_ADD32_EAX_4_OFFSET: offset+= (l_EAX<<2); break;
-      case BC_ADD32_ECX_4_OFFSET: offset+= (l_ECX<<2); break;
-      case BC_ADD32_EDX_4_OFFSET: offset+= (l_EDX<<2); break;
-      case BC_ADD32_EBX_4_OFFSET: offset+= (l_EBX<<2); break;
-      case BC_ADD32_EBP_4_OFFSET: offset+= (l_EBP<<2); break;
-      case BC_ADD32_ESI_4_OFFSET: offset+= (l_ESI<<2); break;
-      case BC_ADD32_EDI_4_OFFSET: offset+= (l_EDI<<2); break;
-      case BC_ADD32_EAX_8_OFFSET: offset+= (l_EAX<<3); break;
-      case BC_ADD32_ECX_8_OFFSET: offset+= (l_ECX<<3); break;
-      case BC_ADD32_EDX_8_OFFSET: offset+= (l_EDX<<3); break;
-      case BC_ADD32_EBX_8_OFFSET: offset+= (l_EBX<<3); break;
-      case BC_ADD32_EBP_8_OFFSET: offset+= (l_EBP<<3); break;
-      case BC_ADD32_ESI_8_OFFSET: offset+= (l_ESI<<3); break;
-      case BC_ADD32_EDI_8_OFFSET: offset+= (l_EDI<<3); break;
-      case BC_ADD16_IMM_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_ADD32_EAX_OFFSET): offset+= l_EAX; BC_NEXT;
+      BC_CASE(BC_ADD32_ECX_OFFSET): offset+= l_ECX; BC_NEXT;
+      BC_CASE(BC_ADD32_EDX_OFFSET): offset+= l_EDX; BC_NEXT;
+      BC_CASE(BC_ADD32_EBX_OFFSET): offset+= l_EBX; BC_NEXT;
+      BC_CASE(BC_ADD32_EBP_OFFSET): offset+= l_EBP; BC_NEXT;
+      BC_CASE(BC_ADD32_ESI_OFFSET): offset+= l_ESI; BC_NEXT;
+      BC_CASE(BC_ADD32_EDI_OFFSET): offset+= l_EDI; BC_NEXT;
+      BC_CASE(BC_ADD32_EAX_2_OFFSET): offset+= (l_EAX<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_ECX_2_OFFSET): offset+= (l_ECX<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_EDX_2_OFFSET): offset+= (l_EDX<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_EBX_2_OFFSET): offset+= (l_EBX<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_EBP_2_OFFSET): offset+= (l_EBP<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_ESI_2_OFFSET): offset+= (l_ESI<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_EDI_2_OFFSET): offset+= (l_EDI<<1); BC_NEXT;
+      BC_CASE(BC_ADD32_EAX_4_OFFSET): offset+= (l_EAX<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_ECX_4_OFFSET): offset+= (l_ECX<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_EDX_4_OFFSET): offset+= (l_EDX<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_EBX_4_OFFSET): offset+= (l_EBX<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_EBP_4_OFFSET): offset+= (l_EBP<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_ESI_4_OFFSET): offset+= (l_ESI<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_EDI_4_OFFSET): offset+= (l_EDI<<2); BC_NEXT;
+      BC_CASE(BC_ADD32_EAX_8_OFFSET): offset+= (l_EAX<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_ECX_8_OFFSET): offset+= (l_ECX<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_EDX_8_OFFSET): offset+= (l_EDX<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_EBX_8_OFFSET): offset+= (l_EBX<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_EBP_8_OFFSET): offset+= (l_EBP<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_ESI_8_OFFSET): offset+= (l_ESI<<3); BC_NEXT;
+      BC_CASE(BC_ADD32_EDI_8_OFFSET): offset+= (l_EDI<<3); BC_NEXT;
+      BC_CASE(BC_ADD16_IMM_OFFSET):
         offset+= (uint32_t) ((int32_t) ((int16_t) p->v[++pos]));
-        break;
-      case BC_ADD16_IMM_OFFSET16:
+        BC_NEXT;
+      BC_CASE(BC_ADD16_IMM_OFFSET16):
         offset= (offset +
                  ((uint32_t) ((int32_t) ((int16_t) p->v[++pos]))))&0xFFFF;
-        break;
+        BC_NEXT;
         // --> Condicions
-      case BC_SET_A_COND: cond= ((l_EFLAGS&(ZF_FLAG|CF_FLAG))==0); break;
-      case BC_SET_AE_COND: cond= ((l_EFLAGS&(CF_FLAG))==0); break;
-      case BC_SET_B_COND: cond= ((l_EFLAGS&CF_FLAG)!=0); break;
-      case BC_SET_CXZ_COND: cond= (l_CX==0); break;
-      case BC_SET_E_COND: cond= ((l_EFLAGS&ZF_FLAG)!=0); break;
-      case BC_SET_ECXZ_COND: cond= (l_ECX==0); break;
-      case BC_SET_G_COND:
-        cond=
-          ((l_EFLAGS&ZF_FLAG)==0) &&
-          !(((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0));
-        break;
-      case BC_SET_GE_COND:
-        cond= !(((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0));
-        break;
-      case BC_SET_L_COND:
-        cond= (((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0));
-        break;
-      case BC_SET_NA_COND: cond= ((l_EFLAGS&(ZF_FLAG|CF_FLAG))!=0); break;
-      case BC_SET_NE_COND: cond= ((l_EFLAGS&ZF_FLAG)==0); break;
-      case BC_SET_NG_COND:
-        cond=
-          ((l_EFLAGS&ZF_FLAG)!=0) ||
-          (((l_EFLAGS&SF_FLAG)==0)^((l_EFLAGS&OF_FLAG)==0));
-        break;
-      case BC_SET_NO_COND: cond= ((l_EFLAGS&OF_FLAG)==0); break;
-      case BC_SET_NS_COND: cond= ((l_EFLAGS&SF_FLAG)==0); break;
-      case BC_SET_O_COND: cond= ((l_EFLAGS&OF_FLAG)!=0); break;
-      case BC_SET_P_COND: cond= ((l_EFLAGS&PF_FLAG)!=0); break;
-      case BC_SET_PO_COND: cond= ((l_EFLAGS&PF_FLAG)==0); break;
-      case BC_SET_S_COND: cond= ((l_EFLAGS&SF_FLAG)!=0); break;
-      case BC_SET_DEC_ECX_NOT_ZERO_COND: --l_ECX; cond= (l_ECX!=0); break;
-      case BC_SET_DEC_ECX_NOT_ZERO_AND_ZF_COND:
+      BC_CASE(BC_SET_A_COND): cond= COND_A; BC_NEXT;
+      BC_CASE(BC_SET_AE_COND): cond= COND_AE; BC_NEXT;
+      BC_CASE(BC_SET_B_COND): cond= COND_B; BC_NEXT;
+      BC_CASE(BC_SET_CXZ_COND): cond= COND_CXZ; BC_NEXT;
+      BC_CASE(BC_SET_E_COND): cond= COND_E; BC_NEXT;
+      BC_CASE(BC_SET_ECXZ_COND): cond= COND_ECXZ; BC_NEXT;
+      BC_CASE(BC_SET_G_COND): cond= COND_G; BC_NEXT;
+      BC_CASE(BC_SET_GE_COND): cond= COND_GE; BC_NEXT;
+      BC_CASE(BC_SET_L_COND): cond= COND_L; BC_NEXT;
+      BC_CASE(BC_SET_NA_COND): cond= COND_NA; BC_NEXT;
+      BC_CASE(BC_SET_NE_COND): cond= COND_NE; BC_NEXT;
+      BC_CASE(BC_SET_NG_COND): cond= COND_NG; BC_NEXT;
+      BC_CASE(BC_SET_NO_COND): cond= COND_NO; BC_NEXT;
+      BC_CASE(BC_SET_NS_COND): cond= COND_NS; BC_NEXT;
+      BC_CASE(BC_SET_O_COND): cond= COND_O; BC_NEXT;
+      BC_CASE(BC_SET_P_COND): cond= COND_P; BC_NEXT;
+      BC_CASE(BC_SET_PO_COND): cond= COND_PO; BC_NEXT;
+      BC_CASE(BC_SET_S_COND): cond= COND_S; BC_NEXT;
+      BC_CASE(BC_SET_DEC_ECX_NOT_ZERO_COND): --l_ECX; cond= (l_ECX!=0); BC_NEXT;
+      BC_CASE(BC_SET_DEC_ECX_NOT_ZERO_AND_ZF_COND):
         --l_ECX;
         cond= (l_ECX!=0) && ((l_EFLAGS&ZF_FLAG)!=0);
-        break;
-      case BC_SET_DEC_ECX_NOT_ZERO_AND_NOT_ZF_COND:
+        BC_NEXT;
+      BC_CASE(BC_SET_DEC_ECX_NOT_ZERO_AND_NOT_ZF_COND):
         --l_ECX;
         cond= (l_ECX!=0) && ((l_EFLAGS&ZF_FLAG)==0);
-        break;
-      case BC_SET_DEC_CX_NOT_ZERO_COND: --l_CX; cond= (l_CX!=0); break;
-      case BC_SET_DEC_CX_NOT_ZERO_AND_ZF_COND:
+        BC_NEXT;
+      BC_CASE(BC_SET_DEC_CX_NOT_ZERO_COND): --l_CX; cond= (l_CX!=0); BC_NEXT;
+      BC_CASE(BC_SET_DEC_CX_NOT_ZERO_AND_ZF_COND):
         --l_CX;
         cond= (l_CX!=0) && ((l_EFLAGS&ZF_FLAG)!=0);
-        break;
-      case BC_SET_DEC_CX_NOT_ZERO_AND_NOT_ZF_COND:
+        BC_NEXT;
+      BC_CASE(BC_SET_DEC_CX_NOT_ZERO_AND_NOT_ZF_COND):
         --l_CX;
         cond= (l_CX!=0) && ((l_EFLAGS&ZF_FLAG)==0);
-        break;
+        BC_NEXT;
         // --> Comptador
-      case BC_SET_1_COUNT: count= 1; break;
-      case BC_SET_CL_COUNT: count= (l_CL&0x1F); break;
-      case BC_SET_CL_COUNT_NOMOD: count= l_CL; break;
-      case BC_SET_IMM_COUNT: count= p->v[++pos]; break;
+      BC_CASE(BC_SET_1_COUNT): count= 1; BC_NEXT;
+      BC_CASE(BC_SET_CL_COUNT): count= (l_CL&0x1F); BC_NEXT;
+      BC_CASE(BC_SET_CL_COUNT_NOMOD): count= l_CL; BC_NEXT;
+      BC_CASE(BC_SET_IMM_COUNT): count= p->v[++pos]; BC_NEXT;
         // --> EFLAGS
-      case BC_SET32_AD_OF_EFLAGS:
+      BC_CASE(BC_SET32_AD_OF_EFLAGS):
         if (((~(op32[0]^op32[1]))&(op32[0]^res32)&0x80000000))
           l_EFLAGS|=OF_FLAG;
         else l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET32_AD_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_AD_AF_EFLAGS):
         if ( (((op32[0]^op32[1])^res32)&0x10) ) l_EFLAGS|= AF_FLAG;
         else                                    l_EFLAGS&= ~AF_FLAG;
-        break;
-      case BC_SET32_AD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_AD_CF_EFLAGS):
         if ( (((op32[0]&op32[1]) |
                ((op32[0]|op32[1])&(~res32)))&0x80000000) )
           l_EFLAGS|= CF_FLAG;
         else l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET32_MUL_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_MUL_CFOF_EFLAGS):
         if ( ((res32&0x80000000)!=0)^((res64&0x8000000000000000)!=0) )
           l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET32_MUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_MUL1_CFOF_EFLAGS):
         if ( l_EDX != 0 ) l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else              l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET32_IMUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMUL1_CFOF_EFLAGS):
         if ( (((uint64_t) ((int64_t) ((int32_t) l_EAX)))!=res64 ) )
           l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET32_NEG_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_NEG_CF_EFLAGS):
         if ( op32[1] == 0 ) l_EFLAGS&= ~CF_FLAG;
         else                l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET32_RCL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RCL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op32[0]&0x80000000)!=0)^((op32[0]&0x40000000)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_RCL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RCL_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op32[0]>>(32-count))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                    l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_RCR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RCR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op32[0]&0x80000000)!=0)^((l_EFLAGS&CF_FLAG)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_RCR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RCR_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op32[0]>>(count-1))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                   l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_ROL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_ROL_CF_EFLAGS):
         if ( (res32&0x01) != 0 ) l_EFLAGS|= CF_FLAG;
         else                     l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET32_ROR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_ROR_OF_EFLAGS):
         if ( count == 1 )
           {
             if (((op32[0]&0x80000000)^((op32[0]&0x01)<<31))!=0)
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_ROR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_ROR_CF_EFLAGS):
         if ( (res32&0x80000000) != 0 ) l_EFLAGS|= CF_FLAG;
         else                           l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET32_SAR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SAR_OF_EFLAGS):
         if ( count == 1 ) { l_EFLAGS&= ~OF_FLAG; }
-        break;
-      case BC_SET32_SAR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SAR_CF_EFLAGS):
         if ( count == 32 )
           {
             if ( op32[0]&0x80000000 ) l_EFLAGS|= CF_FLAG;
@@ -6456,190 +6888,237 @@ exec_inst (
             if ( op32[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_SHIFT_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHIFT_SF_EFLAGS):
         if ( count > 0 && count <= 32 )
           {
             if ( res32&0x80000000 ) l_EFLAGS|= SF_FLAG;
             else                    l_EFLAGS&= ~SF_FLAG;
           }
-        break;
-      case BC_SET32_SHIFT_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHIFT_ZF_EFLAGS):
         if ( count > 0 && count <= 32 )
           {
             if ( res32 == 0 ) l_EFLAGS|= ZF_FLAG;
             else              l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_SET32_SHIFT_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHIFT_PF_EFLAGS):
         if ( count > 0 && count <= 32 )
           {
             if ( PFLAG[(uint8_t) (res32&0xff)] ) l_EFLAGS|= PF_FLAG;
             else                                 l_EFLAGS&= ~PF_FLAG;
           }
-        break;
-      case BC_SET32_SHL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op32[0]&0x80000000)^((op32[0]&0x40000000)<<1))!=0 )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_SHL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHL_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( op32[0]&(0x80000000>>(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                                   l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_SHLD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHLD_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( (res32^op32[0])&0x80000000 ) l_EFLAGS|= OF_FLAG;
             else                              l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_SHLD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHLD_CF_EFLAGS):
         if ( count > 0 && count <= 32 )
           {
             if ( op32[0]&(1<<(32-count)) ) l_EFLAGS|= CF_FLAG;
             else                           l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_SHR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( op32[0]&0x80000000 ) l_EFLAGS|= OF_FLAG;
             else                      l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_SHR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHR_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( op32[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_SHRD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHRD_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( (res32^op32[0])&0x80000000 ) l_EFLAGS|= OF_FLAG;
             else                              l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET32_SHRD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SHRD_CF_EFLAGS):
         if ( count > 0 && count <= 32 )
           {
             if ( op32[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET32_SB_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SB_OF_EFLAGS):
         if ((((op32[0]^op32[1])&(op32[0]^res32))&0x80000000)) l_EFLAGS|=OF_FLAG;
         else                                                l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET32_SB_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SB_AF_EFLAGS):
         if ( (((op32[0]^(~op32[1]))^res32)&0x10) ) l_EFLAGS&= ~AF_FLAG;
         else                                       l_EFLAGS|= AF_FLAG;
-        break;
-      case BC_SET32_SB_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SB_CF_EFLAGS):
         if ( (((op32[0]&(~op32[1])) |
                ((op32[0]|(~op32[1]))&(~res32)))&0x80000000) )
           l_EFLAGS&= ~CF_FLAG;
         else l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET32_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SF_EFLAGS):
         if ( res32&0x80000000 ) l_EFLAGS|= SF_FLAG;
         else                    l_EFLAGS&= ~SF_FLAG;
-        break;
-      case BC_SET32_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_ZF_EFLAGS):
         if ( res32 == 0 ) l_EFLAGS|= ZF_FLAG;
         else              l_EFLAGS&= ~ZF_FLAG;
-        break;
-      case BC_SET32_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_PF_EFLAGS):
         if ( PFLAG[(uint8_t) (res32&0xff)] ) l_EFLAGS|= PF_FLAG;
         else                                 l_EFLAGS&= ~PF_FLAG;
-        break;
-      case BC_SET16_AD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_AD_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_AD, 0x80000000, op32[0], op32[1],
+                         res32, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res32&0xff)] ? PF_FLAG : 0;
+        if ( (~(op32[0]^op32[1]))&(op32[0]^res32)&0x80000000 )
+          flags|= OF_FLAG;
+        if ( res32&0x80000000 ) flags|= SF_FLAG;
+        if ( res32 == 0 ) flags|= ZF_FLAG;
+        if ( ((op32[0]^op32[1])^res32)&0x10 ) flags|= AF_FLAG;
+        if ( ((op32[0]&op32[1]) | ((op32[0]|op32[1])&(~res32)))&0x80000000 )
+          flags|= CF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET32_SB_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_SB, 0x80000000, op32[0], op32[1],
+                         res32, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res32&0xff)] ? PF_FLAG : 0;
+        if ( ((op32[0]^op32[1])&(op32[0]^res32))&0x80000000 )
+          flags|= OF_FLAG;
+        if ( res32&0x80000000 ) flags|= SF_FLAG;
+        if ( res32 == 0 ) flags|= ZF_FLAG;
+        if ( !(((op32[0]^(~op32[1]))^res32)&0x10) ) flags|= AF_FLAG;
+        if ( !(((op32[0]&(~op32[1])) |
+                ((op32[0]|(~op32[1]))&(~res32)))&0x80000000) )
+          flags|= CF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET32_LOP_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_LOP, 0x80000000, op32[0], op32[1],
+                         res32, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res32&0xff)] ? PF_FLAG : 0;
+        if ( res32&0x80000000 ) flags|= SF_FLAG;
+        if ( res32 == 0 ) flags|= ZF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET16_AD_OF_EFLAGS):
         if (((~(op16[0]^op16[1]))&(op16[0]^res16)&0x8000))
           l_EFLAGS|=OF_FLAG;
         else l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET16_AD_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_AD_AF_EFLAGS):
         if ( (((op16[0]^op16[1])^res16)&0x10) ) l_EFLAGS|= AF_FLAG;
         else                                    l_EFLAGS&= ~AF_FLAG;
-        break;
-      case BC_SET16_AD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_AD_CF_EFLAGS):
         if ( (((op16[0]&op16[1]) |
                ((op16[0]|op16[1])&(~res16)))&0x8000) )
           l_EFLAGS|= CF_FLAG;
         else l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET16_MUL_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_MUL_CFOF_EFLAGS):
         if ( ((res16&0x8000)!=0)^((res32&0x80000000)!=0) )
           l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET16_MUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_MUL1_CFOF_EFLAGS):
         if ( l_DX != 0 ) l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else             l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET16_IMUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_IMUL1_CFOF_EFLAGS):
         if ( (((uint32_t) ((int32_t) ((int16_t) l_AX)))!=res32 ) )
           l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET16_NEG_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_NEG_CF_EFLAGS):
         if ( op16[1] == 0 ) l_EFLAGS&= ~CF_FLAG;
         else                l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET16_RCL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RCL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op16[0]&0x8000)!=0)^((op16[0]&0x4000)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_RCL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RCL_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op16[0]>>(16-count))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                    l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_RCR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RCR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op16[0]&0x8000)!=0)^((l_EFLAGS&CF_FLAG)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_RCR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RCR_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op16[0]>>(count-1))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                   l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_ROL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_ROL_CF_EFLAGS):
         if ( (res16&0x01) != 0 ) l_EFLAGS|= CF_FLAG;
         else                     l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET16_ROR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_ROR_OF_EFLAGS):
         if ( count == 1 )
           {
             if (((op16[0]&0x8000)^((op16[0]&0x01)<<15))!=0) l_EFLAGS|= OF_FLAG;
             else                                            l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_ROR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_ROR_CF_EFLAGS):
         if ( (res16&0x8000) != 0 ) l_EFLAGS|= CF_FLAG;
         else                       l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET16_SAR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SAR_CF_EFLAGS):
         if ( count >= 16 )
           {
             if ( op16[0]&0x8000 ) l_EFLAGS|= CF_FLAG;
@@ -6650,140 +7129,190 @@ exec_inst (
             if ( op16[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_SHIFT_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHIFT_SF_EFLAGS):
         if ( count != 0 )
           {
             if ( res16&0x8000 ) l_EFLAGS|= SF_FLAG;
             else                l_EFLAGS&= ~SF_FLAG;
           }
-        break;
-      case BC_SET16_SHIFT_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHIFT_ZF_EFLAGS):
         if ( count != 0 )
           {
             if ( res16 == 0 ) l_EFLAGS|= ZF_FLAG;
             else              l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_SET16_SHIFT_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHIFT_PF_EFLAGS):
         if ( count != 0 )
           {
             if ( PFLAG[(uint8_t) (res16&0xff)] ) l_EFLAGS|= PF_FLAG;
             else                                 l_EFLAGS&= ~PF_FLAG;
           }
-        break;
-      case BC_SET16_SHL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op16[0]&0x8000)^((op16[0]&0x4000)<<1))!=0 )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_SHL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHL_CF_EFLAGS):
         if ( count > 16 ) l_EFLAGS&= ~CF_FLAG;
         else if ( count > 0 )
           {
             if ( op16[0]&(0x8000>>(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                               l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_SHLD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHLD_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( (res16^op16[0])&0x8000 ) l_EFLAGS|= OF_FLAG;
             else                          l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_SHLD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHLD_CF_EFLAGS):
         if ( count > 0 && count <= 16 )
           {
             if ( op16[0]&(1<<(16-count)) ) l_EFLAGS|= CF_FLAG;
             else                           l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_SHR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( op16[0]&0x8000 ) l_EFLAGS|= OF_FLAG;
             else                  l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_SHR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHR_CF_EFLAGS):
         if ( count > 16 ) l_EFLAGS&= ~CF_FLAG;
         else if ( count > 0 )
           {
             if ( op16[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_SHRD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHRD_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( (res16^op16[0])&0x8000 ) l_EFLAGS|= OF_FLAG;
             else                          l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET16_SHRD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SHRD_CF_EFLAGS):
         if ( count > 0 && count <= 16 )
           {
             if ( op16[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                          l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET16_SB_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SB_OF_EFLAGS):
         if ((((op16[0]^op16[1])&(op16[0]^res16))&0x8000)) l_EFLAGS|= OF_FLAG;
         else                                              l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET16_SB_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SB_AF_EFLAGS):
         if ( (((op16[0]^(~op16[1]))^res16)&0x10) ) l_EFLAGS&= ~AF_FLAG;
         else                                       l_EFLAGS|= AF_FLAG;
-        break;
-      case BC_SET16_SB_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SB_CF_EFLAGS):
         if ( (((op16[0]&(~op16[1])) | ((op16[0]|(~op16[1]))&(~res16)))&0x8000) )
           l_EFLAGS&= ~CF_FLAG;
         else l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET16_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_SF_EFLAGS):
         if ( res16&0x8000 ) l_EFLAGS|= SF_FLAG;
         else                l_EFLAGS&= ~SF_FLAG;
-        break;
-      case BC_SET16_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_ZF_EFLAGS):
         if ( res16 == 0 ) l_EFLAGS|= ZF_FLAG;
         else              l_EFLAGS&= ~ZF_FLAG;
-        break;
-      case BC_SET16_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_AD_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_AD, 0x8000,
+                         (uint32_t) op16[0], (uint32_t) op16[1],
+                         (uint32_t) res16, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res16&0xff)] ? PF_FLAG : 0;
+        if ( (~(op16[0]^op16[1]))&(op16[0]^res16)&0x8000 )
+          flags|= OF_FLAG;
+        if ( res16&0x8000 ) flags|= SF_FLAG;
+        if ( res16 == 0 ) flags|= ZF_FLAG;
+        if ( ((op16[0]^op16[1])^res16)&0x10 ) flags|= AF_FLAG;
+        if ( ((op16[0]&op16[1]) | ((op16[0]|op16[1])&(~res16)))&0x8000 )
+          flags|= CF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET16_SB_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_SB, 0x8000,
+                         (uint32_t) op16[0], (uint32_t) op16[1],
+                         (uint32_t) res16, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res16&0xff)] ? PF_FLAG : 0;
+        if ( ((op16[0]^op16[1])&(op16[0]^res16))&0x8000 )
+          flags|= OF_FLAG;
+        if ( res16&0x8000 ) flags|= SF_FLAG;
+        if ( res16 == 0 ) flags|= ZF_FLAG;
+        if ( !(((op16[0]^(~op16[1]))^res16)&0x10) ) flags|= AF_FLAG;
+        if ( !(((op16[0]&(~op16[1])) |
+                ((op16[0]|(~op16[1]))&(~res16)))&0x8000) )
+          flags|= CF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET16_LOP_EFLAGS):
+#ifdef __IA32_JIT_LAZY_FLAGS__
+        lazy_flags_set ( jit, LAZY_LOP, 0x8000,
+                         (uint32_t) op16[0], (uint32_t) op16[1],
+                         (uint32_t) res16, p->v[pos+1] );
+#else
+        flags= PFLAG[(uint8_t) (res16&0xff)] ? PF_FLAG : 0;
+        if ( res16&0x8000 ) flags|= SF_FLAG;
+        if ( res16 == 0 ) flags|= ZF_FLAG;
+        l_EFLAGS= (l_EFLAGS&(~p->v[pos+1])) | (flags&p->v[pos+1]);
+#endif
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET16_PF_EFLAGS):
         if ( PFLAG[(uint8_t) (res16&0xff)] ) l_EFLAGS|= PF_FLAG;
         else                                 l_EFLAGS&= ~PF_FLAG;
-        break;
-      case BC_SET8_AD_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_AD_OF_EFLAGS):
         if (((~(op8[0]^op8[1]))&(op8[0]^res8)&0x80))
           l_EFLAGS|=OF_FLAG;
         else l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET8_AD_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_AD_AF_EFLAGS):
         if ( (((op8[0]^op8[1])^res8)&0x10) ) l_EFLAGS|= AF_FLAG;
         else                                 l_EFLAGS&= ~AF_FLAG;
-        break;
-      case BC_SET8_AD_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_AD_CF_EFLAGS):
         if ( (((op8[0]&op8[1]) | ((op8[0]|op8[1])&(~res8)))&0x80) )
           l_EFLAGS|= CF_FLAG;
         else l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET8_MUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_MUL1_CFOF_EFLAGS):
         if ( (l_AX&0xFF00) != 0 ) l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else                      l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET8_IMUL1_CFOF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_IMUL1_CFOF_EFLAGS):
         if ( (((uint16_t) ((int16_t) ((int8_t) (l_AX&0xFF))))!=res16 ) )
           l_EFLAGS|= (CF_FLAG|OF_FLAG);
         else l_EFLAGS&= ~(CF_FLAG|OF_FLAG);
-        break;
-      case BC_SET8_NEG_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_NEG_CF_EFLAGS):
         if ( op8[1] == 0 ) l_EFLAGS&= ~CF_FLAG;
         else               l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET8_SAR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SAR_CF_EFLAGS):
         if ( count >= 8 )
           {
             if ( op8[0]&0x80 ) l_EFLAGS|= CF_FLAG;
@@ -6794,356 +7323,356 @@ exec_inst (
             if ( op8[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                         l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET8_RCL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_RCL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op8[0]&0x80)!=0)^((op8[0]&0x40)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET8_RCL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_RCL_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op8[0]>>(8-count))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                  l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET8_RCR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_RCR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op8[0]&0x80)!=0)^((l_EFLAGS&CF_FLAG)!=0) )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET8_RCR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_RCR_CF_EFLAGS):
         if ( count > 0 )
           {
             if ( ((op8[0]>>(count-1))&0x1) != 0 ) l_EFLAGS|= CF_FLAG;
             else                                  l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET8_ROL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_ROL_CF_EFLAGS):
         if ( (res8&0x01) != 0 ) l_EFLAGS|= CF_FLAG;
         else                    l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET8_ROR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_ROR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op8[0]&0x80)^((op8[0]&0x01)<<7))!=0 ) l_EFLAGS|= OF_FLAG;
             else                                         l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET8_ROR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_ROR_CF_EFLAGS):
         if ( (res8&0x80) != 0 ) l_EFLAGS|= CF_FLAG;
         else                    l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_SET8_SHIFT_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHIFT_SF_EFLAGS):
         if ( count != 0 )
           {
             if ( res8&0x80 ) l_EFLAGS|= SF_FLAG;
             else             l_EFLAGS&= ~SF_FLAG;
           }
-        break;
-      case BC_SET8_SHIFT_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHIFT_ZF_EFLAGS):
         if ( count != 0 )
           {
             if ( res8 == 0 ) l_EFLAGS|= ZF_FLAG;
             else             l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_SET8_SHIFT_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHIFT_PF_EFLAGS):
         if ( count != 0 )
           {
             if ( PFLAG[res8] ) l_EFLAGS|= PF_FLAG;
             else               l_EFLAGS&= ~PF_FLAG;
           }
-        break;
-      case BC_SET8_SHL_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHL_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( ((op8[0]&0x80)^((op8[0]&0x40)<<1))!=0 )
               l_EFLAGS|= OF_FLAG;
             else l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET8_SHL_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHL_CF_EFLAGS):
         if ( count > 8 ) l_EFLAGS&= ~CF_FLAG;
         else if ( count > 0 )
           {
             if ( op8[0]&(0x80>>(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                            l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET8_SHR_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHR_OF_EFLAGS):
         if ( count == 1 )
           {
             if ( op8[0]&0x80 ) l_EFLAGS|= OF_FLAG;
             else               l_EFLAGS&= ~OF_FLAG;
           }
-        break;
-      case BC_SET8_SHR_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SHR_CF_EFLAGS):
         if ( count > 8 ) l_EFLAGS&= ~CF_FLAG;
         else if ( count > 0 )
           {
             if ( op8[0]&(1<<(count-1)) ) l_EFLAGS|= CF_FLAG;
             else                         l_EFLAGS&= ~CF_FLAG;
           }
-        break;
-      case BC_SET8_SB_OF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SB_OF_EFLAGS):
         if ((((op8[0]^op8[1])&(op8[0]^res8))&0x80)) l_EFLAGS|=OF_FLAG;
         else                                        l_EFLAGS&= ~OF_FLAG;
-        break;
-      case BC_SET8_SB_AF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SB_AF_EFLAGS):
         if ( (((op8[0]^(~op8[1]))^res8)&0x10) ) l_EFLAGS&= ~AF_FLAG;
         else                                    l_EFLAGS|= AF_FLAG;
-        break;
-      case BC_SET8_SB_CF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SB_CF_EFLAGS):
         if ( (((op8[0]&(~op8[1])) |
                ((op8[0]|(~op8[1]))&(~res8)))&0x80) )
           l_EFLAGS&= ~CF_FLAG;
         else l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_SET8_SF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_SF_EFLAGS):
         if ( res8&0x80 ) l_EFLAGS|= SF_FLAG;
         else             l_EFLAGS&= ~SF_FLAG;
-        break;
-      case BC_SET8_ZF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_ZF_EFLAGS):
         if ( res8 == 0 ) l_EFLAGS|= ZF_FLAG;
         else             l_EFLAGS&= ~ZF_FLAG;
-        break;
-      case BC_SET8_PF_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_SET8_PF_EFLAGS):
         if ( PFLAG[res8] ) l_EFLAGS|= PF_FLAG;
         else               l_EFLAGS&= ~PF_FLAG;
-        break;
-      case BC_CLEAR_OF_CF_EFLAGS: l_EFLAGS&= ~(OF_FLAG|CF_FLAG); break;
-      case BC_CLEAR_CF_EFLAGS: l_EFLAGS&= ~CF_FLAG; break;
-      case BC_CLEAR_DF_EFLAGS: l_EFLAGS&= ~DF_FLAG; break;
-      case BC_SET_CF_EFLAGS: l_EFLAGS|= CF_FLAG; break;
-      case BC_SET_DF_EFLAGS: l_EFLAGS|= DF_FLAG; break;
+        BC_NEXT;
+      BC_CASE(BC_CLEAR_OF_CF_EFLAGS): l_EFLAGS&= ~(OF_FLAG|CF_FLAG); BC_NEXT;
+      BC_CASE(BC_CLEAR_CF_EFLAGS): l_EFLAGS&= ~CF_FLAG; BC_NEXT;
+      BC_CASE(BC_CLEAR_DF_EFLAGS): l_EFLAGS&= ~DF_FLAG; BC_NEXT;
+      BC_CASE(BC_SET_CF_EFLAGS): l_EFLAGS|= CF_FLAG; BC_NEXT;
+      BC_CASE(BC_SET_DF_EFLAGS): l_EFLAGS|= DF_FLAG; BC_NEXT;
         // --> CR0 flags
-      case BC_CLEAR_TS_CR0:
+      BC_CASE(BC_CLEAR_TS_CR0):
         if ( check_seg_level0_novm ( jit ) )
           l_CR0&= ~CR0_TS;
         else { exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         // --> Assignació valors immediats a operadors
-      case BC_SET32_SIMM_RES:
+      BC_CASE(BC_SET32_SIMM_RES):
         res32= (uint32_t) ((int32_t) ((int16_t) (p->v[++pos])));
-        break;
-      case BC_SET32_SIMM_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SIMM_OP0):
         op32[0]= (uint32_t) ((int32_t) ((int16_t) (p->v[++pos])));
-        break;
-      case BC_SET32_SIMM_OP1:
+        BC_NEXT;
+      BC_CASE(BC_SET32_SIMM_OP1):
         op32[1]= (uint32_t) ((int32_t) ((int16_t) (p->v[++pos])));
-        break;
-      case BC_SET32_IMM32_RES:
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMM32_RES):
         res32= ((uint32_t) p->v[pos+1]) | (((uint32_t) (p->v[pos+2]))<<16);
         pos+= 2;
-        break;
-      case BC_SET32_IMM32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMM32_OP0):
         op32[0]= ((uint32_t) p->v[pos+1]) | (((uint32_t) (p->v[pos+2]))<<16);
         pos+= 2;
-        break;
-      case BC_SET32_IMM32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMM32_OP1):
         op32[1]= ((uint32_t) p->v[pos+1]) | (((uint32_t) (p->v[pos+2]))<<16);
         pos+= 2;
-        break;
-      case BC_SET16_IMM_RES: res16= (uint16_t) (p->v[pos+1]); ++pos; break;
-      case BC_SET16_IMM_OP0: op16[0]= (uint16_t) (p->v[pos+1]); ++pos; break;
-      case BC_SET16_IMM_OP1: op16[1]= (uint16_t) (p->v[pos+1]); ++pos; break;
-      case BC_SET8_IMM_RES: res8= (uint8_t) (p->v[pos+1]); ++pos; break;
-      case BC_SET8_IMM_OP0: op8[0]= (uint8_t) (p->v[pos+1]); ++pos; break;
-      case BC_SET8_IMM_OP1: op8[1]= (uint8_t) (p->v[pos+1]); ++pos; break;
+        BC_NEXT;
+      BC_CASE(BC_SET16_IMM_RES): res16= (uint16_t) (p->v[pos+1]); ++pos; BC_NEXT;
+      BC_CASE(BC_SET16_IMM_OP0): op16[0]= (uint16_t) (p->v[pos+1]); ++pos; BC_NEXT;
+      BC_CASE(BC_SET16_IMM_OP1): op16[1]= (uint16_t) (p->v[pos+1]); ++pos; BC_NEXT;
+      BC_CASE(BC_SET8_IMM_RES): res8= (uint8_t) (p->v[pos+1]); ++pos; BC_NEXT;
+      BC_CASE(BC_SET8_IMM_OP0): op8[0]= (uint8_t) (p->v[pos+1]); ++pos; BC_NEXT;
+      BC_CASE(BC_SET8_IMM_OP1): op8[1]= (uint8_t) (p->v[pos+1]); ++pos; BC_NEXT;
         // --> Assignació registre
-      case BC_SET32_1_OP1: op32[1]= 1; break;
-      case BC_SET32_OP0_OP1_0_OP0: op32[1]= op32[0]; op32[0]= 0; break;
-      case BC_SET32_OP0_RES: res32= op32[0]; break;
-      case BC_SET32_OP1_RES: res32= op32[1]; break;
-      case BC_SET32_DR7_RES:
+      BC_CASE(BC_SET32_1_OP1): op32[1]= 1; BC_NEXT;
+      BC_CASE(BC_SET32_OP0_OP1_0_OP0): op32[1]= op32[0]; op32[0]= 0; BC_NEXT;
+      BC_CASE(BC_SET32_OP0_RES): res32= op32[0]; BC_NEXT;
+      BC_CASE(BC_SET32_OP1_RES): res32= op32[1]; BC_NEXT;
+      BC_CASE(BC_SET32_DR7_RES):
         if ( check_seg_level0 ( jit ) ) res32= l_DR7;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_DR7_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_DR7_OP0):
         if ( check_seg_level0 ( jit ) ) op32[0]= l_DR7;
         else                            { exception ( jit ); goto stop; }
-        break;        
-      case BC_SET32_DR7_OP1:
+        BC_NEXT;        
+      BC_CASE(BC_SET32_DR7_OP1):
         if ( check_seg_level0 ( jit ) ) op32[1]= l_DR7;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR0_RES_NOCHECK: res32= l_CR0&0x0000FFFF; break;
-      case BC_SET32_CR0_RES:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR0_RES_NOCHECK): res32= l_CR0&0x0000FFFF; BC_NEXT;
+      BC_CASE(BC_SET32_CR0_RES):
         if ( check_seg_level0 ( jit ) ) res32= l_CR0;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR0_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR0_OP0):
         if ( check_seg_level0 ( jit ) ) op32[0]= l_CR0;
         else                            { exception ( jit ); goto stop; }
-        break;        
-      case BC_SET32_CR0_OP1:
+        BC_NEXT;        
+      BC_CASE(BC_SET32_CR0_OP1):
         if ( check_seg_level0 ( jit ) ) op32[1]= l_CR0;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR2_RES:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR2_RES):
         if ( check_seg_level0 ( jit ) ) res32= l_CR2;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR2_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR2_OP0):
         if ( check_seg_level0 ( jit ) ) op32[0]= l_CR2;
         else                            { exception ( jit ); goto stop; }
-        break;        
-      case BC_SET32_CR2_OP1:
+        BC_NEXT;        
+      BC_CASE(BC_SET32_CR2_OP1):
         if ( check_seg_level0 ( jit ) ) op32[1]= l_CR2;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR3_RES:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR3_RES):
         if ( check_seg_level0 ( jit ) ) res32= l_CR3;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_CR3_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_CR3_OP0):
         if ( check_seg_level0 ( jit ) ) op32[0]= l_CR3;
         else                            { exception ( jit ); goto stop; }
-        break;        
-      case BC_SET32_CR3_OP1:
+        BC_NEXT;        
+      BC_CASE(BC_SET32_CR3_OP1):
         if ( check_seg_level0 ( jit ) ) op32[1]= l_CR3;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_EAX_RES: res32= l_EAX; break;
-      case BC_SET32_EAX_OP0: op32[0]= l_EAX; break;
-      case BC_SET32_EAX_OP1: op32[1]= l_EAX; break;
-      case BC_SET32_ECX_RES: res32= l_ECX; break;
-      case BC_SET32_ECX_OP0: op32[0]= l_ECX; break;
-      case BC_SET32_ECX_OP1: op32[1]= l_ECX; break;
-      case BC_SET32_EDX_RES: res32= l_EDX; break;
-      case BC_SET32_EDX_OP0: op32[0]= l_EDX; break;
-      case BC_SET32_EDX_OP1: op32[1]= l_EDX; break;
-      case BC_SET32_EBX_RES: res32= l_EBX; break;
-      case BC_SET32_EBX_OP0: op32[0]= l_EBX; break;
-      case BC_SET32_EBX_OP1: op32[1]= l_EBX; break;
-      case BC_SET32_ESP_RES: res32= l_ESP; break;
-      case BC_SET32_ESP_OP0: op32[0]= l_ESP; break;
-      case BC_SET32_ESP_OP1: op32[1]= l_ESP; break;
-      case BC_SET32_EBP_RES: res32= l_EBP; break;
-      case BC_SET32_EBP_OP0: op32[0]= l_EBP; break;
-      case BC_SET32_EBP_OP1: op32[1]= l_EBP; break;
-      case BC_SET32_ESI_RES: res32= l_ESI; break;
-      case BC_SET32_ESI_OP0: op32[0]= l_ESI; break;
-      case BC_SET32_ESI_OP1: op32[1]= l_ESI; break;
-      case BC_SET32_EDI_RES: res32= l_EDI; break;
-      case BC_SET32_EDI_OP0: op32[0]= l_EDI; break;
-      case BC_SET32_EDI_OP1: op32[1]= l_EDI; break;
-      case BC_SET32_ES_RES: res32= (uint32_t) l_P_ES->v; break;
-      case BC_SET32_ES_OP0: op32[0]= (uint32_t) l_P_ES->v; break;
-      case BC_SET32_ES_OP1: op32[1]= (uint32_t) l_P_ES->v; break;
-      case BC_SET32_CS_RES: res32= (uint32_t) l_P_CS->v; break;
-      case BC_SET32_CS_OP0: op32[0]= (uint32_t) l_P_CS->v; break;
-      case BC_SET32_CS_OP1: op32[1]= (uint32_t) l_P_CS->v; break;
-      case BC_SET32_SS_RES: res32= (uint32_t) l_P_SS->v; break;
-      case BC_SET32_SS_OP0: op32[0]= (uint32_t) l_P_SS->v; break;
-      case BC_SET32_SS_OP1: op32[1]= (uint32_t) l_P_SS->v; break;
-      case BC_SET32_DS_RES: res32= (uint32_t) l_P_DS->v; break;
-      case BC_SET32_DS_OP0: op32[0]= (uint32_t) l_P_DS->v; break;
-      case BC_SET32_DS_OP1: op32[1]= (uint32_t) l_P_DS->v; break;
-      case BC_SET32_FS_RES: res32= (uint32_t) l_P_FS->v; break;
-      case BC_SET32_FS_OP0: op32[0]= (uint32_t) l_P_FS->v; break;
-      case BC_SET32_FS_OP1: op32[1]= (uint32_t) l_P_FS->v; break;
-      case BC_SET32_GS_RES: res32= (uint32_t) l_P_GS->v; break;
-      case BC_SET32_GS_OP0: op32[0]= (uint32_t) l_P_GS->v; break;
-      case BC_SET32_GS_OP1: op32[1]= (uint32_t) l_P_GS->v; break;
-      case BC_SET16_FPUCONTROL_RES: res16= l_FPU_CONTROL; break;
-      case BC_SET16_FPUSTATUSTOP_RES: res16= l_FPU_STATUS_TOP; break;
-      case BC_SET16_1_OP1: op16[1]= 1; break;
-      case BC_SET16_OP0_OP1_0_OP0: op16[1]= op16[0]; op16[0]= 0; break;
-      case BC_SET16_OP0_RES: res16= op16[0]; break;
-      case BC_SET16_OP1_RES: res16= op16[1]; break;
-      case BC_SET16_CR0_RES_NOCHECK: res16= (uint16_t) (l_CR0&0xFFFF); break;
-      case BC_SET16_LDTR_RES: res16= l_LDTR.v; break;
-      case BC_SET16_TR_RES: res16= l_TR.v; break;
-      case BC_SET16_AX_RES: res16= l_AX; break;
-      case BC_SET16_AX_OP0: op16[0]= l_AX; break;
-      case BC_SET16_AX_OP1: op16[1]= l_AX; break;
-      case BC_SET16_CX_RES: res16= l_CX; break;
-      case BC_SET16_CX_OP0: op16[0]= l_CX; break;
-      case BC_SET16_CX_OP1: op16[1]= l_CX; break;
-      case BC_SET16_DX_RES: res16= l_DX; break;
-      case BC_SET16_DX_OP0: op16[0]= l_DX; break;
-      case BC_SET16_DX_OP1: op16[1]= l_DX; break;
-      case BC_SET16_BX_RES: res16= l_BX; break;
-      case BC_SET16_BX_OP0: op16[0]= l_BX; break;
-      case BC_SET16_BX_OP1: op16[1]= l_BX; break;
-      case BC_SET16_SP_RES: res16= l_SP; break;
-      case BC_SET16_SP_OP0: op16[0]= l_SP; break;
-      case BC_SET16_SP_OP1: op16[1]= l_SP; break;
-      case BC_SET16_BP_RES: res16= l_BP; break;
-      case BC_SET16_BP_OP0: op16[0]= l_BP; break;
-      case BC_SET16_BP_OP1: op16[1]= l_BP; break;
-      case BC_SET16_SI_RES: res16= l_SI; break;
-      case BC_SET16_SI_OP0: op16[0]= l_SI; break;
-      case BC_SET16_SI_OP1: op16[1]= l_SI; break;
-      case BC_SET16_DI_RES: res16= l_DI; break;
-      case BC_SET16_DI_OP0: op16[0]= l_DI; break;
-      case BC_SET16_DI_OP1: op16[1]= l_DI; break;
-      case BC_SET16_ES_RES: res16= l_P_ES->v; break;
-      case BC_SET16_ES_OP0: op16[0]= l_P_ES->v; break;
-      case BC_SET16_ES_OP1: op16[1]= l_P_ES->v; break;
-      case BC_SET16_CS_RES: res16= l_P_CS->v; break;
-      case BC_SET16_CS_OP0: op16[0]= l_P_CS->v; break;
-      case BC_SET16_CS_OP1: op16[1]= l_P_CS->v; break;
-      case BC_SET16_SS_RES: res16= l_P_SS->v; break;
-      case BC_SET16_SS_OP0: op16[0]= l_P_SS->v; break;
-      case BC_SET16_SS_OP1: op16[1]= l_P_SS->v; break;
-      case BC_SET16_DS_RES: res16= l_P_DS->v; break;
-      case BC_SET16_DS_OP0: op16[0]= l_P_DS->v; break;
-      case BC_SET16_DS_OP1: op16[1]= l_P_DS->v; break;
-      case BC_SET16_FS_RES: res16= l_P_FS->v; break;
-      case BC_SET16_FS_OP0: op16[0]= l_P_FS->v; break;
-      case BC_SET16_FS_OP1: op16[1]= l_P_FS->v; break;
-      case BC_SET16_GS_RES: res16= l_P_GS->v; break;
-      case BC_SET16_GS_OP0: op16[0]= l_P_GS->v; break;
-      case BC_SET16_GS_OP1: op16[1]= l_P_GS->v; break;
-      case BC_SET8_COND_RES: res8= cond ? 0x01 : 0x00; break;
-      case BC_SET8_OP0_OP1_0_OP0: op8[1]= op8[0]; op8[0]= 0; break;
-      case BC_SET8_1_OP1: op8[1]= 1; break;
-      case BC_SET8_OP0_RES: res8= op8[0]; break;
-      case BC_SET8_OP1_RES: res8= op8[1]; break;
-      case BC_SET8_AL_RES: res8= l_AL; break;
-      case BC_SET8_AL_OP0: op8[0]= l_AL; break;
-      case BC_SET8_AL_OP1: op8[1]= l_AL; break;
-      case BC_SET8_CL_RES: res8= l_CL; break;
-      case BC_SET8_CL_OP0: op8[0]= l_CL; break;
-      case BC_SET8_CL_OP1: op8[1]= l_CL; break;
-      case BC_SET8_DL_RES: res8= l_DL; break;
-      case BC_SET8_DL_OP0: op8[0]= l_DL; break;
-      case BC_SET8_DL_OP1: op8[1]= l_DL; break;
-      case BC_SET8_BL_RES: res8= l_BL; break;
-      case BC_SET8_BL_OP0: op8[0]= l_BL; break;
-      case BC_SET8_BL_OP1: op8[1]= l_BL; break;
-      case BC_SET8_AH_RES: res8= l_AH; break;
-      case BC_SET8_AH_OP0: op8[0]= l_AH; break;
-      case BC_SET8_AH_OP1: op8[1]= l_AH; break;
-      case BC_SET8_CH_RES: res8= l_CH; break;
-      case BC_SET8_CH_OP0: op8[0]= l_CH; break;
-      case BC_SET8_CH_OP1: op8[1]= l_CH; break;
-      case BC_SET8_DH_RES: res8= l_DH; break;
-      case BC_SET8_DH_OP0: op8[0]= l_DH; break;
-      case BC_SET8_DH_OP1: op8[1]= l_DH; break;
-      case BC_SET8_BH_RES: res8= l_BH; break;
-      case BC_SET8_BH_OP0: op8[0]= l_BH; break;
-      case BC_SET8_BH_OP1: op8[1]= l_BH; break;
+        BC_NEXT;
+      BC_CASE(BC_SET32_EAX_RES): res32= l_EAX; BC_NEXT;
+      BC_CASE(BC_SET32_EAX_OP0): op32[0]= l_EAX; BC_NEXT;
+      BC_CASE(BC_SET32_EAX_OP1): op32[1]= l_EAX; BC_NEXT;
+      BC_CASE(BC_SET32_ECX_RES): res32= l_ECX; BC_NEXT;
+      BC_CASE(BC_SET32_ECX_OP0): op32[0]= l_ECX; BC_NEXT;
+      BC_CASE(BC_SET32_ECX_OP1): op32[1]= l_ECX; BC_NEXT;
+      BC_CASE(BC_SET32_EDX_RES): res32= l_EDX; BC_NEXT;
+      BC_CASE(BC_SET32_EDX_OP0): op32[0]= l_EDX; BC_NEXT;
+      BC_CASE(BC_SET32_EDX_OP1): op32[1]= l_EDX; BC_NEXT;
+      BC_CASE(BC_SET32_EBX_RES): res32= l_EBX; BC_NEXT;
+      BC_CASE(BC_SET32_EBX_OP0): op32[0]= l_EBX; BC_NEXT;
+      BC_CASE(BC_SET32_EBX_OP1): op32[1]= l_EBX; BC_NEXT;
+      BC_CASE(BC_SET32_ESP_RES): res32= l_ESP; BC_NEXT;
+      BC_CASE(BC_SET32_ESP_OP0): op32[0]= l_ESP; BC_NEXT;
+      BC_CASE(BC_SET32_ESP_OP1): op32[1]= l_ESP; BC_NEXT;
+      BC_CASE(BC_SET32_EBP_RES): res32= l_EBP; BC_NEXT;
+      BC_CASE(BC_SET32_EBP_OP0): op32[0]= l_EBP; BC_NEXT;
+      BC_CASE(BC_SET32_EBP_OP1): op32[1]= l_EBP; BC_NEXT;
+      BC_CASE(BC_SET32_ESI_RES): res32= l_ESI; BC_NEXT;
+      BC_CASE(BC_SET32_ESI_OP0): op32[0]= l_ESI; BC_NEXT;
+      BC_CASE(BC_SET32_ESI_OP1): op32[1]= l_ESI; BC_NEXT;
+      BC_CASE(BC_SET32_EDI_RES): res32= l_EDI; BC_NEXT;
+      BC_CASE(BC_SET32_EDI_OP0): op32[0]= l_EDI; BC_NEXT;
+      BC_CASE(BC_SET32_EDI_OP1): op32[1]= l_EDI; BC_NEXT;
+      BC_CASE(BC_SET32_ES_RES): res32= (uint32_t) l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET32_ES_OP0): op32[0]= (uint32_t) l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET32_ES_OP1): op32[1]= (uint32_t) l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET32_CS_RES): res32= (uint32_t) l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET32_CS_OP0): op32[0]= (uint32_t) l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET32_CS_OP1): op32[1]= (uint32_t) l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET32_SS_RES): res32= (uint32_t) l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET32_SS_OP0): op32[0]= (uint32_t) l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET32_SS_OP1): op32[1]= (uint32_t) l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET32_DS_RES): res32= (uint32_t) l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET32_DS_OP0): op32[0]= (uint32_t) l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET32_DS_OP1): op32[1]= (uint32_t) l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET32_FS_RES): res32= (uint32_t) l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET32_FS_OP0): op32[0]= (uint32_t) l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET32_FS_OP1): op32[1]= (uint32_t) l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET32_GS_RES): res32= (uint32_t) l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET32_GS_OP0): op32[0]= (uint32_t) l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET32_GS_OP1): op32[1]= (uint32_t) l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET16_FPUCONTROL_RES): res16= l_FPU_CONTROL; BC_NEXT;
+      BC_CASE(BC_SET16_FPUSTATUSTOP_RES): res16= l_FPU_STATUS_TOP; BC_NEXT;
+      BC_CASE(BC_SET16_1_OP1): op16[1]= 1; BC_NEXT;
+      BC_CASE(BC_SET16_OP0_OP1_0_OP0): op16[1]= op16[0]; op16[0]= 0; BC_NEXT;
+      BC_CASE(BC_SET16_OP0_RES): res16= op16[0]; BC_NEXT;
+      BC_CASE(BC_SET16_OP1_RES): res16= op16[1]; BC_NEXT;
+      BC_CASE(BC_SET16_CR0_RES_NOCHECK): res16= (uint16_t) (l_CR0&0xFFFF); BC_NEXT;
+      BC_CASE(BC_SET16_LDTR_RES): res16= l_LDTR.v; BC_NEXT;
+      BC_CASE(BC_SET16_TR_RES): res16= l_TR.v; BC_NEXT;
+      BC_CASE(BC_SET16_AX_RES): res16= l_AX; BC_NEXT;
+      BC_CASE(BC_SET16_AX_OP0): op16[0]= l_AX; BC_NEXT;
+      BC_CASE(BC_SET16_AX_OP1): op16[1]= l_AX; BC_NEXT;
+      BC_CASE(BC_SET16_CX_RES): res16= l_CX; BC_NEXT;
+      BC_CASE(BC_SET16_CX_OP0): op16[0]= l_CX; BC_NEXT;
+      BC_CASE(BC_SET16_CX_OP1): op16[1]= l_CX; BC_NEXT;
+      BC_CASE(BC_SET16_DX_RES): res16= l_DX; BC_NEXT;
+      BC_CASE(BC_SET16_DX_OP0): op16[0]= l_DX; BC_NEXT;
+      BC_CASE(BC_SET16_DX_OP1): op16[1]= l_DX; BC_NEXT;
+      BC_CASE(BC_SET16_BX_RES): res16= l_BX; BC_NEXT;
+      BC_CASE(BC_SET16_BX_OP0): op16[0]= l_BX; BC_NEXT;
+      BC_CASE(BC_SET16_BX_OP1): op16[1]= l_BX; BC_NEXT;
+      BC_CASE(BC_SET16_SP_RES): res16= l_SP; BC_NEXT;
+      BC_CASE(BC_SET16_SP_OP0): op16[0]= l_SP; BC_NEXT;
+      BC_CASE(BC_SET16_SP_OP1): op16[1]= l_SP; BC_NEXT;
+      BC_CASE(BC_SET16_BP_RES): res16= l_BP; BC_NEXT;
+      BC_CASE(BC_SET16_BP_OP0): op16[0]= l_BP; BC_NEXT;
+      BC_CASE(BC_SET16_BP_OP1): op16[1]= l_BP; BC_NEXT;
+      BC_CASE(BC_SET16_SI_RES): res16= l_SI; BC_NEXT;
+      BC_CASE(BC_SET16_SI_OP0): op16[0]= l_SI; BC_NEXT;
+      BC_CASE(BC_SET16_SI_OP1): op16[1]= l_SI; BC_NEXT;
+      BC_CASE(BC_SET16_DI_RES): res16= l_DI; BC_NEXT;
+      BC_CASE(BC_SET16_DI_OP0): op16[0]= l_DI; BC_NEXT;
+      BC_CASE(BC_SET16_DI_OP1): op16[1]= l_DI; BC_NEXT;
+      BC_CASE(BC_SET16_ES_RES): res16= l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET16_ES_OP0): op16[0]= l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET16_ES_OP1): op16[1]= l_P_ES->v; BC_NEXT;
+      BC_CASE(BC_SET16_CS_RES): res16= l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET16_CS_OP0): op16[0]= l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET16_CS_OP1): op16[1]= l_P_CS->v; BC_NEXT;
+      BC_CASE(BC_SET16_SS_RES): res16= l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET16_SS_OP0): op16[0]= l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET16_SS_OP1): op16[1]= l_P_SS->v; BC_NEXT;
+      BC_CASE(BC_SET16_DS_RES): res16= l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET16_DS_OP0): op16[0]= l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET16_DS_OP1): op16[1]= l_P_DS->v; BC_NEXT;
+      BC_CASE(BC_SET16_FS_RES): res16= l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET16_FS_OP0): op16[0]= l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET16_FS_OP1): op16[1]= l_P_FS->v; BC_NEXT;
+      BC_CASE(BC_SET16_GS_RES): res16= l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET16_GS_OP0): op16[0]= l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET16_GS_OP1): op16[1]= l_P_GS->v; BC_NEXT;
+      BC_CASE(BC_SET8_COND_RES): res8= cond ? 0x01 : 0x00; BC_NEXT;
+      BC_CASE(BC_SET8_OP0_OP1_0_OP0): op8[1]= op8[0]; op8[0]= 0; BC_NEXT;
+      BC_CASE(BC_SET8_1_OP1): op8[1]= 1; BC_NEXT;
+      BC_CASE(BC_SET8_OP0_RES): res8= op8[0]; BC_NEXT;
+      BC_CASE(BC_SET8_OP1_RES): res8= op8[1]; BC_NEXT;
+      BC_CASE(BC_SET8_AL_RES): res8= l_AL; BC_NEXT;
+      BC_CASE(BC_SET8_AL_OP0): op8[0]= l_AL; BC_NEXT;
+      BC_CASE(BC_SET8_AL_OP1): op8[1]= l_AL; BC_NEXT;
+      BC_CASE(BC_SET8_CL_RES): res8= l_CL; BC_NEXT;
+      BC_CASE(BC_SET8_CL_OP0): op8[0]= l_CL; BC_NEXT;
+      BC_CASE(BC_SET8_CL_OP1): op8[1]= l_CL; BC_NEXT;
+      BC_CASE(BC_SET8_DL_RES): res8= l_DL; BC_NEXT;
+      BC_CASE(BC_SET8_DL_OP0): op8[0]= l_DL; BC_NEXT;
+      BC_CASE(BC_SET8_DL_OP1): op8[1]= l_DL; BC_NEXT;
+      BC_CASE(BC_SET8_BL_RES): res8= l_BL; BC_NEXT;
+      BC_CASE(BC_SET8_BL_OP0): op8[0]= l_BL; BC_NEXT;
+      BC_CASE(BC_SET8_BL_OP1): op8[1]= l_BL; BC_NEXT;
+      BC_CASE(BC_SET8_AH_RES): res8= l_AH; BC_NEXT;
+      BC_CASE(BC_SET8_AH_OP0): op8[0]= l_AH; BC_NEXT;
+      BC_CASE(BC_SET8_AH_OP1): op8[1]= l_AH; BC_NEXT;
+      BC_CASE(BC_SET8_CH_RES): res8= l_CH; BC_NEXT;
+      BC_CASE(BC_SET8_CH_OP0): op8[0]= l_CH; BC_NEXT;
+      BC_CASE(BC_SET8_CH_OP1): op8[1]= l_CH; BC_NEXT;
+      BC_CASE(BC_SET8_DH_RES): res8= l_DH; BC_NEXT;
+      BC_CASE(BC_SET8_DH_OP0): op8[0]= l_DH; BC_NEXT;
+      BC_CASE(BC_SET8_DH_OP1): op8[1]= l_DH; BC_NEXT;
+      BC_CASE(BC_SET8_BH_RES): res8= l_BH; BC_NEXT;
+      BC_CASE(BC_SET8_BH_OP0): op8[0]= l_BH; BC_NEXT;
+      BC_CASE(BC_SET8_BH_OP1): op8[1]= l_BH; BC_NEXT;
         // --> Assignació res
-      case BC_SET32_RES_FLOATU32: float_u32.u32= res32; break;
-      case BC_SET32_RES_DOUBLEU64L: double_u64.u32.l= res32; break;
-      case BC_SET32_RES_DOUBLEU64H: double_u64.u32.h= res32; break;
-      case BC_SET32_RES_LDOUBLEU80L: ldouble_u80.u32.v0= res32; break;
-      case BC_SET32_RES_LDOUBLEU80M: ldouble_u80.u32.v1= res32; break;
-      case BC_SET32_SRES_LDOUBLE:
+      BC_CASE(BC_SET32_RES_FLOATU32): float_u32.u32= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_DOUBLEU64L): double_u64.u32.l= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_DOUBLEU64H): double_u64.u32.h= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_LDOUBLEU80L): ldouble_u80.u32.v0= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_LDOUBLEU80M): ldouble_u80.u32.v1= res32; BC_NEXT;
+      BC_CASE(BC_SET32_SRES_LDOUBLE):
         ldouble= (long double) ((int32_t) res32);
-        break;
-      case BC_SET32_RES_SELECTOR: selector= (uint16_t) res32; break;
-      case BC_SET32_RES_DR7:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_SELECTOR): selector= (uint16_t) res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_DR7):
         if ( check_seg_level0 ( jit ) )
           {
             if ( (res32&DR7_MASK) != 0 )
@@ -7154,8 +7683,8 @@ exec_inst (
             l_DR7= (res32&DR7_MASK) | DR7_RESERVED_SET1;
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_CR0:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_CR0):
         if ( check_seg_level0 ( jit ) )
           {
             res32= (res32&CR0_MASK)&(~CR0_ET);
@@ -7172,12 +7701,12 @@ exec_inst (
             else { EXCEPTION0 ( EXCP_GP ); exception ( jit ); goto stop; }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_CR2:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_CR2):
         if ( check_seg_level0 ( jit ) ) l_CR2= res32;
         else                            { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_CR3:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_CR3):
         if ( check_seg_level0 ( jit ) )
           {
             res32&= CR3_MASK;
@@ -7188,55 +7717,55 @@ exec_inst (
             paging_32b_CR3_changed ( jit );
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_EAX: l_EAX= res32; break;
-      case BC_SET32_RES_ECX: l_ECX= res32; break;
-      case BC_SET32_RES_EDX: l_EDX= res32; break;
-      case BC_SET32_RES_EBX: l_EBX= res32; break;
-      case BC_SET32_RES_ESP: l_ESP= res32; break;
-      case BC_SET32_RES_EBP: l_EBP= res32; break;
-      case BC_SET32_RES_ESI: l_ESI= res32; break;
-      case BC_SET32_RES_EDI: l_EDI= res32; break;
-      case BC_SET32_RES_ES:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_EAX): l_EAX= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_ECX): l_ECX= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_EDX): l_EDX= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_EBX): l_EBX= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_ESP): l_ESP= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_EBP): l_EBP= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_ESI): l_ESI= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_EDI): l_EDI= res32; BC_NEXT;
+      BC_CASE(BC_SET32_RES_ES):
         if ( !set_sreg ( jit, (uint16_t) res32, l_P_ES ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_SS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_SS):
         if ( !set_sreg ( jit, (uint16_t) res32, l_P_SS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_DS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_DS):
         if ( !set_sreg ( jit, (uint16_t) res32, l_P_DS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_FS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_FS):
         if ( !set_sreg ( jit, (uint16_t) res32, l_P_FS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES_GS:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES_GS):
         if ( !set_sreg ( jit, (uint16_t) res32, l_P_GS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET32_RES8_RES: res32= (uint32_t) res8; break;
-      case BC_SET32_RES8_RES_SIGNED:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES8_RES): res32= (uint32_t) res8; BC_NEXT;
+      BC_CASE(BC_SET32_RES8_RES_SIGNED):
         res32= (uint32_t) ((int32_t) ((int8_t) res8));
-        break;
-      case BC_SET32_RES16_RES: res32= (uint32_t) res16; break;
-      case BC_SET32_RES16_RES_SIGNED:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES16_RES): res32= (uint32_t) res16; BC_NEXT;
+      BC_CASE(BC_SET32_RES16_RES_SIGNED):
         res32= (uint32_t) ((int32_t) ((int16_t) res16));
-        break;
-      case BC_SET32_RES64_RES: res32= (uint32_t) (res64&0xFFFFFFFF); break;
-      case BC_SET32_RES64_EAX_EDX:
+        BC_NEXT;
+      BC_CASE(BC_SET32_RES64_RES): res32= (uint32_t) (res64&0xFFFFFFFF); BC_NEXT;
+      BC_CASE(BC_SET32_RES64_EAX_EDX):
         l_EAX= (uint32_t) (res64&0xFFFFFFFF);
         l_EDX= (uint32_t) (res64>>32);
-        break;
-      case BC_SET16_RES_LDOUBLEU80H:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_LDOUBLEU80H):
         ldouble_u80.u16.v4= res16;
         ldouble_u80.u16.v5= 0;
         ldouble_u80.u32.v3= 0;
-        break;
-      case BC_SET16_RES_SELECTOR: selector= res16; break;
-      case BC_SET16_RES_CR0: // Sols amb LMSW
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_SELECTOR): selector= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_CR0): // Sols amb LMSW
         if ( check_seg_level0_novm ( jit ) )
           {
             if ( l_CR0&CR0_PE ) res16|= (uint16_t) CR0_PE;
@@ -7246,591 +7775,578 @@ exec_inst (
               WW ( UDATA, "lmsw Falten flags en CR0: TS,EM,MP" );
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES_AX: l_AX= res16; break;
-      case BC_SET16_RES_CX: l_CX= res16; break;
-      case BC_SET16_RES_DX: l_DX= res16; break;
-      case BC_SET16_RES_BX: l_BX= res16; break;
-      case BC_SET16_RES_SP: l_SP= res16; break;
-      case BC_SET16_RES_BP: l_BP= res16; break;
-      case BC_SET16_RES_SI: l_SI= res16; break;
-      case BC_SET16_RES_DI: l_DI= res16; break;
-      case BC_SET16_RES_ES:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_AX): l_AX= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_CX): l_CX= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_DX): l_DX= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_BX): l_BX= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_SP): l_SP= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_BP): l_BP= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_SI): l_SI= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_DI): l_DI= res16; BC_NEXT;
+      BC_CASE(BC_SET16_RES_ES):
         if ( !set_sreg ( jit, res16, l_P_ES ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES_SS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_SS):
         if ( !set_sreg ( jit, res16, l_P_SS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES_DS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_DS):
         if ( !set_sreg ( jit, res16, l_P_DS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES_FS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_FS):
         if ( !set_sreg ( jit, res16, l_P_FS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES_GS:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES_GS):
         if ( !set_sreg ( jit, res16, l_P_GS ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SET16_RES8_RES: res16= (uint16_t) res8; break;
-      case BC_SET16_RES8_RES_SIGNED:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES8_RES): res16= (uint16_t) res8; BC_NEXT;
+      BC_CASE(BC_SET16_RES8_RES_SIGNED):
         res16= (uint16_t) ((int16_t) ((int8_t) res8));
-        break;
-      case BC_SET16_RES32_RES: res16= (uint16_t) (res32&0xFFFF); break;
-      case BC_SET16_RES32_AX_DX:
+        BC_NEXT;
+      BC_CASE(BC_SET16_RES32_RES): res16= (uint16_t) (res32&0xFFFF); BC_NEXT;
+      BC_CASE(BC_SET16_RES32_AX_DX):
         l_AX= (uint16_t) (res32&0xFFFF);
         l_DX= (uint16_t) (res32>>16);
-        break;
-      case BC_SET8_RES_AL: l_AL= res8; break;
-      case BC_SET8_RES_CL: l_CL= res8; break;
-      case BC_SET8_RES_DL: l_DL= res8; break;
-      case BC_SET8_RES_BL: l_BL= res8; break;
-      case BC_SET8_RES_AH: l_AH= res8; break;
-      case BC_SET8_RES_CH: l_CH= res8; break;
-      case BC_SET8_RES_DH: l_DH= res8; break;
-      case BC_SET8_RES_BH: l_BH= res8; break;
+        BC_NEXT;
+      BC_CASE(BC_SET8_RES_AL): l_AL= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_CL): l_CL= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_DL): l_DL= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_BL): l_BL= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_AH): l_AH= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_CH): l_CH= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_DH): l_DH= res8; BC_NEXT;
+      BC_CASE(BC_SET8_RES_BH): l_BH= res8; BC_NEXT;
         // --> Assignació offset
-      case BC_SET32_OFFSET_EAX: l_EAX= offset; break;
-      case BC_SET32_OFFSET_ECX: l_ECX= offset; break;
-      case BC_SET32_OFFSET_EDX: l_EDX= offset; break;
-      case BC_SET32_OFFSET_EBX: l_EBX= offset; break;
-      case BC_SET32_OFFSET_ESP: l_ESP= offset; break;
-      case BC_SET32_OFFSET_EBP: l_EBP= offset; break;
-      case BC_SET32_OFFSET_ESI: l_ESI= offset; break;
-      case BC_SET32_OFFSET_EDI: l_EDI= offset; break;
-      case BC_SET32_OFFSET_RES: res32= offset; break;
-      case BC_SET16_OFFSET_AX: l_AX= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_CX: l_CX= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_DX: l_DX= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_BX: l_BX= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_SP: l_SP= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_BP: l_BP= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_SI: l_SI= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_DI: l_DI= (uint16_t) offset; break;
-      case BC_SET16_OFFSET_RES: res16= (uint16_t) offset; break;
-      case BC_SET16_SELECTOR_RES: res16= selector; break;
+      BC_CASE(BC_SET32_OFFSET_EAX): l_EAX= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_ECX): l_ECX= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_EDX): l_EDX= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_EBX): l_EBX= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_ESP): l_ESP= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_EBP): l_EBP= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_ESI): l_ESI= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_EDI): l_EDI= offset; BC_NEXT;
+      BC_CASE(BC_SET32_OFFSET_RES): res32= offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_AX): l_AX= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_CX): l_CX= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_DX): l_DX= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_BX): l_BX= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_SP): l_SP= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_BP): l_BP= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_SI): l_SI= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_DI): l_DI= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_OFFSET_RES): res16= (uint16_t) offset; BC_NEXT;
+      BC_CASE(BC_SET16_SELECTOR_RES): res16= selector; BC_NEXT;
         // --> Lectura en operadors
-      case BC_DS_READ32_RES:
+      BC_CASE(BC_DS_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_DS, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_DS, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_DS, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ32_RES:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_SS, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_SS, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_SS, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ32_RES:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_ES, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_ES, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_ES, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ32_RES:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_CS, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_CS, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_CS, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ32_RES:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_FS, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_FS, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_FS, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ32_RES:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ32_RES):
         if ( jit->_mem_read32 ( jit, l_P_GS, offset, &res32, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ32_OP0:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ32_OP0):
         if ( jit->_mem_read32 ( jit, l_P_GS, offset, &op32[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ32_OP1:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ32_OP1):
         if ( jit->_mem_read32 ( jit, l_P_GS, offset, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_DS, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_DS, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_DS, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_SS, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_SS, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_SS, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_ES, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_ES, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_ES, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_CS, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_CS, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_CS, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_FS, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_FS, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_FS, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ16_RES:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ16_RES):
         if ( jit->_mem_read16 ( jit, l_P_GS, offset, &res16, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ16_OP0:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ16_OP0):
         if ( jit->_mem_read16 ( jit, l_P_GS, offset, &op16[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ16_OP1:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ16_OP1):
         if ( jit->_mem_read16 ( jit, l_P_GS, offset, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_DS, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_DS, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_DS, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_SS, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_SS, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_SS, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_ES, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_ES, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_ES, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_CS, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_CS, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_CS, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_FS, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_FS, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_FS, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ8_RES:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ8_RES):
         if ( jit->_mem_read8 ( jit, l_P_GS, offset, &res8, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ8_OP0:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ8_OP0):
         if ( jit->_mem_read8 ( jit, l_P_GS, offset, &op8[0], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ8_OP1:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ8_OP1):
         if ( jit->_mem_read8 ( jit, l_P_GS, offset, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ_SELECTOR_OFFSET):
         if ( jit->_mem_read16 ( jit, l_P_DS, offset, &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read32 ( jit, l_P_DS, offset+2,
                                      &offset, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_READ_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ_SELECTOR_OFFSET):
         if ( jit->_mem_read16 ( jit, l_P_SS, offset, &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read32 ( jit, l_P_SS, offset+2,
                                      &offset, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_READ_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ_SELECTOR_OFFSET):
         if ( jit->_mem_read16 ( jit, l_P_ES, offset, &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read32 ( jit, l_P_ES, offset+2,
                                      &offset, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_READ_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ_SELECTOR_OFFSET):
         if ( jit->_mem_read16 ( jit, l_P_CS, offset, &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read32 ( jit, l_P_CS, offset+2,
                                      &offset, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_READ_SELECTOR_OFFSET:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ_SELECTOR_OFFSET):
         if ( jit->_mem_read16 ( jit, l_P_GS, offset, &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read32 ( jit, l_P_GS, offset+2,
                                      &offset, true ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_DS, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_DS, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_DS_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_DS_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_DS, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_DS, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
-      case BC_SS_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_SS, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_SS, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_SS_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_SS_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_SS, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_SS, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
-      case BC_ES_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_ES, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_ES, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_ES_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_ES_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_ES, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_ES, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
-      case BC_CS_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_CS, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_CS, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_CS_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_CS_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_CS, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_CS, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
-      case BC_FS_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_FS, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_FS, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_FS_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_FS_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_FS, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_FS, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
-      case BC_GS_READ_OFFSET_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ_OFFSET_SELECTOR):
         if ( jit->_mem_read32 ( jit, l_P_GS, offset, &tmp32, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_GS, offset+4,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= tmp32;
-        break;
-      case BC_GS_READ_OFFSET16_SELECTOR:
+        BC_NEXT;
+      BC_CASE(BC_GS_READ_OFFSET16_SELECTOR):
         if ( jit->_mem_read16 ( jit, l_P_GS, offset, &tmp16, true ) != 0 )
           { exception ( jit ); goto stop; }
         else if ( jit->_mem_read16 ( jit, l_P_GS, offset+2,
                                      &selector, true ) != 0 )
           { exception ( jit ); goto stop; }
         else offset= (uint32_t) tmp16;
-        break;
+        BC_NEXT;
         // --> Escriu res
-      case BC_DS_RES_WRITE32:
+      BC_CASE(BC_DS_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_DS, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_RES_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_SS_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_SS, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_RES_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_ES_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_ES, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_RES_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_CS_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_CS, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_RES_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_FS_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_FS, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_RES_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_GS_RES_WRITE32):
         if ( jit->_mem_write32 ( jit, l_P_GS, offset, res32 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_DS_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_DS, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_SS_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_SS, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_ES_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_ES, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_CS_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_CS, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_FS_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_FS, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_RES_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_GS_RES_WRITE16):
         if ( jit->_mem_write16 ( jit, l_P_GS, offset, res16 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_DS_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_DS_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_DS, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_SS_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_SS_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_SS, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_ES_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_ES_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_ES, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_CS_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_CS_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_CS, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FS_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_FS_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_FS, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_GS_RES_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_GS_RES_WRITE8):
         if ( jit->_mem_write8 ( jit, l_P_GS, offset, res8 ) != 0 )
           { exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         // --> Lectura ports
-      case BC_PORT_READ32:
+      BC_CASE(BC_PORT_READ32):
         if ( io_check_permission ( jit, port, 4 ) )
           res32= jit->port_read32 ( jit->udata, port );
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_PORT_READ16:
+        BC_NEXT;
+      BC_CASE(BC_PORT_READ16):
         if ( io_check_permission ( jit, port, 2 ) )
           res16= jit->port_read16 ( jit->udata, port );
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_PORT_READ8:
+        BC_NEXT;
+      BC_CASE(BC_PORT_READ8):
         if ( io_check_permission ( jit, port, 1 ) )
           res8= jit->port_read8 ( jit->udata, port );
         else { exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         // --> Escritura ports
-      case BC_PORT_WRITE32:
+      BC_CASE(BC_PORT_WRITE32):
         if ( io_check_permission ( jit, port, 4 ) )
           jit->port_write32 ( jit->udata, port, res32 );
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_PORT_WRITE16:
+        BC_NEXT;
+      BC_CASE(BC_PORT_WRITE16):
         if ( io_check_permission ( jit, port, 2 ) )
           jit->port_write16 ( jit->udata, port, res16 );
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_PORT_WRITE8:
+        BC_NEXT;
+      BC_CASE(BC_PORT_WRITE8):
         if ( io_check_permission ( jit, port, 1 ) )
-          {
-            jit->port_write8 ( jit->udata, port, res8 );
-            if ( jit->_stop_after_port_write )
-              { jit->_stop_after_port_write= false; goto stop; }
-          }
+          jit->port_write8 ( jit->udata, port, res8 );
         else { exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         
         // INSTRUCCIONS (Poden parar algunes)
         // --> Control de fluxe
-      case BC_JMP32_FAR:
+      BC_CASE(BC_JMP32_FAR):
         if ( jmp_far ( jit, selector, offset, true ) ) goto_eip ( jit );
         else                                           exception ( jit );
         goto stop;
-        break;
-      case BC_JMP16_FAR:
+      BC_CASE(BC_JMP16_FAR):
         if ( jmp_far ( jit, selector, offset, false ) ) goto_eip ( jit );
         else                                            exception ( jit );
         goto stop;
-        break;
-      case BC_JMP32_NEAR_REL:
+      BC_CASE(BC_JMP32_NEAR_REL):
         offset= l_EIP +
           ((uint32_t) (p->v[pos+2])) +
           (uint32_t) ((int32_t) ((int16_t) p->v[pos+1]));
-        if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
+        if ( jmp_near ( jit, offset ) ) goto_eip_link ( jit, p, p->v[pos+3] );
         else                            exception ( jit );
         goto stop;
-        break;
-      case BC_JMP16_NEAR_REL:
+      BC_CASE(BC_JMP16_NEAR_REL):
         offset= (l_EIP +
                  ((uint32_t) (p->v[pos+2])) +
                  (uint32_t) ((int32_t) ((int16_t) p->v[pos+1])))&0xFFFF;
-        if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
+        if ( jmp_near ( jit, offset ) ) goto_eip_link ( jit, p, p->v[pos+3] );
         else                            exception ( jit );
         goto stop;
-        break;
-      case BC_JMP32_NEAR_REL32:
+      BC_CASE(BC_JMP32_NEAR_REL32):
         offset= l_EIP +
           ((uint32_t) (p->v[pos+3])) +
           (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
-        if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
+        if ( jmp_near ( jit, offset ) ) goto_eip_link ( jit, p, p->v[pos+4] );
         else                            exception ( jit );
         goto stop;
-        break;
-      case BC_JMP32_NEAR_RES32:
+      BC_CASE(BC_JMP32_NEAR_RES32):
         if ( jmp_near ( jit, res32 ) ) goto_eip ( jit );
         else                           exception ( jit );
         goto stop;
-        break;
-      case BC_JMP16_NEAR_RES16:
+      BC_CASE(BC_JMP16_NEAR_RES16):
         if ( jmp_near ( jit, (uint32_t) res16 ) ) goto_eip ( jit );
         else                                      exception ( jit );
         goto stop;
-        break;
-      case BC_CALL32_FAR:
+      BC_CASE(BC_CALL32_FAR):
         if ( call_far ( jit, selector, offset, true,
                         l_EIP+((uint32_t) p->v[pos+1]) ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL16_FAR:
+      BC_CASE(BC_CALL16_FAR):
         if ( call_far ( jit, selector, offset, false,
                         l_EIP+((uint32_t) p->v[pos+1]) ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL32_NEAR_REL:
+      BC_CASE(BC_CALL32_NEAR_REL):
         next_eip= l_EIP + (uint32_t) (p->v[pos+2]);
         offset= next_eip +
           (uint32_t) ((int32_t) ((int16_t) p->v[pos+1]));
@@ -7838,8 +8354,7 @@ exec_inst (
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL16_NEAR_REL:
+      BC_CASE(BC_CALL16_NEAR_REL):
         next_eip= l_EIP + (uint32_t) (p->v[pos+2]);
         offset= next_eip +
           (uint32_t) ((int32_t) ((int16_t) p->v[pos+1]));
@@ -7848,8 +8363,7 @@ exec_inst (
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL32_NEAR_REL32:
+      BC_CASE(BC_CALL32_NEAR_REL32):
         next_eip= l_EIP + (uint32_t) (p->v[pos+3]);
         offset= next_eip +
           (((uint32_t) p->v[pos+1]) | (((uint32_t) p->v[pos+2])<<16));
@@ -7857,80 +8371,144 @@ exec_inst (
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL32_NEAR_RES32:
+      BC_CASE(BC_CALL32_NEAR_RES32):
         next_eip= l_EIP + (uint32_t) (p->v[pos+1]);
         if ( jmp_near ( jit, res32 ) && push32 ( jit, next_eip ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_CALL16_NEAR_RES16:
+      BC_CASE(BC_CALL16_NEAR_RES16):
         next_eip= l_EIP + (uint32_t) (p->v[pos+1]);
         if ( jmp_near ( jit, (uint32_t) res16 ) &&
              push16 ( jit, (uint16_t) (next_eip&0xFFFF) ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_BRANCH32:
+      BC_CASE(BC_BRANCH32_A): cond= COND_A; goto branch32;
+      BC_CASE(BC_BRANCH32_AE): cond= COND_AE; goto branch32;
+      BC_CASE(BC_BRANCH32_B): cond= COND_B; goto branch32;
+      BC_CASE(BC_BRANCH32_CXZ): cond= COND_CXZ; goto branch32;
+      BC_CASE(BC_BRANCH32_E): cond= COND_E; goto branch32;
+      BC_CASE(BC_BRANCH32_ECXZ): cond= COND_ECXZ; goto branch32;
+      BC_CASE(BC_BRANCH32_G): cond= COND_G; goto branch32;
+      BC_CASE(BC_BRANCH32_GE): cond= COND_GE; goto branch32;
+      BC_CASE(BC_BRANCH32_L): cond= COND_L; goto branch32;
+      BC_CASE(BC_BRANCH32_NA): cond= COND_NA; goto branch32;
+      BC_CASE(BC_BRANCH32_NE): cond= COND_NE; goto branch32;
+      BC_CASE(BC_BRANCH32_NG): cond= COND_NG; goto branch32;
+      BC_CASE(BC_BRANCH32_NO): cond= COND_NO; goto branch32;
+      BC_CASE(BC_BRANCH32_NS): cond= COND_NS; goto branch32;
+      BC_CASE(BC_BRANCH32_O): cond= COND_O; goto branch32;
+      BC_CASE(BC_BRANCH32_P): cond= COND_P; goto branch32;
+      BC_CASE(BC_BRANCH32_PO): cond= COND_PO; goto branch32;
+      BC_CASE(BC_BRANCH32_S): cond= COND_S; goto branch32;
+      BC_CASE(BC_BRANCH32):
+      branch32:
         if ( cond )
           {
             offset= l_EIP +
               (uint32_t) (p->v[pos+2]) +
               (uint32_t) ((int32_t) ((int16_t) p->v[pos+1]));
-            if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
-            else                            exception ( jit );
+            if ( jmp_near ( jit, offset ) )
+              goto_eip_link ( jit, p, p->v[pos+3] );
+            else exception ( jit );
+          }
+        else
+          {
+            l_EIP+= (uint32_t) (p->v[pos+2]);
+            goto_eip_link ( jit, p, p->v[pos+4] );
           }
-        else { l_EIP+= (uint32_t) (p->v[pos+2]); goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_BRANCH32_IMM32:
+      BC_CASE(BC_BRANCH32_IMM32_A): cond= COND_A; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_AE): cond= COND_AE; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_B): cond= COND_B; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_CXZ): cond= COND_CXZ; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_E): cond= COND_E; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_ECXZ): cond= COND_ECXZ; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_G): cond= COND_G; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_GE): cond= COND_GE; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_L): cond= COND_L; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_NA): cond= COND_NA; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_NE): cond= COND_NE; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_NG): cond= COND_NG; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_NO): cond= COND_NO; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_NS): cond= COND_NS; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_O): cond= COND_O; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_P): cond= COND_P; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_PO): cond= COND_PO; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32_S): cond= COND_S; goto branch32_imm32;
+      BC_CASE(BC_BRANCH32_IMM32):
+      branch32_imm32:
         if ( cond )
           {
             offset= l_EIP +
               (uint32_t) (p->v[pos+3]) +
               (((uint32_t) p->v[pos+1] ) | (((uint32_t) p->v[pos+2])<<16));
-            if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
-            else                            exception ( jit );
+            if ( jmp_near ( jit, offset ) )
+              goto_eip_link ( jit, p, p->v[pos+4] );
+            else exception ( jit );
+          }
+        else
+          {
+            l_EIP+= (uint32_t) (p->v[pos+3]);
+            goto_eip_link ( jit, p, p->v[pos+5] );
           }
-        else { l_EIP+= (uint32_t) (p->v[pos+3]); goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_BRANCH16:
+      BC_CASE(BC_BRANCH16_A): cond= COND_A; goto branch16;
+      BC_CASE(BC_BRANCH16_AE): cond= COND_AE; goto branch16;
+      BC_CASE(BC_BRANCH16_B): cond= COND_B; goto branch16;
+      BC_CASE(BC_BRANCH16_CXZ): cond= COND_CXZ; goto branch16;
+      BC_CASE(BC_BRANCH16_E): cond= COND_E; goto branch16;
+      BC_CASE(BC_BRANCH16_ECXZ): cond= COND_ECXZ; goto branch16;
+      BC_CASE(BC_BRANCH16_G): cond= COND_G; goto branch16;
+      BC_CASE(BC_BRANCH16_GE): cond= COND_GE; goto branch16;
+      BC_CASE(BC_BRANCH16_L): cond= COND_L; goto branch16;
+      BC_CASE(BC_BRANCH16_NA): cond= COND_NA; goto branch16;
+      BC_CASE(BC_BRANCH16_NE): cond= COND_NE; goto branch16;
+      BC_CASE(BC_BRANCH16_NG): cond= COND_NG; goto branch16;
+      BC_CASE(BC_BRANCH16_NO): cond= COND_NO; goto branch16;
+      BC_CASE(BC_BRANCH16_NS): cond= COND_NS; goto branch16;
+      BC_CASE(BC_BRANCH16_O): cond= COND_O; goto branch16;
+      BC_CASE(BC_BRANCH16_P): cond= COND_P; goto branch16;
+      BC_CASE(BC_BRANCH16_PO): cond= COND_PO; goto branch16;
+      BC_CASE(BC_BRANCH16_S): cond= COND_S; goto branch16;
+      BC_CASE(BC_BRANCH16):
+      branch16:
         if ( cond )
           {
             offset= (l_EIP +
                      (uint32_t) (p->v[pos+2]) +
                      (uint32_t) ((int32_t) ((int16_t) p->v[pos+1])))&0xFFFF;
-            if ( jmp_near ( jit, offset ) ) goto_eip ( jit );
-            else                            exception ( jit );
+            if ( jmp_near ( jit, offset ) )
+              goto_eip_link ( jit, p, p->v[pos+3] );
+            else exception ( jit );
+          }
+        else
+          {
+            l_EIP+= (uint32_t) (p->v[pos+2]);
+            goto_eip_link ( jit, p, p->v[pos+4] );
           }
-        else { l_EIP+= (uint32_t) (p->v[pos+2]); goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_IRET32:
+      BC_CASE(BC_IRET32):
         if ( iret ( jit, true,
                     l_EIP+(uint32_t)p->v[pos+1] ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_IRET16:
+      BC_CASE(BC_IRET16):
         if ( iret ( jit, false,
                     l_EIP+(uint32_t)p->v[pos+1] ) )
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
         // --> Aritmètiques
-      case BC_ADC32: res32= op32[0] + op32[1] + ((l_EFLAGS&CF_FLAG)!=0); break;
-      case BC_ADC16: res16= op16[0] + op16[1] + ((l_EFLAGS&CF_FLAG)!=0); break;
-      case BC_ADC8: res8= op8[0] + op8[1] + ((l_EFLAGS&CF_FLAG)!=0); break;
-      case BC_ADD32: res32= op32[0] + op32[1]; break;
-      case BC_ADD16: res16= op16[0] + op16[1]; break;
-      case BC_ADD8: res8= op8[0] + op8[1]; break;
-      case BC_DIV32_EDX_EAX:
+      BC_CASE(BC_ADC32): res32= op32[0] + op32[1] + ((l_EFLAGS&CF_FLAG)!=0); BC_NEXT;
+      BC_CASE(BC_ADC16): res16= op16[0] + op16[1] + ((l_EFLAGS&CF_FLAG)!=0); BC_NEXT;
+      BC_CASE(BC_ADC8): res8= op8[0] + op8[1] + ((l_EFLAGS&CF_FLAG)!=0); BC_NEXT;
+      BC_CASE(BC_ADD32): res32= op32[0] + op32[1]; BC_NEXT;
+      BC_CASE(BC_ADD16): res16= op16[0] + op16[1]; BC_NEXT;
+      BC_CASE(BC_ADD8): res8= op8[0] + op8[1]; BC_NEXT;
+      BC_CASE(BC_DIV32_EDX_EAX):
         if ( op32[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -7945,8 +8523,8 @@ exec_inst (
                 l_EDX= (uint32_t) (tmp64%((uint64_t) op32[0]));
               }
           }
-        break;
-      case BC_DIV16_DX_AX:
+        BC_NEXT;
+      BC_CASE(BC_DIV16_DX_AX):
         if ( op16[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -7961,8 +8539,8 @@ exec_inst (
                 l_DX= (uint16_t) (tmp32%((uint32_t) op16[0]));
               }
           }
-        break;
-      case BC_DIV8_AH_AL:
+        BC_NEXT;
+      BC_CASE(BC_DIV8_AH_AL):
         if ( op8[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -7977,8 +8555,8 @@ exec_inst (
                 l_AH= (uint8_t) (tmp16%((uint16_t) op8[0]));
               }
           }
-        break;
-      case BC_IDIV32_EDX_EAX:
+        BC_NEXT;
+      BC_CASE(BC_IDIV32_EDX_EAX):
         if ( op32[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -7995,8 +8573,8 @@ exec_inst (
                   (((int64_t) tmp64)%((int64_t) ((int32_t) op32[0])));
               }
           }
-        break;
-      case BC_IDIV16_DX_AX:
+        BC_NEXT;
+      BC_CASE(BC_IDIV16_DX_AX):
         if ( op16[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -8013,8 +8591,8 @@ exec_inst (
                   (((int32_t) tmp32)%((int32_t) ((int16_t) op16[0])));
               }
           }
-        break;
-      case BC_IDIV8_AH_AL:
+        BC_NEXT;
+      BC_CASE(BC_IDIV8_AH_AL):
         if ( op8[0] == 0 )
           { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
         else
@@ -8031,60 +8609,60 @@ exec_inst (
                   (((int16_t) tmp16)%((int16_t) ((int8_t) op8[0])));
               }
           }
-        break;
-      case BC_IMUL32:
+        BC_NEXT;
+      BC_CASE(BC_IMUL32):
         res64= (uint64_t) (((int64_t) ((int32_t) op32[0])) *
                            ((int64_t) ((int32_t) op32[1])));
-        break;
-      case BC_IMUL16:
+        BC_NEXT;
+      BC_CASE(BC_IMUL16):
         res32= (uint32_t) (((int32_t) ((int16_t) op16[0])) *
                            ((int32_t) ((int16_t) op16[1])));
-        break;
-      case BC_IMUL8:
+        BC_NEXT;
+      BC_CASE(BC_IMUL8):
         res16= (uint16_t) (((int16_t) ((int8_t) op8[0])) *
                            ((int16_t) ((int8_t) op8[1])));
-        break;
-      case BC_MUL32:
+        BC_NEXT;
+      BC_CASE(BC_MUL32):
         res64= ((uint64_t) op32[0]) * ((uint64_t) op32[1]);
-        break;
-      case BC_MUL16:
+        BC_NEXT;
+      BC_CASE(BC_MUL16):
         res32= ((uint32_t) op16[0]) * ((uint32_t) op16[1]);
-        break;
-      case BC_MUL8:
+        BC_NEXT;
+      BC_CASE(BC_MUL8):
         res16= ((uint16_t) op8[0]) * ((uint16_t) op8[1]);
-        break;
-      case BC_SBB32:
+        BC_NEXT;
+      BC_CASE(BC_SBB32):
         res32= op32[0] + ((~op32[1])&0xFFFFFFFF) + ((l_EFLAGS&CF_FLAG)==0);
-        break;
-      case BC_SBB16:
+        BC_NEXT;
+      BC_CASE(BC_SBB16):
         res16= op16[0] + ((~op16[1])&0xFFFF) + ((l_EFLAGS&CF_FLAG)==0);
-        break;
-      case BC_SBB8:
+        BC_NEXT;
+      BC_CASE(BC_SBB8):
         res8= op8[0] + ((~op8[1])&0xFF) + ((l_EFLAGS&CF_FLAG)==0);
-        break;
-      case BC_SGDT32: res16= l_GDTR.lastb; res32= l_GDTR.addr; break;
-      case BC_SIDT32: res16= l_IDTR.lastb; res32= l_IDTR.addr; break;
-      case BC_SIDT16: res16= l_IDTR.lastb; res32= l_IDTR.addr&0x00FFFFFF; break;
-      case BC_SUB32:
+        BC_NEXT;
+      BC_CASE(BC_SGDT32): res16= l_GDTR.lastb; res32= l_GDTR.addr; BC_NEXT;
+      BC_CASE(BC_SIDT32): res16= l_IDTR.lastb; res32= l_IDTR.addr; BC_NEXT;
+      BC_CASE(BC_SIDT16): res16= l_IDTR.lastb; res32= l_IDTR.addr&0x00FFFFFF; BC_NEXT;
+      BC_CASE(BC_SUB32):
         res32= (uint32_t) ((int32_t) op32[0] - (int32_t) op32[1]);
-        break;
-      case BC_SUB16:
+        BC_NEXT;
+      BC_CASE(BC_SUB16):
         res16= (uint16_t) ((int16_t) op16[0] - (int16_t) op16[1]);
-        break;
-      case BC_SUB8:
+        BC_NEXT;
+      BC_CASE(BC_SUB8):
         res8= (uint8_t) ((int8_t) op8[0] - (int8_t) op8[1]);
-        break;
+        BC_NEXT;
         // --> Llògiques
-      case BC_AND32: res32= op32[0] & op32[1]; break;
-      case BC_AND16: res16= op16[0] & op16[1]; break;
-      case BC_AND8: res8= op8[0] & op8[1]; break;
-      case BC_NOT32: res32= ~(op32[0]); break;
-      case BC_NOT16: res16= ~(op16[0]); break;
-      case BC_NOT8: res8= ~(op8[0]); break;
-      case BC_OR32: res32= op32[0] | op32[1]; break;
-      case BC_OR16: res16= op16[0] | op16[1]; break;
-      case BC_OR8: res8= op8[0] | op8[1]; break;
-      case BC_RCL32:
+      BC_CASE(BC_AND32): res32= op32[0] & op32[1]; BC_NEXT;
+      BC_CASE(BC_AND16): res16= op16[0] & op16[1]; BC_NEXT;
+      BC_CASE(BC_AND8): res8= op8[0] & op8[1]; BC_NEXT;
+      BC_CASE(BC_NOT32): res32= ~(op32[0]); BC_NEXT;
+      BC_CASE(BC_NOT16): res16= ~(op16[0]); BC_NEXT;
+      BC_CASE(BC_NOT8): res8= ~(op8[0]); BC_NEXT;
+      BC_CASE(BC_OR32): res32= op32[0] | op32[1]; BC_NEXT;
+      BC_CASE(BC_OR16): res16= op16[0] | op16[1]; BC_NEXT;
+      BC_CASE(BC_OR8): res8= op8[0] | op8[1]; BC_NEXT;
+      BC_CASE(BC_RCL32):
         tmp32= ((l_EFLAGS&CF_FLAG)!=0);
         if ( count > 0 )
           {
@@ -8095,8 +8673,8 @@ exec_inst (
                    (op32[0]>>(33-count));
           }
         else res32= op32[0];
-        break;
-      case BC_RCL16:
+        BC_NEXT;
+      BC_CASE(BC_RCL16):
         tmp16= ((l_EFLAGS&CF_FLAG)!=0);
         count%= 17;
         if ( count > 0 )
@@ -8109,8 +8687,8 @@ exec_inst (
                    (op16[0]>>(17-count));
           }
         else res16= op16[0];
-        break;
-      case BC_RCL8:
+        BC_NEXT;
+      BC_CASE(BC_RCL8):
         tmp8= ((l_EFLAGS&CF_FLAG)!=0);
         count%= 9;
         if ( count > 0 )
@@ -8123,8 +8701,8 @@ exec_inst (
                    (op8[0]>>(9-count));
           }
         else res8= op8[0];
-        break;
-      case BC_RCR32:
+        BC_NEXT;
+      BC_CASE(BC_RCR32):
         tmp32= ((l_EFLAGS&CF_FLAG)!=0);
         if ( count > 0 )
           {
@@ -8135,8 +8713,8 @@ exec_inst (
                    (op32[0]<<(33-count));
           }
         else res32= op32[0];
-        break;
-      case BC_RCR16:
+        BC_NEXT;
+      BC_CASE(BC_RCR16):
         tmp16= ((l_EFLAGS&CF_FLAG)!=0);
         count%= 17;
         if ( count > 0 )
@@ -8149,8 +8727,8 @@ exec_inst (
                    (op16[0]<<(17-count));
           }
         else res16= op16[0];
-        break;
-      case BC_RCR8:
+        BC_NEXT;
+      BC_CASE(BC_RCR8):
         tmp8= ((l_EFLAGS&CF_FLAG)!=0);
         count%= 9;
         if ( count > 0 )
@@ -8163,70 +8741,70 @@ exec_inst (
                    (op8[0]<<(9-count));
           }
         else res8= op8[0];
-        break;
-      case BC_ROL32:
+        BC_NEXT;
+      BC_CASE(BC_ROL32):
         count%= 32;
         if ( count > 0 ) res32= (op32[0]<<count) | (op32[0]>>(32-count));
         else res32= op32[0];
-        break;
-      case BC_ROL16:
+        BC_NEXT;
+      BC_CASE(BC_ROL16):
         count%= 16;
         if ( count > 0 ) res16= (op16[0]<<count) | (op16[0]>>(16-count));
         else res16= op16[0];
-        break;
-      case BC_ROL8:
+        BC_NEXT;
+      BC_CASE(BC_ROL8):
         count%= 8;
         if ( count > 0 ) res8= (op8[0]<<count) | (op8[0]>>(8-count));
         else res8= op8[0];
-        break;
-      case BC_ROR32:
+        BC_NEXT;
+      BC_CASE(BC_ROR32):
         if ( count > 0 ) res32= (op32[0]<<(32-count)) | (op32[0]>>count);
         else res32= op32[0];
-        break;
-      case BC_ROR16:
+        BC_NEXT;
+      BC_CASE(BC_ROR16):
         count%= 16;
         if ( count > 0 ) res16= (op16[0]<<(16-count)) | (op16[0]>>count);
         else res16= op16[0];
-        break;
-      case BC_ROR8:
+        BC_NEXT;
+      BC_CASE(BC_ROR8):
         count%= 8;
         if ( count > 0 ) res8= (op8[0]<<(8-count)) | (op8[0]>>count);
         else res8= op8[0];
-        break;
-      case BC_SAR32:
+        BC_NEXT;
+      BC_CASE(BC_SAR32):
         if ( count == 32  )
           { res32= (op32[0]&0x80000000) ? 0xFFFFFFFF : 0; }
         else if ( count > 0 )
           { res32= (uint32_t) (((int32_t) op32[0])>>count); }
         else res32= op32[0];
-        break;
-      case BC_SAR16:
+        BC_NEXT;
+      BC_CASE(BC_SAR16):
         if ( count >= 16  )
           { res16= (op16[0]&0x8000) ? 0xFFFF : 0; }
         else if ( count > 0 )
           { res16= (uint16_t) (((int16_t) op16[0])>>count); }
         else res16= op16[0];
-        break;
-      case BC_SAR8:
+        BC_NEXT;
+      BC_CASE(BC_SAR8):
         if ( count >= 8  )
           { res8= (op8[0]&0x80) ? 0xFF : 0; }
         else if ( count > 0 )
           { res8= (uint8_t) (((int8_t) op8[0])>>count); }
         else res8= op8[0];
-        break;
-      case BC_SHL32:
+        BC_NEXT;
+      BC_CASE(BC_SHL32):
         if ( count > 0 ) { res32= ((count==32) ? 0 : (op32[0]<<count)); }
         else res32= op32[0];
-        break;
-      case BC_SHL16:
+        BC_NEXT;
+      BC_CASE(BC_SHL16):
         if ( count > 0 ) { res16= ((count>=16) ? 0 : (op16[0]<<count)); }
         else res16= op16[0];
-        break;
-      case BC_SHL8:
+        BC_NEXT;
+      BC_CASE(BC_SHL8):
         if ( count > 0 ) { res8= ((count>=8) ? 0 : (op8[0]<<count)); }
         else res8= op8[0];
-        break;
-      case BC_SHLD32:
+        BC_NEXT;
+      BC_CASE(BC_SHLD32):
         if ( count > 0 && count <= 32 )
           {
             res32= (count==32) ?
@@ -8234,8 +8812,8 @@ exec_inst (
               ((op32[0]<<count) | (op32[1]>>(32-count)));
           }
         else res32= op32[0];
-        break;
-      case BC_SHLD16:
+        BC_NEXT;
+      BC_CASE(BC_SHLD16):
         if ( count > 0 && count <= 16 )
           {
             res16= (count==16) ?
@@ -8243,20 +8821,20 @@ exec_inst (
               ((op16[0]<<count) | (op16[1]>>(16-count)));
           }
         else res16= op16[0];
-        break;
-      case BC_SHR32:
+        BC_NEXT;
+      BC_CASE(BC_SHR32):
         if ( count > 0 ) { res32= ((count==32) ? 0 : (op32[0]>>count)); }
         else res32= op32[0];
-        break;
-      case BC_SHR16:
+        BC_NEXT;
+      BC_CASE(BC_SHR16):
         if ( count > 0 ) { res16= ((count>=16) ? 0 : (op16[0]>>count)); }
         else res16= op16[0];
-        break;
-      case BC_SHR8:
+        BC_NEXT;
+      BC_CASE(BC_SHR8):
         if ( count > 0 ) { res8= ((count>=8) ? 0 : (op8[0]>>count)); }
         else res8= op8[0];
-        break;
-      case BC_SHRD32:
+        BC_NEXT;
+      BC_CASE(BC_SHRD32):
         if ( count > 0 && count <= 32 )
           {
             res32= (count==32) ?
@@ -8264,8 +8842,8 @@ exec_inst (
               ((op32[0]>>count) | (op32[1]<<(32-count)));
           }
         else res32= op32[0];
-        break;
-      case BC_SHRD16:
+        BC_NEXT;
+      BC_CASE(BC_SHRD16):
         if ( count > 0 && count <= 16 )
           {
             res16= (count==16) ?
@@ -8273,17 +8851,297 @@ exec_inst (
               ((op16[0]>>count) | (op16[1]<<(16-count)));
           }
         else res16= op16[0];
-        break;
-      case BC_XOR32: res32= op32[0] ^ op32[1]; break;
-      case BC_XOR16: res16= op16[0] ^ op16[1]; break;
-      case BC_XOR8: res8= op8[0] ^ op8[1]; break;
+        BC_NEXT;
+      BC_CASE(BC_XOR32): res32= op32[0] ^ op32[1]; BC_NEXT;
+      BC_CASE(BC_XOR16): res16= op16[0] ^ op16[1]; BC_NEXT;
+      BC_CASE(BC_XOR8): res8= op8[0] ^ op8[1]; BC_NEXT;
+        // --> Peephole
+      BC_CASE(BC_MOV32_REG_REG):
+        res32= l_REG32(p->v[pos+1]&0xFF);
+        l_REG32(p->v[pos+1]>>8)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_MOV16_REG_REG):
+        res16= l_REG16(p->v[pos+1]&0xFF);
+        l_REG16(p->v[pos+1]>>8)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SET32_IMM32_REG):
+        res32= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_SET16_IMM_REG):
+        res16= p->v[pos+2];
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_REG):
+        if ( jit->_mem_read32 ( jit, l_P_DS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG32(p->v[++pos])= res32;
+        BC_NEXT;
+      BC_CASE(BC_DS_READ16_REG):
+        if ( jit->_mem_read16 ( jit, l_P_DS, offset, &res16, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG16(p->v[++pos])= res16;
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_REG):
+        if ( jit->_mem_read32 ( jit, l_P_SS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG32(p->v[++pos])= res32;
+        BC_NEXT;
+      BC_CASE(BC_SS_READ16_REG):
+        if ( jit->_mem_read16 ( jit, l_P_SS, offset, &res16, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG16(p->v[++pos])= res16;
+        BC_NEXT;
+      BC_CASE(BC_ADD32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= op32[0] + op32[1];
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_SUB32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= (uint32_t) ((int32_t) op32[0] - (int32_t) op32[1]);
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_AND32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= op32[0] & op32[1];
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_OR32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= op32[0] | op32[1];
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_XOR32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= op32[0] ^ op32[1];
+        l_REG32(p->v[pos+1])= res32;
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_CMP32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= (uint32_t) ((int32_t) op32[0] - (int32_t) op32[1]);
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_TEST32_REG_IMM):
+        op32[0]= l_REG32(p->v[pos+1]);
+        op32[1]= ((uint32_t) p->v[pos+2]) | (((uint32_t) (p->v[pos+3]))<<16);
+        res32= op32[0] & op32[1];
+        pos+= 3;
+        BC_NEXT;
+      BC_CASE(BC_ADD32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= op32[0] + op32[1];
+        l_REG32(p->v[pos+1]&0xFF)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SUB32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= (uint32_t) ((int32_t) op32[0] - (int32_t) op32[1]);
+        l_REG32(p->v[pos+1]&0xFF)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_AND32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= op32[0] & op32[1];
+        l_REG32(p->v[pos+1]&0xFF)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_OR32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= op32[0] | op32[1];
+        l_REG32(p->v[pos+1]&0xFF)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_XOR32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= op32[0] ^ op32[1];
+        l_REG32(p->v[pos+1]&0xFF)= res32;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_CMP32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= (uint32_t) ((int32_t) op32[0] - (int32_t) op32[1]);
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_TEST32_REG_REG):
+        op32[0]= l_REG32(p->v[pos+1]&0xFF);
+        op32[1]= l_REG32(p->v[pos+1]>>8);
+        res32= op32[0] & op32[1];
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_ADD16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= op16[0] + op16[1];
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_SUB16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= (uint16_t) ((int16_t) op16[0] - (int16_t) op16[1]);
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_AND16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= op16[0] & op16[1];
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_OR16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= op16[0] | op16[1];
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_XOR16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= op16[0] ^ op16[1];
+        l_REG16(p->v[pos+1])= res16;
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_CMP16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= (uint16_t) ((int16_t) op16[0] - (int16_t) op16[1]);
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_TEST16_REG_IMM):
+        op16[0]= l_REG16(p->v[pos+1]);
+        op16[1]= p->v[pos+2];
+        res16= op16[0] & op16[1];
+        pos+= 2;
+        BC_NEXT;
+      BC_CASE(BC_ADD16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= op16[0] + op16[1];
+        l_REG16(p->v[pos+1]&0xFF)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_SUB16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= (uint16_t) ((int16_t) op16[0] - (int16_t) op16[1]);
+        l_REG16(p->v[pos+1]&0xFF)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_AND16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= op16[0] & op16[1];
+        l_REG16(p->v[pos+1]&0xFF)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_OR16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= op16[0] | op16[1];
+        l_REG16(p->v[pos+1]&0xFF)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_XOR16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= op16[0] ^ op16[1];
+        l_REG16(p->v[pos+1]&0xFF)= res16;
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_CMP16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= (uint16_t) ((int16_t) op16[0] - (int16_t) op16[1]);
+        ++pos;
+        BC_NEXT;
+      BC_CASE(BC_TEST16_REG_REG):
+        op16[0]= l_REG16(p->v[pos+1]&0xFF);
+        op16[1]= l_REG16(p->v[pos+1]>>8);
+        res16= op16[0] & op16[1];
+        ++pos;
+        BC_NEXT;
+        // --> Fusió SIB+lectura
+      BC_CASE(BC_DS_READ32_SIB_RES):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_DS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_SIB_OP0):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_DS, offset, &op32[0], true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_SIB_OP1):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_DS, offset, &op32[1], true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_SIB_RES):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_SS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_SIB_OP0):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_SS, offset, &op32[0], true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_SIB_OP1):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_SS, offset, &op32[1], true ) != 0 )
+          { exception ( jit ); goto stop; }
+        BC_NEXT;
+      BC_CASE(BC_DS_READ32_SIB_REG):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_DS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG32(p->v[++pos])= res32;
+        BC_NEXT;
+      BC_CASE(BC_SS_READ32_SIB_REG):
+        offset= sib_offset ( l_cpu, &(p->v[pos+1]) );
+        pos+= 4;
+        if ( jit->_mem_read32 ( jit, l_P_SS, offset, &res32, true ) != 0 )
+          { exception ( jit ); goto stop; }
+        l_REG32(p->v[++pos])= res32;
+        BC_NEXT;
         // --> Altres
-      case BC_AAD:
+      BC_CASE(BC_AAD):
         l_AL= res8= (uint8_t) ((((uint16_t) l_AH)*((uint16_t) op8[0])
                                 + ((uint16_t) l_AL))&0xFF);
         l_AH= 0;
-        break;
-      case BC_AAM:
+        BC_NEXT;
+      BC_CASE(BC_AAM):
         if ( op8[0] != 0 )
           {
             tmp8= l_AL;
@@ -8291,8 +9149,8 @@ exec_inst (
             l_AL= res8= tmp8%op8[0];
           }
         else { EXCEPTION ( EXCP_DE ); exception ( jit ); goto stop; }
-        break;
-      case BC_BSF32:
+        BC_NEXT;
+      BC_CASE(BC_BSF32):
         if ( op32[1] == 0 ) { l_EFLAGS|= ZF_FLAG; }
         else
           {
@@ -8308,8 +9166,8 @@ exec_inst (
               }
             l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_BSF16:
+        BC_NEXT;
+      BC_CASE(BC_BSF16):
         if ( op16[1] == 0 ) { l_EFLAGS|= ZF_FLAG; }
         else
           {
@@ -8317,8 +9175,8 @@ exec_inst (
             if ( res16 == 8 ) res16+= BSF_TABLE[op16[1]>>8];
             l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_BSR32:
+        BC_NEXT;
+      BC_CASE(BC_BSR32):
         if ( op32[1] == 0 ) { l_EFLAGS|= ZF_FLAG; }
         else
           {
@@ -8334,8 +9192,8 @@ exec_inst (
               }
             l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_BSR16:
+        BC_NEXT;
+      BC_CASE(BC_BSR16):
         if ( op16[1] == 0 ) { l_EFLAGS|= ZF_FLAG; }
         else
           {
@@ -8343,58 +9201,58 @@ exec_inst (
             if ( res16 == 7 ) res16-= BSR_TABLE[op16[1]&0xFF];
             l_EFLAGS&= ~ZF_FLAG;
           }
-        break;
-      case BC_BSWAP:
+        BC_NEXT;
+      BC_CASE(BC_BSWAP):
         res32=
           (op32[0]<<24) |
           ((op32[0]<<8)&0x00FF0000) |
           ((op32[0]>>8)&0x0000FF00) |
           (op32[0]>>24)
           ;
-        break;
-      case BC_BT32:
+        BC_NEXT;
+      BC_CASE(BC_BT32):
         if ( op32[0]&(1<<(op32[1]%32)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_BT16:
+        BC_NEXT;
+      BC_CASE(BC_BT16):
         if ( op16[0]&(1<<(op16[1]%32)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_BTC32:
+        BC_NEXT;
+      BC_CASE(BC_BTC32):
         if ( op32[0]&(1<<(op32[1]%32)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
         res32= op32[0]^(1<<(op32[1]%32));
-        break;
-      case BC_BTR32:
+        BC_NEXT;
+      BC_CASE(BC_BTR32):
         if ( op32[0]&(1<<(op32[1]%32)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
         res32= op32[0]&(~(1<<(op32[1]%32)));
-        break;
-      case BC_BTR16:
+        BC_NEXT;
+      BC_CASE(BC_BTR16):
         if ( op16[0]&(1<<(op16[1]%16)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
         res16= op16[0]&(~(1<<(op16[1]%16)));
-        break;
-      case BC_BTS32:
+        BC_NEXT;
+      BC_CASE(BC_BTS32):
         if ( op32[0]&(1<<(op32[1]%32)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
         res32= op32[0]|(1<<(op32[1]%32));
-        break;
-      case BC_BTS16:
+        BC_NEXT;
+      BC_CASE(BC_BTS16):
         if ( op16[0]&(1<<(op16[1]%16)) ) l_EFLAGS|= CF_FLAG;
         else                             l_EFLAGS&= ~CF_FLAG;
         res16= op16[0]|(1<<(op16[1]%16));
-        break;
-      case BC_CDQ: l_EDX= (l_EAX&0x80000000)!=0 ? 0xFFFFFFFF : 0x00000000;break;
-      case BC_CLI: if ( !cli ( jit ) ) { exception ( jit ); goto stop; } break;
-      case BC_CMC:
+        BC_NEXT;
+      BC_CASE(BC_CDQ): l_EDX= (l_EAX&0x80000000)!=0 ? 0xFFFFFFFF : 0x00000000;BC_NEXT;
+      BC_CASE(BC_CLI): if ( !cli ( jit ) ) { exception ( jit ); goto stop; } BC_NEXT;
+      BC_CASE(BC_CMC):
         if ( (l_EFLAGS&CF_FLAG) != 0 ) l_EFLAGS&= ~CF_FLAG;
         else                           l_EFLAGS|= CF_FLAG;
-        break;
-      case BC_CPUID: IA32_cpu_cpuid ( l_cpu ); break;
-      case BC_CWD: l_DX= (l_AX&0x8000)!=0 ? 0xFFFF : 0x0000; break;
-      case BC_CWDE: l_EAX= (uint32_t) ((int32_t) ((int16_t) l_AX)); break;
-      case BC_DAA:
+        BC_NEXT;
+      BC_CASE(BC_CPUID): IA32_cpu_cpuid ( l_cpu ); BC_NEXT;
+      BC_CASE(BC_CWD): l_DX= (l_AX&0x8000)!=0 ? 0xFFFF : 0x0000; BC_NEXT;
+      BC_CASE(BC_CWDE): l_EAX= (uint32_t) ((int32_t) ((int16_t) l_AX)); BC_NEXT;
+      BC_CASE(BC_DAA):
         tmp8= l_AL;
         tmp_bool= ((l_EFLAGS&CF_FLAG)!=0);
         if ( (l_AL&0xF) > 9 || (l_EFLAGS&AF_FLAG)!=0 )
@@ -8412,8 +9270,8 @@ exec_inst (
           }
         else l_EFLAGS&= ~CF_FLAG;
         res8= l_AL;
-        break;
-      case BC_DAS:
+        BC_NEXT;
+      BC_CASE(BC_DAS):
         tmp8= l_AL;
         tmp_bool= ((l_EFLAGS&CF_FLAG)!=0);
         if ( (l_AL&0xF) > 9 || (l_EFLAGS&AF_FLAG)!=0 )
@@ -8431,22 +9289,27 @@ exec_inst (
           }
         else l_EFLAGS&= ~CF_FLAG;
         res8= l_AL;
-        break;
-      case BC_ENTER16:
+        BC_NEXT;
+      BC_CASE(BC_ENTER16):
         if ( enter16 ( jit, p->v[pos+1], p->v[pos+2] ) ) pos+= 2;
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_ENTER32:
+        BC_NEXT;
+      BC_CASE(BC_ENTER32):
         if ( enter32 ( jit, p->v[pos+1], p->v[pos+2] ) ) pos+= 2;
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_HALT:
-        // Bucle infinit. Es basa en que la EIP s'ha actualitzat abans.
-        if ( check_seg_level0 ( jit ) ) jit->_current_pos= pos;
+        BC_NEXT;
+      BC_CASE(BC_HALT):
+        // Queda aturada fins la pròxima interrupció (veure
+        // IA32_jit_run). Es basa en que la EIP s'ha actualitzat abans.
+        if ( check_seg_level0 ( jit ) )
+          {
+            jit->_current_pos= pos;
+            jit->_halted= true;
+            halted= true;
+          }
         else { l_EIP-= p->v[pos+1]; exception ( jit ); }
         goto stop;
-        break;
-      case BC_INT32: // NOTA!!! Per a què la distinció 32 i 16??????
+      BC_CASE(BC_INT32): // NOTA!!! Per a què la distinció 32 i 16??????
         if ( interruption ( jit,
                             l_EIP+(uint32_t)p->v[pos+1],
                             INTERRUPTION_TYPE_IMM,
@@ -8454,8 +9317,7 @@ exec_inst (
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_INT16:
+      BC_CASE(BC_INT16):
         if ( interruption ( jit,
                             l_EIP+(uint32_t)p->v[pos+1],
                             INTERRUPTION_TYPE_IMM,
@@ -8463,8 +9325,7 @@ exec_inst (
           goto_eip ( jit );
         else exception ( jit );
         goto stop;
-        break;
-      case BC_INTO32:
+      BC_CASE(BC_INTO32):
         if ( (l_EFLAGS&OF_FLAG) != 0 )
           {
             if ( interruption ( jit,
@@ -8476,8 +9337,7 @@ exec_inst (
           }
         else { l_EIP+= (uint32_t)p->v[pos+1]; goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_INTO16:
+      BC_CASE(BC_INTO16):
         if ( (l_EFLAGS&OF_FLAG) != 0 )
           {
             if ( interruption ( jit,
@@ -8489,13 +9349,15 @@ exec_inst (
           }
         else { l_EIP+= (uint32_t)p->v[pos+1]; goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_INVLPG32:
-      case BC_INVLPG16: // Ara són iguals
-        if ( check_seg_level0_novm ( jit ) ) {} // NO FA RES!!!
+      BC_CASE(BC_INVLPG32):
+      BC_CASE(BC_INVLPG16): // Ara són iguals
+        // Les traduccions es mantenen coherents vigilant les
+        // escriptures en les taules, sols cal descartar les globals.
+        if ( check_seg_level0_novm ( jit ) )
+          paging_32b_tlb_flush_global ( jit );
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LAHF:
+        BC_NEXT;
+      BC_CASE(BC_LAHF):
         l_AH=
           (((l_EFLAGS&SF_FLAG)!=0) ? 0x80 : 0x00) |
           (((l_EFLAGS&ZF_FLAG)!=0) ? 0x40 : 0x00) |
@@ -8504,8 +9366,8 @@ exec_inst (
           0x02 |
           (((l_EFLAGS&CF_FLAG)!=0) ? 0x01 : 0x00)
           ;
-        break;
-      case BC_LAR32:
+        BC_NEXT;
+      BC_CASE(BC_LAR32):
         if ( !PROTECTED_MODE_ACTIVATED || (l_EFLAGS&VM_FLAG) )
           { EXCEPTION ( EXCP_UD ); exception ( jit ); goto stop; }
         else
@@ -8519,8 +9381,8 @@ exec_inst (
               }
             else { l_EFLAGS&= ~ZF_FLAG; }
           }
-        break;
-      case BC_LAR16:
+        BC_NEXT;
+      BC_CASE(BC_LAR16):
         if ( !PROTECTED_MODE_ACTIVATED || (l_EFLAGS&VM_FLAG) )
           { EXCEPTION ( EXCP_UD ); exception ( jit ); goto stop; }
         else
@@ -8534,18 +9396,18 @@ exec_inst (
               }
             else { l_EFLAGS&= ~ZF_FLAG; }
           }
-        break;
-      case BC_LEAVE32:
+        BC_NEXT;
+      BC_CASE(BC_LEAVE32):
         if ( l_P_SS->h.is32 ) l_ESP= l_EBP;
         else                  l_SP= l_BP;
         if ( !pop32 ( jit, &l_EBP ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_LEAVE16:
+        BC_NEXT;
+      BC_CASE(BC_LEAVE16):
         if ( l_P_SS->h.is32 ) l_ESP= l_EBP;
         else                  l_SP= l_BP;
         if ( !pop16 ( jit, &l_BP ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_LGDT32:
+        BC_NEXT;
+      BC_CASE(BC_LGDT32):
         if ( check_seg_level0 ( jit ) )
           {
             l_GDTR.addr= offset;
@@ -8553,8 +9415,8 @@ exec_inst (
             l_GDTR.lastb= selector;
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LGDT16:
+        BC_NEXT;
+      BC_CASE(BC_LGDT16):
         if ( check_seg_level0 ( jit ) )
           {
             l_GDTR.addr= offset&0xFFFFFF;
@@ -8562,8 +9424,8 @@ exec_inst (
             l_GDTR.lastb= selector;
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LIDT32:
+        BC_NEXT;
+      BC_CASE(BC_LIDT32):
         if ( check_seg_level0 ( jit ) )
           {
             l_IDTR.addr= offset;
@@ -8571,8 +9433,8 @@ exec_inst (
             l_IDTR.lastb= selector;
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LIDT16:
+        BC_NEXT;
+      BC_CASE(BC_LIDT16):
         if ( check_seg_level0 ( jit ) )
           {
             l_IDTR.addr= offset&0xFFFFFF;
@@ -8580,11 +9442,11 @@ exec_inst (
             l_IDTR.lastb= selector;
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LLDT:
+        BC_NEXT;
+      BC_CASE(BC_LLDT):
         if ( !lldt ( jit, res16 ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_LSL32:
+        BC_NEXT;
+      BC_CASE(BC_LSL32):
         if ( !PROTECTED_MODE_ACTIVATED || (l_EFLAGS&VM_FLAG) )
           { EXCEPTION ( EXCP_UD ); exception ( jit ); goto stop; }
         else
@@ -8601,8 +9463,8 @@ exec_inst (
               }
             else { l_EFLAGS&= ~ZF_FLAG; }
           }
-        break;
-      case BC_LSL16:
+        BC_NEXT;
+      BC_CASE(BC_LSL16):
         if ( !PROTECTED_MODE_ACTIVATED || (l_EFLAGS&VM_FLAG) )
           { EXCEPTION ( EXCP_UD ); exception ( jit ); goto stop; }
         else
@@ -8619,43 +9481,43 @@ exec_inst (
               }
             else { l_EFLAGS&= ~ZF_FLAG; }
           }
-        break;
-      case BC_LTR:
+        BC_NEXT;
+      BC_CASE(BC_LTR):
         if ( !ltr ( jit, res16 ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_POP32:
+        BC_NEXT;
+      BC_CASE(BC_POP32):
         if ( !pop32 ( jit, &res32 ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_POP16:
+        BC_NEXT;
+      BC_CASE(BC_POP16):
         if ( !pop16 ( jit, &res16 ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_POP32_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_POP32_EFLAGS):
         if ( !pop32_eflags ( jit ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_POP16_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_POP16_EFLAGS):
         if ( !pop16_eflags ( jit ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_PUSH32:
+        BC_NEXT;
+      BC_CASE(BC_PUSH32):
         if ( !push32 ( jit, res32 ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_PUSH16:
+        BC_NEXT;
+      BC_CASE(BC_PUSH16):
         if ( !push16 ( jit, res16 ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_PUSH32_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_PUSH32_EFLAGS):
         if ( !push32 ( jit, l_EFLAGS&0x00FCFFFF ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_PUSH16_EFLAGS:
+        BC_NEXT;
+      BC_CASE(BC_PUSH16_EFLAGS):
         if ( !push16 ( jit, (uint16_t) (l_EFLAGS&0xFFFF) ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_PUSHA32_CHECK_EXCEPTION:
+        BC_NEXT;
+      BC_CASE(BC_PUSHA32_CHECK_EXCEPTION):
         if ( !PROTECTED_MODE_ACTIVATED &&
              (l_ESP==7 || l_ESP==9 || l_ESP==11 || l_ESP==13 || l_ESP==15) )
           {
@@ -8665,8 +9527,8 @@ exec_inst (
             exception ( jit );
             goto stop;
           }
-        break;
-      case BC_PUSHA16_CHECK_EXCEPTION:
+        BC_NEXT;
+      BC_CASE(BC_PUSHA16_CHECK_EXCEPTION):
         if ( !PROTECTED_MODE_ACTIVATED &&
              (l_SP==7 || l_SP==9 || l_SP==11 || l_SP==13 || l_SP==15) )
           {
@@ -8676,71 +9538,62 @@ exec_inst (
             exception ( jit );
             goto stop;
           }
-        break;
-      case BC_RET32_FAR:
+        BC_NEXT;
+      BC_CASE(BC_RET32_FAR):
         if ( ret_far ( jit, true ) ) goto_eip ( jit );
         else                         exception ( jit );
         goto stop;
-        break;
-      case BC_RET32_FAR_NOSTOP:
+      BC_CASE(BC_RET32_FAR_NOSTOP):
         if ( !ret_far ( jit, true ) )  { exception ( jit ); goto stop; }
-        break;
-      case BC_RET16_FAR:
+        BC_NEXT;
+      BC_CASE(BC_RET16_FAR):
         if ( ret_far ( jit, false ) ) goto_eip ( jit );
         else                          exception ( jit );
         goto stop;
-        break;
-      case BC_RET16_FAR_NOSTOP:
+      BC_CASE(BC_RET16_FAR_NOSTOP):
         if ( !ret_far ( jit, false ) ) { exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         // COMPTE QUE RT16 fa comprovacions
-      case BC_RET32_RES: l_EIP= res32; goto_eip ( jit ); goto stop; break;
-      case BC_RET32_RES_INC_ESP:
+      BC_CASE(BC_RET32_RES): l_EIP= res32; goto_eip ( jit ); goto stop;
+      BC_CASE(BC_RET32_RES_INC_ESP):
         l_EIP= res32;
         l_ESP+= (uint32_t) (p->v[pos+1]);
         goto_eip ( jit );
         goto stop;
-        break;
-      case BC_RET32_RES_INC_SP:
+      BC_CASE(BC_RET32_RES_INC_SP):
         l_EIP= res32;
         l_SP+= p->v[pos+1];
         goto_eip ( jit );
         goto stop;
-        break;
-      case BC_RET16_RES:
+      BC_CASE(BC_RET16_RES):
         res32= (uint32_t) res16;
         if ( res32 < P_CS->h.lim.firstb || res32 > P_CS->h.lim.lastb )
           { EXCEPTION0 ( EXCP_GP ); exception ( jit ); }
         else { l_EIP= res32; goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_RET16_RES_INC_ESP:
+      BC_CASE(BC_RET16_RES_INC_ESP):
         res32= (uint32_t) res16;
         if ( res32 < P_CS->h.lim.firstb || res32 > P_CS->h.lim.lastb )
           { EXCEPTION0 ( EXCP_GP ); exception ( jit ); }
         else
           { l_EIP= res32; l_ESP+= (uint32_t) (p->v[pos+1]); goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_RET16_RES_INC_SP:
+      BC_CASE(BC_RET16_RES_INC_SP):
         res32= (uint32_t) res16;
         if ( res32 < P_CS->h.lim.firstb || res32 > P_CS->h.lim.lastb )
           { EXCEPTION0 ( EXCP_GP ); exception ( jit ); }
         else
           { l_EIP= res32; l_SP+= p->v[pos+1]; goto_eip ( jit ); }
         goto stop;
-        break;
-      case BC_INC_ESP_AND_GOTO_EIP:
+      BC_CASE(BC_INC_ESP_AND_GOTO_EIP):
         l_ESP+= (uint32_t) (p->v[pos+1]);
         goto_eip ( jit );
         goto stop;
-        break;
-      case BC_INC_SP_AND_GOTO_EIP:
+      BC_CASE(BC_INC_SP_AND_GOTO_EIP):
         l_SP+= p->v[pos+1];
         goto_eip ( jit );
         goto stop;
-        break;
-      case BC_SAHF:
+      BC_CASE(BC_SAHF):
         if ( l_AH&0x80 ) l_EFLAGS|= SF_FLAG;
         else             l_EFLAGS&= ~SF_FLAG;
         if ( l_AH&0x40 ) l_EFLAGS|= ZF_FLAG;
@@ -8751,24 +9604,24 @@ exec_inst (
         else             l_EFLAGS&= ~PF_FLAG;
         if ( l_AH&0x01 ) l_EFLAGS|= CF_FLAG;
         else             l_EFLAGS&= ~CF_FLAG;
-        break;
-      case BC_STI: if ( !sti ( jit ) ) { exception ( jit ); goto stop; } break;
-      case BC_VERR:
+        BC_NEXT;
+      BC_CASE(BC_STI): if ( !sti ( jit ) ) { exception ( jit ); goto stop; } BC_NEXT;
+      BC_CASE(BC_VERR):
         if ( !verr_verw ( jit, res16, true ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_VERW:
+        BC_NEXT;
+      BC_CASE(BC_VERW):
         if ( !verr_verw ( jit, res16, false ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_WBINVD:
+        BC_NEXT;
+      BC_CASE(BC_WBINVD):
         if ( check_seg_level0 ( jit ) )
           {
             printf("[CAL_IMPLEMENTAR] WBINVD\n");
           }
         else { EXCEPTION0 ( EXCP_GP ); exception ( jit ); goto stop; }
-        break;
+        BC_NEXT;
         // --> Strings
-      case BC_CMPS32_ADDR32:
+      BC_CASE(BC_CMPS32_ADDR32):
         if ( jit->_mem_read32 ( jit, l_P_ES, l_EDI, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8777,8 +9630,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_ESI-=4; l_EDI-=4; }
             else                    { l_ESI+=4; l_EDI+=4; }
           }
-        break;
-      case BC_CMPS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_CMPS8_ADDR32):
         if ( jit->_mem_read8 ( jit, l_P_ES, l_EDI, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8787,8 +9640,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_ESI; --l_EDI; }
             else                    { ++l_ESI; ++l_EDI; }
           }
-        break;
-      case BC_CMPS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_CMPS32_ADDR16):
         if ( jit->_mem_read32 ( jit, l_P_ES, (uint32_t)l_DI,
                                &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -8798,8 +9651,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_SI-=4; l_DI-=4; }
             else                    { l_SI+=4; l_DI+=4; }
           }
-        break;
-      case BC_CMPS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_CMPS16_ADDR16):
         if ( jit->_mem_read16 ( jit, l_P_ES, (uint32_t)l_DI,
                                &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -8809,8 +9662,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_SI-=2; l_DI-=2; }
             else                    { l_SI+=2; l_DI+=2; }
           }
-        break;
-      case BC_CMPS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_CMPS8_ADDR16):
         if ( jit->_mem_read8 ( jit, l_P_ES, (uint32_t)l_DI,
                                &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -8820,8 +9673,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_SI; --l_DI; }
             else                    { ++l_SI; ++l_DI; }
           }
-        break;
-      case BC_INS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_INS16_ADDR32):
         if ( io_check_permission ( jit, l_DX, 2 ) )
           {
             res16= jit->port_read16 ( jit->udata, l_DX );
@@ -8834,8 +9687,8 @@ exec_inst (
               }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_INS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_INS8_ADDR32):
         if ( io_check_permission ( jit, l_DX, 1 ) )
           {
             res8= jit->port_read8 ( jit->udata, l_DX );
@@ -8848,8 +9701,8 @@ exec_inst (
               }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_INS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_INS32_ADDR16):
         if ( io_check_permission ( jit, l_DX, 4 ) )
           {
             res32= jit->port_read32 ( jit->udata, l_DX );
@@ -8863,8 +9716,8 @@ exec_inst (
               }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_INS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_INS16_ADDR16):
         if ( io_check_permission ( jit, l_DX, 2 ) )
           {
             res16= jit->port_read16 ( jit->udata, l_DX );
@@ -8878,8 +9731,8 @@ exec_inst (
               }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_INS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_INS8_ADDR16):
         if ( io_check_permission ( jit, l_DX, 1 ) )
           {
             res8= jit->port_read8 ( jit->udata, l_DX );
@@ -8892,38 +9745,38 @@ exec_inst (
               }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_LODS32_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_LODS32_ADDR32):
         l_EAX= res32;
         if ( l_EFLAGS&DF_FLAG ) { l_ESI-= 4; }
         else                    { l_ESI+= 4; }
-        break;
-      case BC_LODS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_LODS16_ADDR32):
         l_AX= res16;
         if ( l_EFLAGS&DF_FLAG ) { l_ESI-= 2; }
         else                    { l_ESI+= 2; }
-        break;
-      case BC_LODS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_LODS32_ADDR16):
         l_EAX= res32;
         if ( l_EFLAGS&DF_FLAG ) { l_SI-= 4; }
         else                    { l_SI+= 4; }
-        break;
-      case BC_LODS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_LODS16_ADDR16):
         l_AX= res16;
         if ( l_EFLAGS&DF_FLAG ) { l_SI-= 2; }
         else                    { l_SI+= 2; }
-        break;
-      case BC_LODS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_LODS8_ADDR32):
         l_AL= res8;
         if ( l_EFLAGS&DF_FLAG ) { --l_ESI; }
         else                    { ++l_ESI; }
-        break;
-      case BC_LODS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_LODS8_ADDR16):
         l_AL= res8;
         if ( l_EFLAGS&DF_FLAG ) { --l_SI; }
         else                    { ++l_SI; }
-        break;
-      case BC_MOVS32_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_MOVS32_ADDR32):
         if ( jit->_mem_write32 ( jit, l_P_ES, l_EDI, res32 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8931,8 +9784,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_ESI-= 4; l_EDI-= 4; }
             else                    { l_ESI+= 4; l_EDI+= 4; }
           }
-        break;
-      case BC_MOVS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_MOVS16_ADDR32):
         if ( jit->_mem_write16 ( jit, l_P_ES, l_EDI, res16 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8940,8 +9793,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_ESI-= 2; l_EDI-= 2; }
             else                    { l_ESI+= 2; l_EDI+= 2; }
           }
-        break;
-      case BC_MOVS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_MOVS8_ADDR32):
         if ( jit->_mem_write8 ( jit, l_P_ES, l_EDI, res8 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8949,8 +9802,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_ESI; --l_EDI; }
             else                    { ++l_ESI; ++l_EDI; }
           }
-        break;
-      case BC_MOVS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_MOVS32_ADDR16):
         if ( jit->_mem_write32 ( jit, l_P_ES, (uint32_t) l_DI, res32 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8958,8 +9811,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_SI-= 4; l_DI-= 4; }
             else                    { l_SI+= 4; l_DI+= 4; }
           }
-        break;
-      case BC_MOVS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_MOVS16_ADDR16):
         if ( jit->_mem_write16 ( jit, l_P_ES, (uint32_t) l_DI, res16 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8967,8 +9820,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_SI-= 2; l_DI-= 2; }
             else                    { l_SI+= 2; l_DI+= 2; }
           }
-        break;
-      case BC_MOVS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_MOVS8_ADDR16):
         if ( jit->_mem_write8 ( jit, l_P_ES, (uint32_t) l_DI, res8 ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -8976,8 +9829,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_SI; --l_DI; }
             else                    { ++l_SI; ++l_DI; }
           }
-        break;
-      case BC_OUTS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_OUTS16_ADDR32):
         if ( io_check_permission ( jit, l_DX, 2 ) )
           {
             jit->port_write16 ( jit->udata, l_DX, res16 );
@@ -8985,8 +9838,8 @@ exec_inst (
             else                    { l_ESI+= 2; }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_OUTS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_OUTS8_ADDR32):
         if ( io_check_permission ( jit, l_DX, 1 ) )
           {
             jit->port_write8 ( jit->udata, l_DX, res8 );
@@ -8994,8 +9847,8 @@ exec_inst (
             else                    { ++l_ESI; }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_OUTS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_OUTS16_ADDR16):
         if ( io_check_permission ( jit, l_DX, 2 ) )
           {
             jit->port_write16 ( jit->udata, l_DX, res16 );
@@ -9003,8 +9856,8 @@ exec_inst (
             else                    { l_SI+= 2; }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_OUTS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_OUTS8_ADDR16):
         if ( io_check_permission ( jit, l_DX, 1 ) )
           {
             jit->port_write8 ( jit->udata, l_DX, res8 );
@@ -9012,8 +9865,8 @@ exec_inst (
             else                    { ++l_SI; }
           }
         else { exception ( jit ); goto stop; }
-        break;
-      case BC_SCAS32_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_SCAS32_ADDR32):
         if ( jit->_mem_read32 ( jit, l_P_ES, l_EDI, &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9023,8 +9876,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_EDI-= 4; }
             else                    { l_EDI+= 4; }
           }
-        break;
-      case BC_SCAS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_SCAS16_ADDR32):
         if ( jit->_mem_read16 ( jit, l_P_ES, l_EDI, &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9034,8 +9887,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_EDI-= 2; }
             else                    { l_EDI+= 2; }
           }
-        break;
-      case BC_SCAS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_SCAS8_ADDR32):
         if ( jit->_mem_read8 ( jit, l_P_ES, l_EDI, &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9045,8 +9898,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_EDI; }
             else                    { ++l_EDI; }
           }
-        break;
-      case BC_SCAS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_SCAS32_ADDR16):
         if ( jit->_mem_read32 ( jit, l_P_ES, (uint32_t)l_DI,
                                 &op32[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -9057,8 +9910,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_DI-= 4; }
             else                    { l_DI+= 4; }
           }
-        break;
-      case BC_SCAS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_SCAS16_ADDR16):
         if ( jit->_mem_read16 ( jit, l_P_ES, (uint32_t)l_DI,
                                 &op16[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -9069,8 +9922,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_DI-= 2; }
             else                    { l_DI+= 2; }
           }
-        break;
-      case BC_SCAS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_SCAS8_ADDR16):
         if ( jit->_mem_read8 ( jit, l_P_ES, (uint32_t)l_DI,
                                &op8[1], true ) != 0 )
           { exception ( jit ); goto stop; }
@@ -9081,8 +9934,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_DI; }
             else                    { ++l_DI; }
           }
-        break;
-      case BC_STOS32_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_STOS32_ADDR32):
         if ( jit->_mem_write32 ( jit, l_P_ES, l_EDI, l_EAX ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9090,8 +9943,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_EDI-= 4; }
             else                    { l_EDI+= 4; }
           }
-        break;
-      case BC_STOS32_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_STOS32_ADDR16):
         if ( jit->_mem_write32 ( jit, l_P_ES, (uint32_t)l_DI, l_EAX ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9099,8 +9952,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_DI-= 4; }
             else                    { l_DI+= 4; }
           }
-        break;
-      case BC_STOS16_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_STOS16_ADDR32):
         if ( jit->_mem_write16 ( jit, l_P_ES, l_EDI, l_AX ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9108,8 +9961,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_EDI-= 2; }
             else                    { l_EDI+= 2; }
           }
-        break;
-      case BC_STOS16_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_STOS16_ADDR16):
         if ( jit->_mem_write16 ( jit, l_P_ES, (uint32_t) l_DI, l_AX ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9117,8 +9970,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { l_DI-= 2; }
             else                    { l_DI+= 2; }
           }
-        break;
-      case BC_STOS8_ADDR32:
+        BC_NEXT;
+      BC_CASE(BC_STOS8_ADDR32):
         if ( jit->_mem_write8 ( jit, l_P_ES, (uint32_t) l_EDI, l_AL ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9126,8 +9979,8 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_EDI; }
             else                    { ++l_EDI; }
           }
-        break;
-      case BC_STOS8_ADDR16:
+        BC_NEXT;
+      BC_CASE(BC_STOS8_ADDR16):
         if ( jit->_mem_write8 ( jit, l_P_ES, (uint32_t) l_DI, l_AL ) != 0 )
           { exception ( jit ); goto stop; }
         else
@@ -9135,30 +9988,30 @@ exec_inst (
             if ( l_EFLAGS&DF_FLAG ) { --l_DI; }
             else                    { ++l_DI; }
           }
-        break;
+        BC_NEXT;
         // --> FPU WRITE
-      case BC_FPU_DS_FLOATU32_WRITE32:
+      BC_CASE(BC_FPU_DS_FLOATU32_WRITE32):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32 ( jit, l_P_DS, offset, float_u32.u32 ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_SS_FLOATU32_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SS_FLOATU32_WRITE32):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32 ( jit, l_P_SS, offset, float_u32.u32 ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_ES_FLOATU32_WRITE32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_ES_FLOATU32_WRITE32):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32 ( jit, l_P_ES, offset, float_u32.u32 ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_DS_DOUBLEU64_WRITE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DS_DOUBLEU64_WRITE):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32
@@ -9168,8 +10021,8 @@ exec_inst (
                       ( jit, l_P_DS, offset+4, double_u64.u32.h ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_SS_DOUBLEU64_WRITE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SS_DOUBLEU64_WRITE):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32
@@ -9179,8 +10032,8 @@ exec_inst (
                       ( jit, l_P_SS, offset+4, double_u64.u32.h ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_DS_LDOUBLEU80_WRITE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DS_LDOUBLEU80_WRITE):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32
@@ -9193,8 +10046,8 @@ exec_inst (
                       ( jit, l_P_DS, offset+8, ldouble_u80.u16.v4 ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_SS_LDOUBLEU80_WRITE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SS_LDOUBLEU80_WRITE):
         if ( fpu_ok )
           {
             if ( jit->_mem_write32
@@ -9207,65 +10060,65 @@ exec_inst (
                       ( jit, l_P_SS, offset+8, ldouble_u80.u16.v4 ) != 0 )
               { exception ( jit ); goto stop; }
           }
-        break;
+        BC_NEXT;
         // --> FPU
-      case BC_FPU_2XM1:
+      BC_CASE(BC_FPU_2XM1):
         if ( fpu_ok ) { fpu_ok= fpu_2xm1 ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_ABS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_ABS):
         if ( fpu_ok ) { l_FPU_REG(fpu_reg).v= fabsl ( l_FPU_REG(fpu_reg).v ); }
-        break;
-      case BC_FPU_ADD:
+        BC_NEXT;
+      BC_CASE(BC_FPU_ADD):
         if ( fpu_ok ) { fpu_ok= fpu_add ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_BEGIN_OP:
+        BC_NEXT;
+      BC_CASE(BC_FPU_BEGIN_OP):
         fpu_ok= true;
         if ( !fpu_begin_op ( jit, true ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_BEGIN_OP_CLEAR_C1:
+        BC_NEXT;
+      BC_CASE(BC_FPU_BEGIN_OP_CLEAR_C1):
         fpu_ok= true;
         if ( !fpu_begin_op ( jit, true ) ) { exception ( jit ); goto stop; }
         l_FPU_STATUS&= ~FPU_STATUS_C1;
-        break;
-      case BC_FPU_BEGIN_OP_NOCHECK:
+        BC_NEXT;
+      BC_CASE(BC_FPU_BEGIN_OP_NOCHECK):
         fpu_ok= true;
         if ( !fpu_begin_op ( jit, false ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_BSTP_SS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_BSTP_SS):
         if ( fpu_ok )
           {
             if ( !fpu_bstp ( jit, fpu_reg, l_P_SS, offset, &fpu_ok ) )
               { exception ( jit ); goto stop; }
           }
-        break;
-      case BC_FPU_CHS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_CHS):
         fpu_ok= true;
         if ( !fpu_chs ( jit ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_CLEAR_EXCP:
+        BC_NEXT;
+      BC_CASE(BC_FPU_CLEAR_EXCP):
         fpu_ok= true;
         if ( !fpu_clear_excp ( jit ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_COM:
+        BC_NEXT;
+      BC_CASE(BC_FPU_COM):
         if ( fpu_ok ) { fpu_ok= fpu_com ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_COS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_COS):
         if ( fpu_ok ) { fpu_ok= fpu_cos ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_DIV:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DIV):
         if ( fpu_ok ) { fpu_ok= fpu_div ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_DIVR:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DIVR):
         if ( fpu_ok ) { fpu_ok= fpu_divr ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK):
         if ( fpu_ok )
           {
             FPU_CHECK_INVALID_OPERAND_U64(double_u64.u64,fpu_ok= false);
             if ( fpu_ok ) { ldouble= (long double) double_u64.d; }
           }
-        break;
-      case BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_DENORMAL_SNAN:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_DENORMAL_SNAN):
         if ( fpu_ok )
           {
             FPU_CHECK_DENORMAL_VALUE_U64(double_u64.u64,fpu_ok= false);
@@ -9275,22 +10128,22 @@ exec_inst (
                 if ( fpu_ok ) { ldouble= (long double) double_u64.d; }
               }
           }
-        break;
-      case BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_FCOM:
+        BC_NEXT;
+      BC_CASE(BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_FCOM):
         if ( fpu_ok )
           {
             FPU_FCOM_CHECK_INVALID_OPERAND_U64(double_u64.u64,fpu_ok= false);
             if ( fpu_ok ) { ldouble= (long double) double_u64.d; }
           }
-        break;
-      case BC_FPU_FLOATU32_LDOUBLE_AND_CHECK:
+        BC_NEXT;
+      BC_CASE(BC_FPU_FLOATU32_LDOUBLE_AND_CHECK):
         if ( fpu_ok )
           {
             FPU_CHECK_INVALID_OPERAND_U32(float_u32.u32,fpu_ok= false);
             if ( fpu_ok ) { ldouble= (long double) float_u32.f; }
           }
-        break;
-      case BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_DENORMAL_SNAN:
+        BC_NEXT;
+      BC_CASE(BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_DENORMAL_SNAN):
         if ( fpu_ok )
           {
             FPU_CHECK_DENORMAL_VALUE_U32(float_u32.u32,fpu_ok= false);
@@ -9300,197 +10153,197 @@ exec_inst (
                 if ( fpu_ok ) { ldouble= (long double) float_u32.f; }
               }
           }
-        break;
-      case BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_FCOM:
+        BC_NEXT;
+      BC_CASE(BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_FCOM):
         if ( fpu_ok )
           {
             FPU_FCOM_CHECK_INVALID_OPERAND_U32(float_u32.u32,fpu_ok= false);
             if ( fpu_ok ) { ldouble= (long double) float_u32.f; }
           }
-        break;
-      case BC_FPU_FREE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_FREE):
         if ( fpu_ok )
           {
             fpu_reg= (l_FPU_TOP+p->v[pos+1])&0x7;
             l_FPU_REG(fpu_reg).tag= IA32_CPU_FPU_TAG_EMPTY;
           }
         ++pos;
-        break;
-      case BC_FPU_INIT:
+        BC_NEXT;
+      BC_CASE(BC_FPU_INIT):
         fpu_ok= true;
         if ( !fpu_init ( jit ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_MUL:
+        BC_NEXT;
+      BC_CASE(BC_FPU_MUL):
         if ( fpu_ok ) { fpu_ok= fpu_mul ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_PATAN:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PATAN):
         if ( fpu_ok ) { fpu_ok= fpu_patan ( jit, fpu_reg, fpu_reg2 ); }
-        break;
-      case BC_FPU_POP:
+        BC_NEXT;
+      BC_CASE(BC_FPU_POP):
         if ( fpu_ok )
           {
             l_FPU_REG(l_FPU_TOP).tag= IA32_CPU_FPU_TAG_EMPTY;
             l_FPU_TOP= (l_FPU_TOP+1)&0x7;
           }
-        break;
-      case BC_FPU_PREM:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PREM):
         if ( fpu_ok ) { fpu_ok= fpu_prem ( jit, fpu_reg, fpu_reg2 ); }
-        break;
-      case BC_FPU_PTAN:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PTAN):
         if ( fpu_ok ) { fpu_ok= fpu_ptan ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_PUSH_DOUBLEU64:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_DOUBLEU64):
         if ( fpu_ok ) fpu_push_double_u64 ( jit, double_u64 );
-        break;
-      case BC_FPU_PUSH_DOUBLEU64_AS_INT64:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_DOUBLEU64_AS_INT64):
         if ( fpu_ok ) fpu_push_double_u64_as_int64 ( jit, double_u64 );
-        break;
-      case BC_FPU_PUSH_FLOATU32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_FLOATU32):
         if ( fpu_ok ) fpu_push_float_u32 ( jit, float_u32 );
-        break;
-      case BC_FPU_PUSH_L2E:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_L2E):
         if ( fpu_ok )
           fpu_push_val ( jit, 1.4426950408889634074L, IA32_CPU_FPU_TAG_VALID );
-        break;
-      case BC_FPU_PUSH_LDOUBLEU80:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_LDOUBLEU80):
         if ( fpu_ok ) fpu_push_ldouble_u80 ( jit, ldouble_u80 );
-        break;
-      case BC_FPU_PUSH_LN2:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_LN2):
         if ( fpu_ok )
           fpu_push_val ( jit, logl ( +2.0L ), IA32_CPU_FPU_TAG_VALID );
-        break;
-      case BC_FPU_PUSH_ONE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_ONE):
         if ( fpu_ok ) fpu_push_val ( jit, +1.0L, IA32_CPU_FPU_TAG_VALID );
-        break;
-      case BC_FPU_PUSH_REG2:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_REG2):
         if ( fpu_ok ) fpu_push_reg ( jit, fpu_reg2 );
-        break;
-      case BC_FPU_PUSH_RES16:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_RES16):
         if ( fpu_ok ) fpu_push_res16 ( jit, res16 );
-        break;
-      case BC_FPU_PUSH_RES32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_RES32):
         if ( fpu_ok ) fpu_push_res32 ( jit, res32 );
-        break;
-      case BC_FPU_PUSH_ZERO:
+        BC_NEXT;
+      BC_CASE(BC_FPU_PUSH_ZERO):
         if ( fpu_ok ) fpu_push_val ( jit, +0.0L, IA32_CPU_FPU_TAG_ZERO );
-        break;
-      case BC_FPU_REG_ST:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_ST):
         if ( fpu_ok )
           {
             fpu_reg2= (l_FPU_TOP+p->v[pos+1])&0x7;
             l_FPU_REG(fpu_reg2)= l_FPU_REG(fpu_reg);
           }
         ++pos;
-        break;
-      case BC_FPU_REG_INT16:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_INT16):
         if ( fpu_ok ){fpu_ok= fpu_reg2int16 ( jit, fpu_reg, &res16 );}
-        break;
-      case BC_FPU_REG_INT32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_INT32):
         if ( fpu_ok ){fpu_ok= fpu_reg2int32 ( jit, fpu_reg, &float_u32.u32 );}
-        break;
-      case BC_FPU_REG_INT64:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_INT64):
         if ( fpu_ok ){fpu_ok= fpu_reg2int64 ( jit, fpu_reg, &double_u64.u64 );}
-        break;
-      case BC_FPU_REG_FLOATU32:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_FLOATU32):
         if ( fpu_ok ) { fpu_ok= fpu_reg2float ( jit, fpu_reg, &float_u32.f ); }
-        break;
-      case BC_FPU_REG_DOUBLEU64:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_DOUBLEU64):
         if ( fpu_ok )
           { fpu_ok= fpu_reg2double ( jit, fpu_reg, &double_u64.d ); }
-        break;
-      case BC_FPU_REG_LDOUBLEU80:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG_LDOUBLEU80):
         if ( fpu_ok ) { ldouble_u80.ld= l_FPU_REG(fpu_reg).v; }
-        break;
-      case BC_FPU_REG2_LDOUBLE_AND_CHECK:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG2_LDOUBLE_AND_CHECK):
         if ( fpu_ok )
           {
             FPU_CHECK_INVALID_OPERAND(fpu_reg2,fpu_ok= false);
             if ( fpu_ok ) { ldouble= l_FPU_REG(fpu_reg2).v; }
           }
-        break;
-      case BC_FPU_REG2_LDOUBLE_AND_CHECK_FCOM:
+        BC_NEXT;
+      BC_CASE(BC_FPU_REG2_LDOUBLE_AND_CHECK_FCOM):
         if ( fpu_ok )
           {
             FPU_FCOM_CHECK_INVALID_OPERAND(fpu_reg2,fpu_ok= false,tmp_int);
             if ( fpu_ok ) { ldouble= l_FPU_REG(fpu_reg2).v; }
           }
-        break;
-      case BC_FPU_RES16_CONTROL_WORD:
+        BC_NEXT;
+      BC_CASE(BC_FPU_RES16_CONTROL_WORD):
         if ( !fpu_load_control_word ( jit, res16 ) )
           { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_RNDINT:
+        BC_NEXT;
+      BC_CASE(BC_FPU_RNDINT):
         if ( fpu_ok ) { fpu_ok= fpu_rndint ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_RSTOR32_DS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_RSTOR32_DS):
         if ( fpu_ok ) { fpu_ok= fpu_rstor32 ( jit, l_P_DS, offset ); }
-        break;
-      case BC_FPU_SAVE32_DS:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SAVE32_DS):
         if ( fpu_ok ) { fpu_ok= fpu_save32 ( jit, l_P_DS, offset ); }
-        break;
-      case BC_FPU_SCALE:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SCALE):
         if ( fpu_ok ) { fpu_ok= fpu_scale ( jit, fpu_reg, fpu_reg2 ); }
-        break;
-      case BC_FPU_SELECT_ST0:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SELECT_ST0):
         fpu_reg= l_FPU_TOP; // ST(0)
         FPU_CHECK_STACK_UNDERFLOW(fpu_reg,fpu_ok= false);
-        break;
-      case BC_FPU_SELECT_ST1:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SELECT_ST1):
         if ( fpu_ok )
           {
             fpu_reg2= (l_FPU_TOP+1)&0x7; // ST(1)
             FPU_CHECK_STACK_UNDERFLOW(fpu_reg2,fpu_ok= false);
           }
-        break;
-      case BC_FPU_SELECT_ST_REG:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SELECT_ST_REG):
         if ( fpu_ok )
           {
             fpu_reg= (l_FPU_TOP+p->v[pos+1])&0x7;
             FPU_CHECK_STACK_UNDERFLOW(fpu_reg,fpu_ok= false);
           }
         ++pos;
-        break;
-      case BC_FPU_SELECT_ST_REG2:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SELECT_ST_REG2):
         if ( fpu_ok )
           {
             fpu_reg2= (l_FPU_TOP+p->v[pos+1])&0x7;
             FPU_CHECK_STACK_UNDERFLOW(fpu_reg2,fpu_ok= false);
           }
         ++pos;
-        break;
-      case BC_FPU_SIN:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SIN):
         if ( fpu_ok ) { fpu_ok= fpu_sin ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_SQRT:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SQRT):
         if ( fpu_ok ) { fpu_ok= fpu_sqrt ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_SUB:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SUB):
         if ( fpu_ok ) { fpu_ok= fpu_sub ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_SUBR:
+        BC_NEXT;
+      BC_CASE(BC_FPU_SUBR):
         if ( fpu_ok ) { fpu_ok= fpu_subr ( jit, fpu_reg, ldouble ); }
-        break;
-      case BC_FPU_TST:
+        BC_NEXT;
+      BC_CASE(BC_FPU_TST):
         if ( fpu_ok ) { fpu_ok= fpu_tst ( jit, fpu_reg ); }
-        break;
-      case BC_FPU_WAIT:
+        BC_NEXT;
+      BC_CASE(BC_FPU_WAIT):
         fpu_ok= true;
         if ( !fpu_wait ( jit ) ) { exception ( jit ); goto stop; }
-        break;
-      case BC_FPU_XAM: if ( fpu_ok ) fpu_xam ( jit ); break;
-      case BC_FPU_XCH:
+        BC_NEXT;
+      BC_CASE(BC_FPU_XAM): if ( fpu_ok ) fpu_xam ( jit ); BC_NEXT;
+      BC_CASE(BC_FPU_XCH):
         if ( fpu_ok )
           {
             tmp_fpu_reg= l_FPU_REG(fpu_reg);
             l_FPU_REG(fpu_reg)= l_FPU_REG(fpu_reg2);
             l_FPU_REG(fpu_reg2)= tmp_fpu_reg;
           }
-        break;
-      case BC_FPU_YL2X:
+        BC_NEXT;
+      BC_CASE(BC_FPU_YL2X):
         if ( fpu_ok ) { fpu_ok= fpu_yl2x ( jit, fpu_reg, fpu_reg2 ); }
-        break;
+        BC_NEXT;
         
-      default:
+      BC_DEFAULT:
         print_pages ( stderr, jit );
         printf ( "[EE] jit - exec_inst - instrucció desconeguda %u (pos:%d)\n",
                  p->v[pos], pos-2 );
@@ -9501,14 +10354,36 @@ exec_inst (
 #pragma GCC diagnostic pop
 
  stop:
+  // Aplica els increments de la EIP pendents.
+  l_EIP+= eip_pending;
+  eip_pending= 0;
+  
   // Fica la pàgina bloquejada en _free_pages si cal
   if ( jit->_free_lock_page )
     {
-      p->prev= NULL;
-      p->next= jit->_free_pages;
-      jit->_free_pages= p;
+      add_free_page ( jit, p );
       jit->_free_lock_page= false;
     }
   jit->_lock_page= NULL;
+
+  // Límit de memòria. Pot esborrar la pàgina actual.
+  if ( jit->_bytes > jit->_max_bytes ) shrink_pages ( jit );
+  
+  // Continua si cal.
+  ++ninsts;
+  if ( halted ) *reason= IA32_RUN_HALT;
+  else if ( jit->_stop ) { jit->_stop= false; *reason= IA32_RUN_STOP; }
+  else if ( ninsts >= budget ) *reason= IA32_RUN_BUDGET;
+  else if ( jit->_intr &&
+            !jit->_inhibit_interrupt &&
+            (l_EFLAGS&IF_FLAG) != 0 ) *reason= IA32_RUN_INTR;
+  else goto next_inst;
+#ifdef __IA32_JIT_LAZY_FLAGS__
+  lazy_flags_eval ( jit, OSZACP_FLAGS );
+#endif
+  
+  return ninsts;
   
 } // end exec_inst
+
+#undef exception
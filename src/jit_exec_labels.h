@@ -0,0 +1,948 @@
+/* Generat per scripts/bc_labels.py. NO EDITAR. */
+static const void *const BC_LABELS[BC_NUM]=
+  {
+    [0 ... BC_NUM-1]= &&L_BC_DEFAULT,
+    [BC_GOTO_EIP]= &&L_BC_GOTO_EIP,
+#ifdef IA32_JIT_NATIVE
+    [BC_NATIVE]= &&L_BC_NATIVE,
+#endif
+#ifdef __IA32_JIT_LAZY_FLAGS__
+    [BC_LAZY_FLAGS]= &&L_BC_LAZY_FLAGS,
+#endif
+    [BC_INC1_EIP]= &&L_BC_INC1_EIP,
+    [BC_INC2_EIP]= &&L_BC_INC2_EIP,
+    [BC_INC3_EIP]= &&L_BC_INC3_EIP,
+    [BC_INC4_EIP]= &&L_BC_INC4_EIP,
+    [BC_INC5_EIP]= &&L_BC_INC5_EIP,
+    [BC_INC6_EIP]= &&L_BC_INC6_EIP,
+    [BC_INC7_EIP]= &&L_BC_INC7_EIP,
+    [BC_INC8_EIP]= &&L_BC_INC8_EIP,
+    [BC_INC9_EIP]= &&L_BC_INC9_EIP,
+    [BC_INC10_EIP]= &&L_BC_INC10_EIP,
+    [BC_INC11_EIP]= &&L_BC_INC11_EIP,
+    [BC_INC12_EIP]= &&L_BC_INC12_EIP,
+    [BC_INC14_EIP]= &&L_BC_INC14_EIP,
+    [BC_INC1_EIP_NOSTOP]= &&L_BC_INC1_EIP_NOSTOP,
+    [BC_INC2_EIP_NOSTOP]= &&L_BC_INC2_EIP_NOSTOP,
+    [BC_INC3_EIP_NOSTOP]= &&L_BC_INC3_EIP_NOSTOP,
+    [BC_INC4_EIP_NOSTOP]= &&L_BC_INC4_EIP_NOSTOP,
+    [BC_INC5_EIP_NOSTOP]= &&L_BC_INC5_EIP_NOSTOP,
+    [BC_INC6_EIP_NOSTOP]= &&L_BC_INC6_EIP_NOSTOP,
+    [BC_INC7_EIP_NOSTOP]= &&L_BC_INC7_EIP_NOSTOP,
+    [BC_INC8_EIP_NOSTOP]= &&L_BC_INC8_EIP_NOSTOP,
+    [BC_INC9_EIP_NOSTOP]= &&L_BC_INC9_EIP_NOSTOP,
+    [BC_INC10_EIP_NOSTOP]= &&L_BC_INC10_EIP_NOSTOP,
+    [BC_INC11_EIP_NOSTOP]= &&L_BC_INC11_EIP_NOSTOP,
+    [BC_INC12_EIP_NOSTOP]= &&L_BC_INC12_EIP_NOSTOP,
+    [BC_INC14_EIP_NOSTOP]= &&L_BC_INC14_EIP_NOSTOP,
+    [BC_INC_EIP_DEFER]= &&L_BC_INC_EIP_DEFER,
+#ifdef __IA32_JIT_SUPERBLOCKS__
+    [BC_SB_JMP32]= &&L_BC_SB_JMP32,
+    [BC_SB_JMP16]= &&L_BC_SB_JMP16,
+    [BC_SB_BRANCH32]= &&L_BC_SB_BRANCH32,
+    [BC_SB_BRANCH16]= &&L_BC_SB_BRANCH16,
+    [BC_SB_GOTO]= &&L_BC_SB_GOTO,
+    [BC_SB_GUARD]= &&L_BC_SB_GUARD,
+#endif
+    [BC_INC1_EIP_GOTO]= &&L_BC_INC1_EIP_GOTO,
+    [BC_INC2_EIP_GOTO]= &&L_BC_INC2_EIP_GOTO,
+    [BC_INC3_EIP_GOTO]= &&L_BC_INC3_EIP_GOTO,
+    [BC_INC4_EIP_GOTO]= &&L_BC_INC4_EIP_GOTO,
+    [BC_INC5_EIP_GOTO]= &&L_BC_INC5_EIP_GOTO,
+    [BC_INC6_EIP_GOTO]= &&L_BC_INC6_EIP_GOTO,
+    [BC_INC7_EIP_GOTO]= &&L_BC_INC7_EIP_GOTO,
+    [BC_INC8_EIP_GOTO]= &&L_BC_INC8_EIP_GOTO,
+    [BC_INC9_EIP_GOTO]= &&L_BC_INC9_EIP_GOTO,
+    [BC_INC10_EIP_GOTO]= &&L_BC_INC10_EIP_GOTO,
+    [BC_INC11_EIP_GOTO]= &&L_BC_INC11_EIP_GOTO,
+    [BC_INC12_EIP_GOTO]= &&L_BC_INC12_EIP_GOTO,
+    [BC_INC14_EIP_GOTO]= &&L_BC_INC14_EIP_GOTO,
+    [BC_WRONG_INST]= &&L_BC_WRONG_INST,
+    [BC_INC2_PC_IF_ECX_IS_0]= &&L_BC_INC2_PC_IF_ECX_IS_0,
+    [BC_INC2_PC_IF_CX_IS_0]= &&L_BC_INC2_PC_IF_CX_IS_0,
+    [BC_INC4_PC_IF_ECX_IS_0]= &&L_BC_INC4_PC_IF_ECX_IS_0,
+    [BC_INC4_PC_IF_CX_IS_0]= &&L_BC_INC4_PC_IF_CX_IS_0,
+    [BC_INCIMM_PC_IF_CX_IS_0]= &&L_BC_INCIMM_PC_IF_CX_IS_0,
+    [BC_INCIMM_PC_IF_ECX_IS_0]= &&L_BC_INCIMM_PC_IF_ECX_IS_0,
+    [BC_DEC1_PC_IF_REP32]= &&L_BC_DEC1_PC_IF_REP32,
+    [BC_DEC1_PC_IF_REP16]= &&L_BC_DEC1_PC_IF_REP16,
+    [BC_DEC3_PC_IF_REP32]= &&L_BC_DEC3_PC_IF_REP32,
+    [BC_DEC3_PC_IF_REP16]= &&L_BC_DEC3_PC_IF_REP16,
+    [BC_DECIMM_PC_IF_REPE32]= &&L_BC_DECIMM_PC_IF_REPE32,
+    [BC_DECIMM_PC_IF_REPNE32]= &&L_BC_DECIMM_PC_IF_REPNE32,
+    [BC_DECIMM_PC_IF_REPE16]= &&L_BC_DECIMM_PC_IF_REPE16,
+    [BC_DECIMM_PC_IF_REPNE16]= &&L_BC_DECIMM_PC_IF_REPNE16,
+    [BC_UNK]= &&L_BC_UNK,
+    [BC_SET32_IMM_SELECTOR_OFFSET]= &&L_BC_SET32_IMM_SELECTOR_OFFSET,
+    [BC_SET32_IMM_OFFSET]= &&L_BC_SET32_IMM_OFFSET,
+    [BC_SET16_IMM_SELECTOR_OFFSET]= &&L_BC_SET16_IMM_SELECTOR_OFFSET,
+    [BC_SET16_IMM_OFFSET]= &&L_BC_SET16_IMM_OFFSET,
+    [BC_SET16_IMM_PORT]= &&L_BC_SET16_IMM_PORT,
+    [BC_SET32_EAX_OFFSET]= &&L_BC_SET32_EAX_OFFSET,
+    [BC_SET32_ECX_OFFSET]= &&L_BC_SET32_ECX_OFFSET,
+    [BC_SET32_EDX_OFFSET]= &&L_BC_SET32_EDX_OFFSET,
+    [BC_SET32_EBX_OFFSET]= &&L_BC_SET32_EBX_OFFSET,
+    [BC_SET32_EBX_AL_OFFSET]= &&L_BC_SET32_EBX_AL_OFFSET,
+    [BC_SET32_EBP_OFFSET]= &&L_BC_SET32_EBP_OFFSET,
+    [BC_SET32_ESI_OFFSET]= &&L_BC_SET32_ESI_OFFSET,
+    [BC_SET32_EDI_OFFSET]= &&L_BC_SET32_EDI_OFFSET,
+    [BC_SET32_ESP_OFFSET]= &&L_BC_SET32_ESP_OFFSET,
+    [BC_SET16_SI_OFFSET]= &&L_BC_SET16_SI_OFFSET,
+    [BC_SET16_DI_OFFSET]= &&L_BC_SET16_DI_OFFSET,
+    [BC_SET16_BP_OFFSET]= &&L_BC_SET16_BP_OFFSET,
+    [BC_SET16_BP_SI_OFFSET]= &&L_BC_SET16_BP_SI_OFFSET,
+    [BC_SET16_BP_DI_OFFSET]= &&L_BC_SET16_BP_DI_OFFSET,
+    [BC_SET16_BX_OFFSET]= &&L_BC_SET16_BX_OFFSET,
+    [BC_SET16_BX_AL_OFFSET]= &&L_BC_SET16_BX_AL_OFFSET,
+    [BC_SET16_BX_SI_OFFSET]= &&L_BC_SET16_BX_SI_OFFSET,
+    [BC_SET16_BX_DI_OFFSET]= &&L_BC_SET16_BX_DI_OFFSET,
+    [BC_SET16_DX_PORT]= &&L_BC_SET16_DX_PORT,
+    [BC_ADD32_BITOFFSETOP1_OFFSET]= &&L_BC_ADD32_BITOFFSETOP1_OFFSET,
+    [BC_ADD32_IMM_OFFSET]= &&L_BC_ADD32_IMM_OFFSET,
+    [BC_ADD32_EAX_OFFSET]= &&L_BC_ADD32_EAX_OFFSET,
+    [BC_ADD32_ECX_OFFSET]= &&L_BC_ADD32_ECX_OFFSET,
+    [BC_ADD32_EDX_OFFSET]= &&L_BC_ADD32_EDX_OFFSET,
+    [BC_ADD32_EBX_OFFSET]= &&L_BC_ADD32_EBX_OFFSET,
+    [BC_ADD32_EBP_OFFSET]= &&L_BC_ADD32_EBP_OFFSET,
+    [BC_ADD32_ESI_OFFSET]= &&L_BC_ADD32_ESI_OFFSET,
+    [BC_ADD32_EDI_OFFSET]= &&L_BC_ADD32_EDI_OFFSET,
+    [BC_ADD32_EAX_2_OFFSET]= &&L_BC_ADD32_EAX_2_OFFSET,
+    [BC_ADD32_ECX_2_OFFSET]= &&L_BC_ADD32_ECX_2_OFFSET,
+    [BC_ADD32_EDX_2_OFFSET]= &&L_BC_ADD32_EDX_2_OFFSET,
+    [BC_ADD32_EBX_2_OFFSET]= &&L_BC_ADD32_EBX_2_OFFSET,
+    [BC_ADD32_EBP_2_OFFSET]= &&L_BC_ADD32_EBP_2_OFFSET,
+    [BC_ADD32_ESI_2_OFFSET]= &&L_BC_ADD32_ESI_2_OFFSET,
+    [BC_ADD32_EDI_2_OFFSET]= &&L_BC_ADD32_EDI_2_OFFSET,
+    [BC_ADD32_EAX_4_OFFSET]= &&L_BC_ADD32_EAX_4_OFFSET,
+    [BC_ADD32_ECX_4_OFFSET]= &&L_BC_ADD32_ECX_4_OFFSET,
+    [BC_ADD32_EDX_4_OFFSET]= &&L_BC_ADD32_EDX_4_OFFSET,
+    [BC_ADD32_EBX_4_OFFSET]= &&L_BC_ADD32_EBX_4_OFFSET,
+    [BC_ADD32_EBP_4_OFFSET]= &&L_BC_ADD32_EBP_4_OFFSET,
+    [BC_ADD32_ESI_4_OFFSET]= &&L_BC_ADD32_ESI_4_OFFSET,
+    [BC_ADD32_EDI_4_OFFSET]= &&L_BC_ADD32_EDI_4_OFFSET,
+    [BC_ADD32_EAX_8_OFFSET]= &&L_BC_ADD32_EAX_8_OFFSET,
+    [BC_ADD32_ECX_8_OFFSET]= &&L_BC_ADD32_ECX_8_OFFSET,
+    [BC_ADD32_EDX_8_OFFSET]= &&L_BC_ADD32_EDX_8_OFFSET,
+    [BC_ADD32_EBX_8_OFFSET]= &&L_BC_ADD32_EBX_8_OFFSET,
+    [BC_ADD32_EBP_8_OFFSET]= &&L_BC_ADD32_EBP_8_OFFSET,
+    [BC_ADD32_ESI_8_OFFSET]= &&L_BC_ADD32_ESI_8_OFFSET,
+    [BC_ADD32_EDI_8_OFFSET]= &&L_BC_ADD32_EDI_8_OFFSET,
+    [BC_ADD16_IMM_OFFSET]= &&L_BC_ADD16_IMM_OFFSET,
+    [BC_ADD16_IMM_OFFSET16]= &&L_BC_ADD16_IMM_OFFSET16,
+    [BC_SET_A_COND]= &&L_BC_SET_A_COND,
+    [BC_SET_AE_COND]= &&L_BC_SET_AE_COND,
+    [BC_SET_B_COND]= &&L_BC_SET_B_COND,
+    [BC_SET_CXZ_COND]= &&L_BC_SET_CXZ_COND,
+    [BC_SET_E_COND]= &&L_BC_SET_E_COND,
+    [BC_SET_ECXZ_COND]= &&L_BC_SET_ECXZ_COND,
+    [BC_SET_G_COND]= &&L_BC_SET_G_COND,
+    [BC_SET_GE_COND]= &&L_BC_SET_GE_COND,
+    [BC_SET_L_COND]= &&L_BC_SET_L_COND,
+    [BC_SET_NA_COND]= &&L_BC_SET_NA_COND,
+    [BC_SET_NE_COND]= &&L_BC_SET_NE_COND,
+    [BC_SET_NG_COND]= &&L_BC_SET_NG_COND,
+    [BC_SET_NO_COND]= &&L_BC_SET_NO_COND,
+    [BC_SET_NS_COND]= &&L_BC_SET_NS_COND,
+    [BC_SET_O_COND]= &&L_BC_SET_O_COND,
+    [BC_SET_P_COND]= &&L_BC_SET_P_COND,
+    [BC_SET_PO_COND]= &&L_BC_SET_PO_COND,
+    [BC_SET_S_COND]= &&L_BC_SET_S_COND,
+    [BC_SET_DEC_ECX_NOT_ZERO_COND]= &&L_BC_SET_DEC_ECX_NOT_ZERO_COND,
+    [BC_SET_DEC_ECX_NOT_ZERO_AND_ZF_COND]= &&L_BC_SET_DEC_ECX_NOT_ZERO_AND_ZF_COND,
+    [BC_SET_DEC_ECX_NOT_ZERO_AND_NOT_ZF_COND]= &&L_BC_SET_DEC_ECX_NOT_ZERO_AND_NOT_ZF_COND,
+    [BC_SET_DEC_CX_NOT_ZERO_COND]= &&L_BC_SET_DEC_CX_NOT_ZERO_COND,
+    [BC_SET_DEC_CX_NOT_ZERO_AND_ZF_COND]= &&L_BC_SET_DEC_CX_NOT_ZERO_AND_ZF_COND,
+    [BC_SET_DEC_CX_NOT_ZERO_AND_NOT_ZF_COND]= &&L_BC_SET_DEC_CX_NOT_ZERO_AND_NOT_ZF_COND,
+    [BC_SET_1_COUNT]= &&L_BC_SET_1_COUNT,
+    [BC_SET_CL_COUNT]= &&L_BC_SET_CL_COUNT,
+    [BC_SET_CL_COUNT_NOMOD]= &&L_BC_SET_CL_COUNT_NOMOD,
+    [BC_SET_IMM_COUNT]= &&L_BC_SET_IMM_COUNT,
+    [BC_SET32_AD_OF_EFLAGS]= &&L_BC_SET32_AD_OF_EFLAGS,
+    [BC_SET32_AD_AF_EFLAGS]= &&L_BC_SET32_AD_AF_EFLAGS,
+    [BC_SET32_AD_CF_EFLAGS]= &&L_BC_SET32_AD_CF_EFLAGS,
+    [BC_SET32_MUL_CFOF_EFLAGS]= &&L_BC_SET32_MUL_CFOF_EFLAGS,
+    [BC_SET32_MUL1_CFOF_EFLAGS]= &&L_BC_SET32_MUL1_CFOF_EFLAGS,
+    [BC_SET32_IMUL1_CFOF_EFLAGS]= &&L_BC_SET32_IMUL1_CFOF_EFLAGS,
+    [BC_SET32_NEG_CF_EFLAGS]= &&L_BC_SET32_NEG_CF_EFLAGS,
+    [BC_SET32_RCL_OF_EFLAGS]= &&L_BC_SET32_RCL_OF_EFLAGS,
+    [BC_SET32_RCL_CF_EFLAGS]= &&L_BC_SET32_RCL_CF_EFLAGS,
+    [BC_SET32_RCR_OF_EFLAGS]= &&L_BC_SET32_RCR_OF_EFLAGS,
+    [BC_SET32_RCR_CF_EFLAGS]= &&L_BC_SET32_RCR_CF_EFLAGS,
+    [BC_SET32_ROL_CF_EFLAGS]= &&L_BC_SET32_ROL_CF_EFLAGS,
+    [BC_SET32_ROR_OF_EFLAGS]= &&L_BC_SET32_ROR_OF_EFLAGS,
+    [BC_SET32_ROR_CF_EFLAGS]= &&L_BC_SET32_ROR_CF_EFLAGS,
+    [BC_SET32_SAR_OF_EFLAGS]= &&L_BC_SET32_SAR_OF_EFLAGS,
+    [BC_SET32_SAR_CF_EFLAGS]= &&L_BC_SET32_SAR_CF_EFLAGS,
+    [BC_SET32_SHIFT_SF_EFLAGS]= &&L_BC_SET32_SHIFT_SF_EFLAGS,
+    [BC_SET32_SHIFT_ZF_EFLAGS]= &&L_BC_SET32_SHIFT_ZF_EFLAGS,
+    [BC_SET32_SHIFT_PF_EFLAGS]= &&L_BC_SET32_SHIFT_PF_EFLAGS,
+    [BC_SET32_SHL_OF_EFLAGS]= &&L_BC_SET32_SHL_OF_EFLAGS,
+    [BC_SET32_SHL_CF_EFLAGS]= &&L_BC_SET32_SHL_CF_EFLAGS,
+    [BC_SET32_SHLD_OF_EFLAGS]= &&L_BC_SET32_SHLD_OF_EFLAGS,
+    [BC_SET32_SHLD_CF_EFLAGS]= &&L_BC_SET32_SHLD_CF_EFLAGS,
+    [BC_SET32_SHR_OF_EFLAGS]= &&L_BC_SET32_SHR_OF_EFLAGS,
+    [BC_SET32_SHR_CF_EFLAGS]= &&L_BC_SET32_SHR_CF_EFLAGS,
+    [BC_SET32_SHRD_OF_EFLAGS]= &&L_BC_SET32_SHRD_OF_EFLAGS,
+    [BC_SET32_SHRD_CF_EFLAGS]= &&L_BC_SET32_SHRD_CF_EFLAGS,
+    [BC_SET32_SB_OF_EFLAGS]= &&L_BC_SET32_SB_OF_EFLAGS,
+    [BC_SET32_SB_AF_EFLAGS]= &&L_BC_SET32_SB_AF_EFLAGS,
+    [BC_SET32_SB_CF_EFLAGS]= &&L_BC_SET32_SB_CF_EFLAGS,
+    [BC_SET32_SF_EFLAGS]= &&L_BC_SET32_SF_EFLAGS,
+    [BC_SET32_ZF_EFLAGS]= &&L_BC_SET32_ZF_EFLAGS,
+    [BC_SET32_PF_EFLAGS]= &&L_BC_SET32_PF_EFLAGS,
+    [BC_SET32_AD_EFLAGS]= &&L_BC_SET32_AD_EFLAGS,
+    [BC_SET32_SB_EFLAGS]= &&L_BC_SET32_SB_EFLAGS,
+    [BC_SET32_LOP_EFLAGS]= &&L_BC_SET32_LOP_EFLAGS,
+    [BC_SET16_AD_OF_EFLAGS]= &&L_BC_SET16_AD_OF_EFLAGS,
+    [BC_SET16_AD_AF_EFLAGS]= &&L_BC_SET16_AD_AF_EFLAGS,
+    [BC_SET16_AD_CF_EFLAGS]= &&L_BC_SET16_AD_CF_EFLAGS,
+    [BC_SET16_MUL_CFOF_EFLAGS]= &&L_BC_SET16_MUL_CFOF_EFLAGS,
+    [BC_SET16_MUL1_CFOF_EFLAGS]= &&L_BC_SET16_MUL1_CFOF_EFLAGS,
+    [BC_SET16_IMUL1_CFOF_EFLAGS]= &&L_BC_SET16_IMUL1_CFOF_EFLAGS,
+    [BC_SET16_NEG_CF_EFLAGS]= &&L_BC_SET16_NEG_CF_EFLAGS,
+    [BC_SET16_RCL_OF_EFLAGS]= &&L_BC_SET16_RCL_OF_EFLAGS,
+    [BC_SET16_RCL_CF_EFLAGS]= &&L_BC_SET16_RCL_CF_EFLAGS,
+    [BC_SET16_RCR_OF_EFLAGS]= &&L_BC_SET16_RCR_OF_EFLAGS,
+    [BC_SET16_RCR_CF_EFLAGS]= &&L_BC_SET16_RCR_CF_EFLAGS,
+    [BC_SET16_ROL_CF_EFLAGS]= &&L_BC_SET16_ROL_CF_EFLAGS,
+    [BC_SET16_ROR_OF_EFLAGS]= &&L_BC_SET16_ROR_OF_EFLAGS,
+    [BC_SET16_ROR_CF_EFLAGS]= &&L_BC_SET16_ROR_CF_EFLAGS,
+    [BC_SET16_SAR_CF_EFLAGS]= &&L_BC_SET16_SAR_CF_EFLAGS,
+    [BC_SET16_SHIFT_SF_EFLAGS]= &&L_BC_SET16_SHIFT_SF_EFLAGS,
+    [BC_SET16_SHIFT_ZF_EFLAGS]= &&L_BC_SET16_SHIFT_ZF_EFLAGS,
+    [BC_SET16_SHIFT_PF_EFLAGS]= &&L_BC_SET16_SHIFT_PF_EFLAGS,
+    [BC_SET16_SHL_OF_EFLAGS]= &&L_BC_SET16_SHL_OF_EFLAGS,
+    [BC_SET16_SHL_CF_EFLAGS]= &&L_BC_SET16_SHL_CF_EFLAGS,
+    [BC_SET16_SHLD_OF_EFLAGS]= &&L_BC_SET16_SHLD_OF_EFLAGS,
+    [BC_SET16_SHLD_CF_EFLAGS]= &&L_BC_SET16_SHLD_CF_EFLAGS,
+    [BC_SET16_SHR_OF_EFLAGS]= &&L_BC_SET16_SHR_OF_EFLAGS,
+    [BC_SET16_SHR_CF_EFLAGS]= &&L_BC_SET16_SHR_CF_EFLAGS,
+    [BC_SET16_SHRD_OF_EFLAGS]= &&L_BC_SET16_SHRD_OF_EFLAGS,
+    [BC_SET16_SHRD_CF_EFLAGS]= &&L_BC_SET16_SHRD_CF_EFLAGS,
+    [BC_SET16_SB_OF_EFLAGS]= &&L_BC_SET16_SB_OF_EFLAGS,
+    [BC_SET16_SB_AF_EFLAGS]= &&L_BC_SET16_SB_AF_EFLAGS,
+    [BC_SET16_SB_CF_EFLAGS]= &&L_BC_SET16_SB_CF_EFLAGS,
+    [BC_SET16_SF_EFLAGS]= &&L_BC_SET16_SF_EFLAGS,
+    [BC_SET16_ZF_EFLAGS]= &&L_BC_SET16_ZF_EFLAGS,
+    [BC_SET16_AD_EFLAGS]= &&L_BC_SET16_AD_EFLAGS,
+    [BC_SET16_SB_EFLAGS]= &&L_BC_SET16_SB_EFLAGS,
+    [BC_SET16_LOP_EFLAGS]= &&L_BC_SET16_LOP_EFLAGS,
+    [BC_SET16_PF_EFLAGS]= &&L_BC_SET16_PF_EFLAGS,
+    [BC_SET8_AD_OF_EFLAGS]= &&L_BC_SET8_AD_OF_EFLAGS,
+    [BC_SET8_AD_AF_EFLAGS]= &&L_BC_SET8_AD_AF_EFLAGS,
+    [BC_SET8_AD_CF_EFLAGS]= &&L_BC_SET8_AD_CF_EFLAGS,
+    [BC_SET8_MUL1_CFOF_EFLAGS]= &&L_BC_SET8_MUL1_CFOF_EFLAGS,
+    [BC_SET8_IMUL1_CFOF_EFLAGS]= &&L_BC_SET8_IMUL1_CFOF_EFLAGS,
+    [BC_SET8_NEG_CF_EFLAGS]= &&L_BC_SET8_NEG_CF_EFLAGS,
+    [BC_SET8_SAR_CF_EFLAGS]= &&L_BC_SET8_SAR_CF_EFLAGS,
+    [BC_SET8_RCL_OF_EFLAGS]= &&L_BC_SET8_RCL_OF_EFLAGS,
+    [BC_SET8_RCL_CF_EFLAGS]= &&L_BC_SET8_RCL_CF_EFLAGS,
+    [BC_SET8_RCR_OF_EFLAGS]= &&L_BC_SET8_RCR_OF_EFLAGS,
+    [BC_SET8_RCR_CF_EFLAGS]= &&L_BC_SET8_RCR_CF_EFLAGS,
+    [BC_SET8_ROL_CF_EFLAGS]= &&L_BC_SET8_ROL_CF_EFLAGS,
+    [BC_SET8_ROR_OF_EFLAGS]= &&L_BC_SET8_ROR_OF_EFLAGS,
+    [BC_SET8_ROR_CF_EFLAGS]= &&L_BC_SET8_ROR_CF_EFLAGS,
+    [BC_SET8_SHIFT_SF_EFLAGS]= &&L_BC_SET8_SHIFT_SF_EFLAGS,
+    [BC_SET8_SHIFT_ZF_EFLAGS]= &&L_BC_SET8_SHIFT_ZF_EFLAGS,
+    [BC_SET8_SHIFT_PF_EFLAGS]= &&L_BC_SET8_SHIFT_PF_EFLAGS,
+    [BC_SET8_SHL_OF_EFLAGS]= &&L_BC_SET8_SHL_OF_EFLAGS,
+    [BC_SET8_SHL_CF_EFLAGS]= &&L_BC_SET8_SHL_CF_EFLAGS,
+    [BC_SET8_SHR_OF_EFLAGS]= &&L_BC_SET8_SHR_OF_EFLAGS,
+    [BC_SET8_SHR_CF_EFLAGS]= &&L_BC_SET8_SHR_CF_EFLAGS,
+    [BC_SET8_SB_OF_EFLAGS]= &&L_BC_SET8_SB_OF_EFLAGS,
+    [BC_SET8_SB_AF_EFLAGS]= &&L_BC_SET8_SB_AF_EFLAGS,
+    [BC_SET8_SB_CF_EFLAGS]= &&L_BC_SET8_SB_CF_EFLAGS,
+    [BC_SET8_SF_EFLAGS]= &&L_BC_SET8_SF_EFLAGS,
+    [BC_SET8_ZF_EFLAGS]= &&L_BC_SET8_ZF_EFLAGS,
+    [BC_SET8_PF_EFLAGS]= &&L_BC_SET8_PF_EFLAGS,
+    [BC_CLEAR_OF_CF_EFLAGS]= &&L_BC_CLEAR_OF_CF_EFLAGS,
+    [BC_CLEAR_CF_EFLAGS]= &&L_BC_CLEAR_CF_EFLAGS,
+    [BC_CLEAR_DF_EFLAGS]= &&L_BC_CLEAR_DF_EFLAGS,
+    [BC_SET_CF_EFLAGS]= &&L_BC_SET_CF_EFLAGS,
+    [BC_SET_DF_EFLAGS]= &&L_BC_SET_DF_EFLAGS,
+    [BC_CLEAR_TS_CR0]= &&L_BC_CLEAR_TS_CR0,
+    [BC_SET32_SIMM_RES]= &&L_BC_SET32_SIMM_RES,
+    [BC_SET32_SIMM_OP0]= &&L_BC_SET32_SIMM_OP0,
+    [BC_SET32_SIMM_OP1]= &&L_BC_SET32_SIMM_OP1,
+    [BC_SET32_IMM32_RES]= &&L_BC_SET32_IMM32_RES,
+    [BC_SET32_IMM32_OP0]= &&L_BC_SET32_IMM32_OP0,
+    [BC_SET32_IMM32_OP1]= &&L_BC_SET32_IMM32_OP1,
+    [BC_SET16_IMM_RES]= &&L_BC_SET16_IMM_RES,
+    [BC_SET16_IMM_OP0]= &&L_BC_SET16_IMM_OP0,
+    [BC_SET16_IMM_OP1]= &&L_BC_SET16_IMM_OP1,
+    [BC_SET8_IMM_RES]= &&L_BC_SET8_IMM_RES,
+    [BC_SET8_IMM_OP0]= &&L_BC_SET8_IMM_OP0,
+    [BC_SET8_IMM_OP1]= &&L_BC_SET8_IMM_OP1,
+    [BC_SET32_1_OP1]= &&L_BC_SET32_1_OP1,
+    [BC_SET32_OP0_OP1_0_OP0]= &&L_BC_SET32_OP0_OP1_0_OP0,
+    [BC_SET32_OP0_RES]= &&L_BC_SET32_OP0_RES,
+    [BC_SET32_OP1_RES]= &&L_BC_SET32_OP1_RES,
+    [BC_SET32_DR7_RES]= &&L_BC_SET32_DR7_RES,
+    [BC_SET32_DR7_OP0]= &&L_BC_SET32_DR7_OP0,
+    [BC_SET32_DR7_OP1]= &&L_BC_SET32_DR7_OP1,
+    [BC_SET32_CR0_RES_NOCHECK]= &&L_BC_SET32_CR0_RES_NOCHECK,
+    [BC_SET32_CR0_RES]= &&L_BC_SET32_CR0_RES,
+    [BC_SET32_CR0_OP0]= &&L_BC_SET32_CR0_OP0,
+    [BC_SET32_CR0_OP1]= &&L_BC_SET32_CR0_OP1,
+    [BC_SET32_CR2_RES]= &&L_BC_SET32_CR2_RES,
+    [BC_SET32_CR2_OP0]= &&L_BC_SET32_CR2_OP0,
+    [BC_SET32_CR2_OP1]= &&L_BC_SET32_CR2_OP1,
+    [BC_SET32_CR3_RES]= &&L_BC_SET32_CR3_RES,
+    [BC_SET32_CR3_OP0]= &&L_BC_SET32_CR3_OP0,
+    [BC_SET32_CR3_OP1]= &&L_BC_SET32_CR3_OP1,
+    [BC_SET32_EAX_RES]= &&L_BC_SET32_EAX_RES,
+    [BC_SET32_EAX_OP0]= &&L_BC_SET32_EAX_OP0,
+    [BC_SET32_EAX_OP1]= &&L_BC_SET32_EAX_OP1,
+    [BC_SET32_ECX_RES]= &&L_BC_SET32_ECX_RES,
+    [BC_SET32_ECX_OP0]= &&L_BC_SET32_ECX_OP0,
+    [BC_SET32_ECX_OP1]= &&L_BC_SET32_ECX_OP1,
+    [BC_SET32_EDX_RES]= &&L_BC_SET32_EDX_RES,
+    [BC_SET32_EDX_OP0]= &&L_BC_SET32_EDX_OP0,
+    [BC_SET32_EDX_OP1]= &&L_BC_SET32_EDX_OP1,
+    [BC_SET32_EBX_RES]= &&L_BC_SET32_EBX_RES,
+    [BC_SET32_EBX_OP0]= &&L_BC_SET32_EBX_OP0,
+    [BC_SET32_EBX_OP1]= &&L_BC_SET32_EBX_OP1,
+    [BC_SET32_ESP_RES]= &&L_BC_SET32_ESP_RES,
+    [BC_SET32_ESP_OP0]= &&L_BC_SET32_ESP_OP0,
+    [BC_SET32_ESP_OP1]= &&L_BC_SET32_ESP_OP1,
+    [BC_SET32_EBP_RES]= &&L_BC_SET32_EBP_RES,
+    [BC_SET32_EBP_OP0]= &&L_BC_SET32_EBP_OP0,
+    [BC_SET32_EBP_OP1]= &&L_BC_SET32_EBP_OP1,
+    [BC_SET32_ESI_RES]= &&L_BC_SET32_ESI_RES,
+    [BC_SET32_ESI_OP0]= &&L_BC_SET32_ESI_OP0,
+    [BC_SET32_ESI_OP1]= &&L_BC_SET32_ESI_OP1,
+    [BC_SET32_EDI_RES]= &&L_BC_SET32_EDI_RES,
+    [BC_SET32_EDI_OP0]= &&L_BC_SET32_EDI_OP0,
+    [BC_SET32_EDI_OP1]= &&L_BC_SET32_EDI_OP1,
+    [BC_SET32_ES_RES]= &&L_BC_SET32_ES_RES,
+    [BC_SET32_ES_OP0]= &&L_BC_SET32_ES_OP0,
+    [BC_SET32_ES_OP1]= &&L_BC_SET32_ES_OP1,
+    [BC_SET32_CS_RES]= &&L_BC_SET32_CS_RES,
+    [BC_SET32_CS_OP0]= &&L_BC_SET32_CS_OP0,
+    [BC_SET32_CS_OP1]= &&L_BC_SET32_CS_OP1,
+    [BC_SET32_SS_RES]= &&L_BC_SET32_SS_RES,
+    [BC_SET32_SS_OP0]= &&L_BC_SET32_SS_OP0,
+    [BC_SET32_SS_OP1]= &&L_BC_SET32_SS_OP1,
+    [BC_SET32_DS_RES]= &&L_BC_SET32_DS_RES,
+    [BC_SET32_DS_OP0]= &&L_BC_SET32_DS_OP0,
+    [BC_SET32_DS_OP1]= &&L_BC_SET32_DS_OP1,
+    [BC_SET32_FS_RES]= &&L_BC_SET32_FS_RES,
+    [BC_SET32_FS_OP0]= &&L_BC_SET32_FS_OP0,
+    [BC_SET32_FS_OP1]= &&L_BC_SET32_FS_OP1,
+    [BC_SET32_GS_RES]= &&L_BC_SET32_GS_RES,
+    [BC_SET32_GS_OP0]= &&L_BC_SET32_GS_OP0,
+    [BC_SET32_GS_OP1]= &&L_BC_SET32_GS_OP1,
+    [BC_SET16_FPUCONTROL_RES]= &&L_BC_SET16_FPUCONTROL_RES,
+    [BC_SET16_FPUSTATUSTOP_RES]= &&L_BC_SET16_FPUSTATUSTOP_RES,
+    [BC_SET16_1_OP1]= &&L_BC_SET16_1_OP1,
+    [BC_SET16_OP0_OP1_0_OP0]= &&L_BC_SET16_OP0_OP1_0_OP0,
+    [BC_SET16_OP0_RES]= &&L_BC_SET16_OP0_RES,
+    [BC_SET16_OP1_RES]= &&L_BC_SET16_OP1_RES,
+    [BC_SET16_CR0_RES_NOCHECK]= &&L_BC_SET16_CR0_RES_NOCHECK,
+    [BC_SET16_LDTR_RES]= &&L_BC_SET16_LDTR_RES,
+    [BC_SET16_TR_RES]= &&L_BC_SET16_TR_RES,
+    [BC_SET16_AX_RES]= &&L_BC_SET16_AX_RES,
+    [BC_SET16_AX_OP0]= &&L_BC_SET16_AX_OP0,
+    [BC_SET16_AX_OP1]= &&L_BC_SET16_AX_OP1,
+    [BC_SET16_CX_RES]= &&L_BC_SET16_CX_RES,
+    [BC_SET16_CX_OP0]= &&L_BC_SET16_CX_OP0,
+    [BC_SET16_CX_OP1]= &&L_BC_SET16_CX_OP1,
+    [BC_SET16_DX_RES]= &&L_BC_SET16_DX_RES,
+    [BC_SET16_DX_OP0]= &&L_BC_SET16_DX_OP0,
+    [BC_SET16_DX_OP1]= &&L_BC_SET16_DX_OP1,
+    [BC_SET16_BX_RES]= &&L_BC_SET16_BX_RES,
+    [BC_SET16_BX_OP0]= &&L_BC_SET16_BX_OP0,
+    [BC_SET16_BX_OP1]= &&L_BC_SET16_BX_OP1,
+    [BC_SET16_SP_RES]= &&L_BC_SET16_SP_RES,
+    [BC_SET16_SP_OP0]= &&L_BC_SET16_SP_OP0,
+    [BC_SET16_SP_OP1]= &&L_BC_SET16_SP_OP1,
+    [BC_SET16_BP_RES]= &&L_BC_SET16_BP_RES,
+    [BC_SET16_BP_OP0]= &&L_BC_SET16_BP_OP0,
+    [BC_SET16_BP_OP1]= &&L_BC_SET16_BP_OP1,
+    [BC_SET16_SI_RES]= &&L_BC_SET16_SI_RES,
+    [BC_SET16_SI_OP0]= &&L_BC_SET16_SI_OP0,
+    [BC_SET16_SI_OP1]= &&L_BC_SET16_SI_OP1,
+    [BC_SET16_DI_RES]= &&L_BC_SET16_DI_RES,
+    [BC_SET16_DI_OP0]= &&L_BC_SET16_DI_OP0,
+    [BC_SET16_DI_OP1]= &&L_BC_SET16_DI_OP1,
+    [BC_SET16_ES_RES]= &&L_BC_SET16_ES_RES,
+    [BC_SET16_ES_OP0]= &&L_BC_SET16_ES_OP0,
+    [BC_SET16_ES_OP1]= &&L_BC_SET16_ES_OP1,
+    [BC_SET16_CS_RES]= &&L_BC_SET16_CS_RES,
+    [BC_SET16_CS_OP0]= &&L_BC_SET16_CS_OP0,
+    [BC_SET16_CS_OP1]= &&L_BC_SET16_CS_OP1,
+    [BC_SET16_SS_RES]= &&L_BC_SET16_SS_RES,
+    [BC_SET16_SS_OP0]= &&L_BC_SET16_SS_OP0,
+    [BC_SET16_SS_OP1]= &&L_BC_SET16_SS_OP1,
+    [BC_SET16_DS_RES]= &&L_BC_SET16_DS_RES,
+    [BC_SET16_DS_OP0]= &&L_BC_SET16_DS_OP0,
+    [BC_SET16_DS_OP1]= &&L_BC_SET16_DS_OP1,
+    [BC_SET16_FS_RES]= &&L_BC_SET16_FS_RES,
+    [BC_SET16_FS_OP0]= &&L_BC_SET16_FS_OP0,
+    [BC_SET16_FS_OP1]= &&L_BC_SET16_FS_OP1,
+    [BC_SET16_GS_RES]= &&L_BC_SET16_GS_RES,
+    [BC_SET16_GS_OP0]= &&L_BC_SET16_GS_OP0,
+    [BC_SET16_GS_OP1]= &&L_BC_SET16_GS_OP1,
+    [BC_SET8_COND_RES]= &&L_BC_SET8_COND_RES,
+    [BC_SET8_OP0_OP1_0_OP0]= &&L_BC_SET8_OP0_OP1_0_OP0,
+    [BC_SET8_1_OP1]= &&L_BC_SET8_1_OP1,
+    [BC_SET8_OP0_RES]= &&L_BC_SET8_OP0_RES,
+    [BC_SET8_OP1_RES]= &&L_BC_SET8_OP1_RES,
+    [BC_SET8_AL_RES]= &&L_BC_SET8_AL_RES,
+    [BC_SET8_AL_OP0]= &&L_BC_SET8_AL_OP0,
+    [BC_SET8_AL_OP1]= &&L_BC_SET8_AL_OP1,
+    [BC_SET8_CL_RES]= &&L_BC_SET8_CL_RES,
+    [BC_SET8_CL_OP0]= &&L_BC_SET8_CL_OP0,
+    [BC_SET8_CL_OP1]= &&L_BC_SET8_CL_OP1,
+    [BC_SET8_DL_RES]= &&L_BC_SET8_DL_RES,
+    [BC_SET8_DL_OP0]= &&L_BC_SET8_DL_OP0,
+    [BC_SET8_DL_OP1]= &&L_BC_SET8_DL_OP1,
+    [BC_SET8_BL_RES]= &&L_BC_SET8_BL_RES,
+    [BC_SET8_BL_OP0]= &&L_BC_SET8_BL_OP0,
+    [BC_SET8_BL_OP1]= &&L_BC_SET8_BL_OP1,
+    [BC_SET8_AH_RES]= &&L_BC_SET8_AH_RES,
+    [BC_SET8_AH_OP0]= &&L_BC_SET8_AH_OP0,
+    [BC_SET8_AH_OP1]= &&L_BC_SET8_AH_OP1,
+    [BC_SET8_CH_RES]= &&L_BC_SET8_CH_RES,
+    [BC_SET8_CH_OP0]= &&L_BC_SET8_CH_OP0,
+    [BC_SET8_CH_OP1]= &&L_BC_SET8_CH_OP1,
+    [BC_SET8_DH_RES]= &&L_BC_SET8_DH_RES,
+    [BC_SET8_DH_OP0]= &&L_BC_SET8_DH_OP0,
+    [BC_SET8_DH_OP1]= &&L_BC_SET8_DH_OP1,
+    [BC_SET8_BH_RES]= &&L_BC_SET8_BH_RES,
+    [BC_SET8_BH_OP0]= &&L_BC_SET8_BH_OP0,
+    [BC_SET8_BH_OP1]= &&L_BC_SET8_BH_OP1,
+    [BC_SET32_RES_FLOATU32]= &&L_BC_SET32_RES_FLOATU32,
+    [BC_SET32_RES_DOUBLEU64L]= &&L_BC_SET32_RES_DOUBLEU64L,
+    [BC_SET32_RES_DOUBLEU64H]= &&L_BC_SET32_RES_DOUBLEU64H,
+    [BC_SET32_RES_LDOUBLEU80L]= &&L_BC_SET32_RES_LDOUBLEU80L,
+    [BC_SET32_RES_LDOUBLEU80M]= &&L_BC_SET32_RES_LDOUBLEU80M,
+    [BC_SET32_SRES_LDOUBLE]= &&L_BC_SET32_SRES_LDOUBLE,
+    [BC_SET32_RES_SELECTOR]= &&L_BC_SET32_RES_SELECTOR,
+    [BC_SET32_RES_DR7]= &&L_BC_SET32_RES_DR7,
+    [BC_SET32_RES_CR0]= &&L_BC_SET32_RES_CR0,
+    [BC_SET32_RES_CR2]= &&L_BC_SET32_RES_CR2,
+    [BC_SET32_RES_CR3]= &&L_BC_SET32_RES_CR3,
+    [BC_SET32_RES_EAX]= &&L_BC_SET32_RES_EAX,
+    [BC_SET32_RES_ECX]= &&L_BC_SET32_RES_ECX,
+    [BC_SET32_RES_EDX]= &&L_BC_SET32_RES_EDX,
+    [BC_SET32_RES_EBX]= &&L_BC_SET32_RES_EBX,
+    [BC_SET32_RES_ESP]= &&L_BC_SET32_RES_ESP,
+    [BC_SET32_RES_EBP]= &&L_BC_SET32_RES_EBP,
+    [BC_SET32_RES_ESI]= &&L_BC_SET32_RES_ESI,
+    [BC_SET32_RES_EDI]= &&L_BC_SET32_RES_EDI,
+    [BC_SET32_RES_ES]= &&L_BC_SET32_RES_ES,
+    [BC_SET32_RES_SS]= &&L_BC_SET32_RES_SS,
+    [BC_SET32_RES_DS]= &&L_BC_SET32_RES_DS,
+    [BC_SET32_RES_FS]= &&L_BC_SET32_RES_FS,
+    [BC_SET32_RES_GS]= &&L_BC_SET32_RES_GS,
+    [BC_SET32_RES8_RES]= &&L_BC_SET32_RES8_RES,
+    [BC_SET32_RES8_RES_SIGNED]= &&L_BC_SET32_RES8_RES_SIGNED,
+    [BC_SET32_RES16_RES]= &&L_BC_SET32_RES16_RES,
+    [BC_SET32_RES16_RES_SIGNED]= &&L_BC_SET32_RES16_RES_SIGNED,
+    [BC_SET32_RES64_RES]= &&L_BC_SET32_RES64_RES,
+    [BC_SET32_RES64_EAX_EDX]= &&L_BC_SET32_RES64_EAX_EDX,
+    [BC_SET16_RES_LDOUBLEU80H]= &&L_BC_SET16_RES_LDOUBLEU80H,
+    [BC_SET16_RES_SELECTOR]= &&L_BC_SET16_RES_SELECTOR,
+    [BC_SET16_RES_CR0]= &&L_BC_SET16_RES_CR0,
+    [BC_SET16_RES_AX]= &&L_BC_SET16_RES_AX,
+    [BC_SET16_RES_CX]= &&L_BC_SET16_RES_CX,
+    [BC_SET16_RES_DX]= &&L_BC_SET16_RES_DX,
+    [BC_SET16_RES_BX]= &&L_BC_SET16_RES_BX,
+    [BC_SET16_RES_SP]= &&L_BC_SET16_RES_SP,
+    [BC_SET16_RES_BP]= &&L_BC_SET16_RES_BP,
+    [BC_SET16_RES_SI]= &&L_BC_SET16_RES_SI,
+    [BC_SET16_RES_DI]= &&L_BC_SET16_RES_DI,
+    [BC_SET16_RES_ES]= &&L_BC_SET16_RES_ES,
+    [BC_SET16_RES_SS]= &&L_BC_SET16_RES_SS,
+    [BC_SET16_RES_DS]= &&L_BC_SET16_RES_DS,
+    [BC_SET16_RES_FS]= &&L_BC_SET16_RES_FS,
+    [BC_SET16_RES_GS]= &&L_BC_SET16_RES_GS,
+    [BC_SET16_RES8_RES]= &&L_BC_SET16_RES8_RES,
+    [BC_SET16_RES8_RES_SIGNED]= &&L_BC_SET16_RES8_RES_SIGNED,
+    [BC_SET16_RES32_RES]= &&L_BC_SET16_RES32_RES,
+    [BC_SET16_RES32_AX_DX]= &&L_BC_SET16_RES32_AX_DX,
+    [BC_SET8_RES_AL]= &&L_BC_SET8_RES_AL,
+    [BC_SET8_RES_CL]= &&L_BC_SET8_RES_CL,
+    [BC_SET8_RES_DL]= &&L_BC_SET8_RES_DL,
+    [BC_SET8_RES_BL]= &&L_BC_SET8_RES_BL,
+    [BC_SET8_RES_AH]= &&L_BC_SET8_RES_AH,
+    [BC_SET8_RES_CH]= &&L_BC_SET8_RES_CH,
+    [BC_SET8_RES_DH]= &&L_BC_SET8_RES_DH,
+    [BC_SET8_RES_BH]= &&L_BC_SET8_RES_BH,
+    [BC_SET32_OFFSET_EAX]= &&L_BC_SET32_OFFSET_EAX,
+    [BC_SET32_OFFSET_ECX]= &&L_BC_SET32_OFFSET_ECX,
+    [BC_SET32_OFFSET_EDX]= &&L_BC_SET32_OFFSET_EDX,
+    [BC_SET32_OFFSET_EBX]= &&L_BC_SET32_OFFSET_EBX,
+    [BC_SET32_OFFSET_ESP]= &&L_BC_SET32_OFFSET_ESP,
+    [BC_SET32_OFFSET_EBP]= &&L_BC_SET32_OFFSET_EBP,
+    [BC_SET32_OFFSET_ESI]= &&L_BC_SET32_OFFSET_ESI,
+    [BC_SET32_OFFSET_EDI]= &&L_BC_SET32_OFFSET_EDI,
+    [BC_SET32_OFFSET_RES]= &&L_BC_SET32_OFFSET_RES,
+    [BC_SET16_OFFSET_AX]= &&L_BC_SET16_OFFSET_AX,
+    [BC_SET16_OFFSET_CX]= &&L_BC_SET16_OFFSET_CX,
+    [BC_SET16_OFFSET_DX]= &&L_BC_SET16_OFFSET_DX,
+    [BC_SET16_OFFSET_BX]= &&L_BC_SET16_OFFSET_BX,
+    [BC_SET16_OFFSET_SP]= &&L_BC_SET16_OFFSET_SP,
+    [BC_SET16_OFFSET_BP]= &&L_BC_SET16_OFFSET_BP,
+    [BC_SET16_OFFSET_SI]= &&L_BC_SET16_OFFSET_SI,
+    [BC_SET16_OFFSET_DI]= &&L_BC_SET16_OFFSET_DI,
+    [BC_SET16_OFFSET_RES]= &&L_BC_SET16_OFFSET_RES,
+    [BC_SET16_SELECTOR_RES]= &&L_BC_SET16_SELECTOR_RES,
+    [BC_DS_READ32_RES]= &&L_BC_DS_READ32_RES,
+    [BC_DS_READ32_OP0]= &&L_BC_DS_READ32_OP0,
+    [BC_DS_READ32_OP1]= &&L_BC_DS_READ32_OP1,
+    [BC_SS_READ32_RES]= &&L_BC_SS_READ32_RES,
+    [BC_SS_READ32_OP0]= &&L_BC_SS_READ32_OP0,
+    [BC_SS_READ32_OP1]= &&L_BC_SS_READ32_OP1,
+    [BC_ES_READ32_RES]= &&L_BC_ES_READ32_RES,
+    [BC_ES_READ32_OP0]= &&L_BC_ES_READ32_OP0,
+    [BC_ES_READ32_OP1]= &&L_BC_ES_READ32_OP1,
+    [BC_CS_READ32_RES]= &&L_BC_CS_READ32_RES,
+    [BC_CS_READ32_OP0]= &&L_BC_CS_READ32_OP0,
+    [BC_CS_READ32_OP1]= &&L_BC_CS_READ32_OP1,
+    [BC_FS_READ32_RES]= &&L_BC_FS_READ32_RES,
+    [BC_FS_READ32_OP0]= &&L_BC_FS_READ32_OP0,
+    [BC_FS_READ32_OP1]= &&L_BC_FS_READ32_OP1,
+    [BC_GS_READ32_RES]= &&L_BC_GS_READ32_RES,
+    [BC_GS_READ32_OP0]= &&L_BC_GS_READ32_OP0,
+    [BC_GS_READ32_OP1]= &&L_BC_GS_READ32_OP1,
+    [BC_DS_READ16_RES]= &&L_BC_DS_READ16_RES,
+    [BC_DS_READ16_OP0]= &&L_BC_DS_READ16_OP0,
+    [BC_DS_READ16_OP1]= &&L_BC_DS_READ16_OP1,
+    [BC_SS_READ16_RES]= &&L_BC_SS_READ16_RES,
+    [BC_SS_READ16_OP0]= &&L_BC_SS_READ16_OP0,
+    [BC_SS_READ16_OP1]= &&L_BC_SS_READ16_OP1,
+    [BC_ES_READ16_RES]= &&L_BC_ES_READ16_RES,
+    [BC_ES_READ16_OP0]= &&L_BC_ES_READ16_OP0,
+    [BC_ES_READ16_OP1]= &&L_BC_ES_READ16_OP1,
+    [BC_CS_READ16_RES]= &&L_BC_CS_READ16_RES,
+    [BC_CS_READ16_OP0]= &&L_BC_CS_READ16_OP0,
+    [BC_CS_READ16_OP1]= &&L_BC_CS_READ16_OP1,
+    [BC_FS_READ16_RES]= &&L_BC_FS_READ16_RES,
+    [BC_FS_READ16_OP0]= &&L_BC_FS_READ16_OP0,
+    [BC_FS_READ16_OP1]= &&L_BC_FS_READ16_OP1,
+    [BC_GS_READ16_RES]= &&L_BC_GS_READ16_RES,
+    [BC_GS_READ16_OP0]= &&L_BC_GS_READ16_OP0,
+    [BC_GS_READ16_OP1]= &&L_BC_GS_READ16_OP1,
+    [BC_DS_READ8_RES]= &&L_BC_DS_READ8_RES,
+    [BC_DS_READ8_OP0]= &&L_BC_DS_READ8_OP0,
+    [BC_DS_READ8_OP1]= &&L_BC_DS_READ8_OP1,
+    [BC_SS_READ8_RES]= &&L_BC_SS_READ8_RES,
+    [BC_SS_READ8_OP0]= &&L_BC_SS_READ8_OP0,
+    [BC_SS_READ8_OP1]= &&L_BC_SS_READ8_OP1,
+    [BC_ES_READ8_RES]= &&L_BC_ES_READ8_RES,
+    [BC_ES_READ8_OP0]= &&L_BC_ES_READ8_OP0,
+    [BC_ES_READ8_OP1]= &&L_BC_ES_READ8_OP1,
+    [BC_CS_READ8_RES]= &&L_BC_CS_READ8_RES,
+    [BC_CS_READ8_OP0]= &&L_BC_CS_READ8_OP0,
+    [BC_CS_READ8_OP1]= &&L_BC_CS_READ8_OP1,
+    [BC_FS_READ8_RES]= &&L_BC_FS_READ8_RES,
+    [BC_FS_READ8_OP0]= &&L_BC_FS_READ8_OP0,
+    [BC_FS_READ8_OP1]= &&L_BC_FS_READ8_OP1,
+    [BC_GS_READ8_RES]= &&L_BC_GS_READ8_RES,
+    [BC_GS_READ8_OP0]= &&L_BC_GS_READ8_OP0,
+    [BC_GS_READ8_OP1]= &&L_BC_GS_READ8_OP1,
+    [BC_DS_READ_SELECTOR_OFFSET]= &&L_BC_DS_READ_SELECTOR_OFFSET,
+    [BC_SS_READ_SELECTOR_OFFSET]= &&L_BC_SS_READ_SELECTOR_OFFSET,
+    [BC_ES_READ_SELECTOR_OFFSET]= &&L_BC_ES_READ_SELECTOR_OFFSET,
+    [BC_CS_READ_SELECTOR_OFFSET]= &&L_BC_CS_READ_SELECTOR_OFFSET,
+    [BC_GS_READ_SELECTOR_OFFSET]= &&L_BC_GS_READ_SELECTOR_OFFSET,
+    [BC_DS_READ_OFFSET_SELECTOR]= &&L_BC_DS_READ_OFFSET_SELECTOR,
+    [BC_DS_READ_OFFSET16_SELECTOR]= &&L_BC_DS_READ_OFFSET16_SELECTOR,
+    [BC_SS_READ_OFFSET_SELECTOR]= &&L_BC_SS_READ_OFFSET_SELECTOR,
+    [BC_SS_READ_OFFSET16_SELECTOR]= &&L_BC_SS_READ_OFFSET16_SELECTOR,
+    [BC_ES_READ_OFFSET_SELECTOR]= &&L_BC_ES_READ_OFFSET_SELECTOR,
+    [BC_ES_READ_OFFSET16_SELECTOR]= &&L_BC_ES_READ_OFFSET16_SELECTOR,
+    [BC_CS_READ_OFFSET_SELECTOR]= &&L_BC_CS_READ_OFFSET_SELECTOR,
+    [BC_CS_READ_OFFSET16_SELECTOR]= &&L_BC_CS_READ_OFFSET16_SELECTOR,
+    [BC_FS_READ_OFFSET_SELECTOR]= &&L_BC_FS_READ_OFFSET_SELECTOR,
+    [BC_FS_READ_OFFSET16_SELECTOR]= &&L_BC_FS_READ_OFFSET16_SELECTOR,
+    [BC_GS_READ_OFFSET_SELECTOR]= &&L_BC_GS_READ_OFFSET_SELECTOR,
+    [BC_GS_READ_OFFSET16_SELECTOR]= &&L_BC_GS_READ_OFFSET16_SELECTOR,
+    [BC_DS_RES_WRITE32]= &&L_BC_DS_RES_WRITE32,
+    [BC_SS_RES_WRITE32]= &&L_BC_SS_RES_WRITE32,
+    [BC_ES_RES_WRITE32]= &&L_BC_ES_RES_WRITE32,
+    [BC_CS_RES_WRITE32]= &&L_BC_CS_RES_WRITE32,
+    [BC_FS_RES_WRITE32]= &&L_BC_FS_RES_WRITE32,
+    [BC_GS_RES_WRITE32]= &&L_BC_GS_RES_WRITE32,
+    [BC_DS_RES_WRITE16]= &&L_BC_DS_RES_WRITE16,
+    [BC_SS_RES_WRITE16]= &&L_BC_SS_RES_WRITE16,
+    [BC_ES_RES_WRITE16]= &&L_BC_ES_RES_WRITE16,
+    [BC_CS_RES_WRITE16]= &&L_BC_CS_RES_WRITE16,
+    [BC_FS_RES_WRITE16]= &&L_BC_FS_RES_WRITE16,
+    [BC_GS_RES_WRITE16]= &&L_BC_GS_RES_WRITE16,
+    [BC_DS_RES_WRITE8]= &&L_BC_DS_RES_WRITE8,
+    [BC_SS_RES_WRITE8]= &&L_BC_SS_RES_WRITE8,
+    [BC_ES_RES_WRITE8]= &&L_BC_ES_RES_WRITE8,
+    [BC_CS_RES_WRITE8]= &&L_BC_CS_RES_WRITE8,
+    [BC_FS_RES_WRITE8]= &&L_BC_FS_RES_WRITE8,
+    [BC_GS_RES_WRITE8]= &&L_BC_GS_RES_WRITE8,
+    [BC_PORT_READ32]= &&L_BC_PORT_READ32,
+    [BC_PORT_READ16]= &&L_BC_PORT_READ16,
+    [BC_PORT_READ8]= &&L_BC_PORT_READ8,
+    [BC_PORT_WRITE32]= &&L_BC_PORT_WRITE32,
+    [BC_PORT_WRITE16]= &&L_BC_PORT_WRITE16,
+    [BC_PORT_WRITE8]= &&L_BC_PORT_WRITE8,
+    [BC_JMP32_FAR]= &&L_BC_JMP32_FAR,
+    [BC_JMP16_FAR]= &&L_BC_JMP16_FAR,
+    [BC_JMP32_NEAR_REL]= &&L_BC_JMP32_NEAR_REL,
+    [BC_JMP16_NEAR_REL]= &&L_BC_JMP16_NEAR_REL,
+    [BC_JMP32_NEAR_REL32]= &&L_BC_JMP32_NEAR_REL32,
+    [BC_JMP32_NEAR_RES32]= &&L_BC_JMP32_NEAR_RES32,
+    [BC_JMP16_NEAR_RES16]= &&L_BC_JMP16_NEAR_RES16,
+    [BC_CALL32_FAR]= &&L_BC_CALL32_FAR,
+    [BC_CALL16_FAR]= &&L_BC_CALL16_FAR,
+    [BC_CALL32_NEAR_REL]= &&L_BC_CALL32_NEAR_REL,
+    [BC_CALL16_NEAR_REL]= &&L_BC_CALL16_NEAR_REL,
+    [BC_CALL32_NEAR_REL32]= &&L_BC_CALL32_NEAR_REL32,
+    [BC_CALL32_NEAR_RES32]= &&L_BC_CALL32_NEAR_RES32,
+    [BC_CALL16_NEAR_RES16]= &&L_BC_CALL16_NEAR_RES16,
+    [BC_BRANCH32_A]= &&L_BC_BRANCH32_A,
+    [BC_BRANCH32_AE]= &&L_BC_BRANCH32_AE,
+    [BC_BRANCH32_B]= &&L_BC_BRANCH32_B,
+    [BC_BRANCH32_CXZ]= &&L_BC_BRANCH32_CXZ,
+    [BC_BRANCH32_E]= &&L_BC_BRANCH32_E,
+    [BC_BRANCH32_ECXZ]= &&L_BC_BRANCH32_ECXZ,
+    [BC_BRANCH32_G]= &&L_BC_BRANCH32_G,
+    [BC_BRANCH32_GE]= &&L_BC_BRANCH32_GE,
+    [BC_BRANCH32_L]= &&L_BC_BRANCH32_L,
+    [BC_BRANCH32_NA]= &&L_BC_BRANCH32_NA,
+    [BC_BRANCH32_NE]= &&L_BC_BRANCH32_NE,
+    [BC_BRANCH32_NG]= &&L_BC_BRANCH32_NG,
+    [BC_BRANCH32_NO]= &&L_BC_BRANCH32_NO,
+    [BC_BRANCH32_NS]= &&L_BC_BRANCH32_NS,
+    [BC_BRANCH32_O]= &&L_BC_BRANCH32_O,
+    [BC_BRANCH32_P]= &&L_BC_BRANCH32_P,
+    [BC_BRANCH32_PO]= &&L_BC_BRANCH32_PO,
+    [BC_BRANCH32_S]= &&L_BC_BRANCH32_S,
+    [BC_BRANCH32]= &&L_BC_BRANCH32,
+    [BC_BRANCH32_IMM32_A]= &&L_BC_BRANCH32_IMM32_A,
+    [BC_BRANCH32_IMM32_AE]= &&L_BC_BRANCH32_IMM32_AE,
+    [BC_BRANCH32_IMM32_B]= &&L_BC_BRANCH32_IMM32_B,
+    [BC_BRANCH32_IMM32_CXZ]= &&L_BC_BRANCH32_IMM32_CXZ,
+    [BC_BRANCH32_IMM32_E]= &&L_BC_BRANCH32_IMM32_E,
+    [BC_BRANCH32_IMM32_ECXZ]= &&L_BC_BRANCH32_IMM32_ECXZ,
+    [BC_BRANCH32_IMM32_G]= &&L_BC_BRANCH32_IMM32_G,
+    [BC_BRANCH32_IMM32_GE]= &&L_BC_BRANCH32_IMM32_GE,
+    [BC_BRANCH32_IMM32_L]= &&L_BC_BRANCH32_IMM32_L,
+    [BC_BRANCH32_IMM32_NA]= &&L_BC_BRANCH32_IMM32_NA,
+    [BC_BRANCH32_IMM32_NE]= &&L_BC_BRANCH32_IMM32_NE,
+    [BC_BRANCH32_IMM32_NG]= &&L_BC_BRANCH32_IMM32_NG,
+    [BC_BRANCH32_IMM32_NO]= &&L_BC_BRANCH32_IMM32_NO,
+    [BC_BRANCH32_IMM32_NS]= &&L_BC_BRANCH32_IMM32_NS,
+    [BC_BRANCH32_IMM32_O]= &&L_BC_BRANCH32_IMM32_O,
+    [BC_BRANCH32_IMM32_P]= &&L_BC_BRANCH32_IMM32_P,
+    [BC_BRANCH32_IMM32_PO]= &&L_BC_BRANCH32_IMM32_PO,
+    [BC_BRANCH32_IMM32_S]= &&L_BC_BRANCH32_IMM32_S,
+    [BC_BRANCH32_IMM32]= &&L_BC_BRANCH32_IMM32,
+    [BC_BRANCH16_A]= &&L_BC_BRANCH16_A,
+    [BC_BRANCH16_AE]= &&L_BC_BRANCH16_AE,
+    [BC_BRANCH16_B]= &&L_BC_BRANCH16_B,
+    [BC_BRANCH16_CXZ]= &&L_BC_BRANCH16_CXZ,
+    [BC_BRANCH16_E]= &&L_BC_BRANCH16_E,
+    [BC_BRANCH16_ECXZ]= &&L_BC_BRANCH16_ECXZ,
+    [BC_BRANCH16_G]= &&L_BC_BRANCH16_G,
+    [BC_BRANCH16_GE]= &&L_BC_BRANCH16_GE,
+    [BC_BRANCH16_L]= &&L_BC_BRANCH16_L,
+    [BC_BRANCH16_NA]= &&L_BC_BRANCH16_NA,
+    [BC_BRANCH16_NE]= &&L_BC_BRANCH16_NE,
+    [BC_BRANCH16_NG]= &&L_BC_BRANCH16_NG,
+    [BC_BRANCH16_NO]= &&L_BC_BRANCH16_NO,
+    [BC_BRANCH16_NS]= &&L_BC_BRANCH16_NS,
+    [BC_BRANCH16_O]= &&L_BC_BRANCH16_O,
+    [BC_BRANCH16_P]= &&L_BC_BRANCH16_P,
+    [BC_BRANCH16_PO]= &&L_BC_BRANCH16_PO,
+    [BC_BRANCH16_S]= &&L_BC_BRANCH16_S,
+    [BC_BRANCH16]= &&L_BC_BRANCH16,
+    [BC_IRET32]= &&L_BC_IRET32,
+    [BC_IRET16]= &&L_BC_IRET16,
+    [BC_ADC32]= &&L_BC_ADC32,
+    [BC_ADC16]= &&L_BC_ADC16,
+    [BC_ADC8]= &&L_BC_ADC8,
+    [BC_ADD32]= &&L_BC_ADD32,
+    [BC_ADD16]= &&L_BC_ADD16,
+    [BC_ADD8]= &&L_BC_ADD8,
+    [BC_DIV32_EDX_EAX]= &&L_BC_DIV32_EDX_EAX,
+    [BC_DIV16_DX_AX]= &&L_BC_DIV16_DX_AX,
+    [BC_DIV8_AH_AL]= &&L_BC_DIV8_AH_AL,
+    [BC_IDIV32_EDX_EAX]= &&L_BC_IDIV32_EDX_EAX,
+    [BC_IDIV16_DX_AX]= &&L_BC_IDIV16_DX_AX,
+    [BC_IDIV8_AH_AL]= &&L_BC_IDIV8_AH_AL,
+    [BC_IMUL32]= &&L_BC_IMUL32,
+    [BC_IMUL16]= &&L_BC_IMUL16,
+    [BC_IMUL8]= &&L_BC_IMUL8,
+    [BC_MUL32]= &&L_BC_MUL32,
+    [BC_MUL16]= &&L_BC_MUL16,
+    [BC_MUL8]= &&L_BC_MUL8,
+    [BC_SBB32]= &&L_BC_SBB32,
+    [BC_SBB16]= &&L_BC_SBB16,
+    [BC_SBB8]= &&L_BC_SBB8,
+    [BC_SGDT32]= &&L_BC_SGDT32,
+    [BC_SIDT32]= &&L_BC_SIDT32,
+    [BC_SIDT16]= &&L_BC_SIDT16,
+    [BC_SUB32]= &&L_BC_SUB32,
+    [BC_SUB16]= &&L_BC_SUB16,
+    [BC_SUB8]= &&L_BC_SUB8,
+    [BC_AND32]= &&L_BC_AND32,
+    [BC_AND16]= &&L_BC_AND16,
+    [BC_AND8]= &&L_BC_AND8,
+    [BC_NOT32]= &&L_BC_NOT32,
+    [BC_NOT16]= &&L_BC_NOT16,
+    [BC_NOT8]= &&L_BC_NOT8,
+    [BC_OR32]= &&L_BC_OR32,
+    [BC_OR16]= &&L_BC_OR16,
+    [BC_OR8]= &&L_BC_OR8,
+    [BC_RCL32]= &&L_BC_RCL32,
+    [BC_RCL16]= &&L_BC_RCL16,
+    [BC_RCL8]= &&L_BC_RCL8,
+    [BC_RCR32]= &&L_BC_RCR32,
+    [BC_RCR16]= &&L_BC_RCR16,
+    [BC_RCR8]= &&L_BC_RCR8,
+    [BC_ROL32]= &&L_BC_ROL32,
+    [BC_ROL16]= &&L_BC_ROL16,
+    [BC_ROL8]= &&L_BC_ROL8,
+    [BC_ROR32]= &&L_BC_ROR32,
+    [BC_ROR16]= &&L_BC_ROR16,
+    [BC_ROR8]= &&L_BC_ROR8,
+    [BC_SAR32]= &&L_BC_SAR32,
+    [BC_SAR16]= &&L_BC_SAR16,
+    [BC_SAR8]= &&L_BC_SAR8,
+    [BC_SHL32]= &&L_BC_SHL32,
+    [BC_SHL16]= &&L_BC_SHL16,
+    [BC_SHL8]= &&L_BC_SHL8,
+    [BC_SHLD32]= &&L_BC_SHLD32,
+    [BC_SHLD16]= &&L_BC_SHLD16,
+    [BC_SHR32]= &&L_BC_SHR32,
+    [BC_SHR16]= &&L_BC_SHR16,
+    [BC_SHR8]= &&L_BC_SHR8,
+    [BC_SHRD32]= &&L_BC_SHRD32,
+    [BC_SHRD16]= &&L_BC_SHRD16,
+    [BC_XOR32]= &&L_BC_XOR32,
+    [BC_XOR16]= &&L_BC_XOR16,
+    [BC_XOR8]= &&L_BC_XOR8,
+    [BC_MOV32_REG_REG]= &&L_BC_MOV32_REG_REG,
+    [BC_MOV16_REG_REG]= &&L_BC_MOV16_REG_REG,
+    [BC_SET32_IMM32_REG]= &&L_BC_SET32_IMM32_REG,
+    [BC_SET16_IMM_REG]= &&L_BC_SET16_IMM_REG,
+    [BC_DS_READ32_REG]= &&L_BC_DS_READ32_REG,
+    [BC_DS_READ16_REG]= &&L_BC_DS_READ16_REG,
+    [BC_SS_READ32_REG]= &&L_BC_SS_READ32_REG,
+    [BC_SS_READ16_REG]= &&L_BC_SS_READ16_REG,
+    [BC_ADD32_REG_IMM]= &&L_BC_ADD32_REG_IMM,
+    [BC_SUB32_REG_IMM]= &&L_BC_SUB32_REG_IMM,
+    [BC_AND32_REG_IMM]= &&L_BC_AND32_REG_IMM,
+    [BC_OR32_REG_IMM]= &&L_BC_OR32_REG_IMM,
+    [BC_XOR32_REG_IMM]= &&L_BC_XOR32_REG_IMM,
+    [BC_CMP32_REG_IMM]= &&L_BC_CMP32_REG_IMM,
+    [BC_TEST32_REG_IMM]= &&L_BC_TEST32_REG_IMM,
+    [BC_ADD32_REG_REG]= &&L_BC_ADD32_REG_REG,
+    [BC_SUB32_REG_REG]= &&L_BC_SUB32_REG_REG,
+    [BC_AND32_REG_REG]= &&L_BC_AND32_REG_REG,
+    [BC_OR32_REG_REG]= &&L_BC_OR32_REG_REG,
+    [BC_XOR32_REG_REG]= &&L_BC_XOR32_REG_REG,
+    [BC_CMP32_REG_REG]= &&L_BC_CMP32_REG_REG,
+    [BC_TEST32_REG_REG]= &&L_BC_TEST32_REG_REG,
+    [BC_ADD16_REG_IMM]= &&L_BC_ADD16_REG_IMM,
+    [BC_SUB16_REG_IMM]= &&L_BC_SUB16_REG_IMM,
+    [BC_AND16_REG_IMM]= &&L_BC_AND16_REG_IMM,
+    [BC_OR16_REG_IMM]= &&L_BC_OR16_REG_IMM,
+    [BC_XOR16_REG_IMM]= &&L_BC_XOR16_REG_IMM,
+    [BC_CMP16_REG_IMM]= &&L_BC_CMP16_REG_IMM,
+    [BC_TEST16_REG_IMM]= &&L_BC_TEST16_REG_IMM,
+    [BC_ADD16_REG_REG]= &&L_BC_ADD16_REG_REG,
+    [BC_SUB16_REG_REG]= &&L_BC_SUB16_REG_REG,
+    [BC_AND16_REG_REG]= &&L_BC_AND16_REG_REG,
+    [BC_OR16_REG_REG]= &&L_BC_OR16_REG_REG,
+    [BC_XOR16_REG_REG]= &&L_BC_XOR16_REG_REG,
+    [BC_CMP16_REG_REG]= &&L_BC_CMP16_REG_REG,
+    [BC_TEST16_REG_REG]= &&L_BC_TEST16_REG_REG,
+    [BC_DS_READ32_SIB_RES]= &&L_BC_DS_READ32_SIB_RES,
+    [BC_DS_READ32_SIB_OP0]= &&L_BC_DS_READ32_SIB_OP0,
+    [BC_DS_READ32_SIB_OP1]= &&L_BC_DS_READ32_SIB_OP1,
+    [BC_SS_READ32_SIB_RES]= &&L_BC_SS_READ32_SIB_RES,
+    [BC_SS_READ32_SIB_OP0]= &&L_BC_SS_READ32_SIB_OP0,
+    [BC_SS_READ32_SIB_OP1]= &&L_BC_SS_READ32_SIB_OP1,
+    [BC_DS_READ32_SIB_REG]= &&L_BC_DS_READ32_SIB_REG,
+    [BC_SS_READ32_SIB_REG]= &&L_BC_SS_READ32_SIB_REG,
+    [BC_AAD]= &&L_BC_AAD,
+    [BC_AAM]= &&L_BC_AAM,
+    [BC_BSF32]= &&L_BC_BSF32,
+    [BC_BSF16]= &&L_BC_BSF16,
+    [BC_BSR32]= &&L_BC_BSR32,
+    [BC_BSR16]= &&L_BC_BSR16,
+    [BC_BSWAP]= &&L_BC_BSWAP,
+    [BC_BT32]= &&L_BC_BT32,
+    [BC_BT16]= &&L_BC_BT16,
+    [BC_BTC32]= &&L_BC_BTC32,
+    [BC_BTR32]= &&L_BC_BTR32,
+    [BC_BTR16]= &&L_BC_BTR16,
+    [BC_BTS32]= &&L_BC_BTS32,
+    [BC_BTS16]= &&L_BC_BTS16,
+    [BC_CDQ]= &&L_BC_CDQ,
+    [BC_CLI]= &&L_BC_CLI,
+    [BC_CMC]= &&L_BC_CMC,
+    [BC_CPUID]= &&L_BC_CPUID,
+    [BC_CWD]= &&L_BC_CWD,
+    [BC_CWDE]= &&L_BC_CWDE,
+    [BC_DAA]= &&L_BC_DAA,
+    [BC_DAS]= &&L_BC_DAS,
+    [BC_ENTER16]= &&L_BC_ENTER16,
+    [BC_ENTER32]= &&L_BC_ENTER32,
+    [BC_HALT]= &&L_BC_HALT,
+    [BC_INT32]= &&L_BC_INT32,
+    [BC_INT16]= &&L_BC_INT16,
+    [BC_INTO32]= &&L_BC_INTO32,
+    [BC_INTO16]= &&L_BC_INTO16,
+    [BC_INVLPG32]= &&L_BC_INVLPG32,
+    [BC_INVLPG16]= &&L_BC_INVLPG16,
+    [BC_LAHF]= &&L_BC_LAHF,
+    [BC_LAR32]= &&L_BC_LAR32,
+    [BC_LAR16]= &&L_BC_LAR16,
+    [BC_LEAVE32]= &&L_BC_LEAVE32,
+    [BC_LEAVE16]= &&L_BC_LEAVE16,
+    [BC_LGDT32]= &&L_BC_LGDT32,
+    [BC_LGDT16]= &&L_BC_LGDT16,
+    [BC_LIDT32]= &&L_BC_LIDT32,
+    [BC_LIDT16]= &&L_BC_LIDT16,
+    [BC_LLDT]= &&L_BC_LLDT,
+    [BC_LSL32]= &&L_BC_LSL32,
+    [BC_LSL16]= &&L_BC_LSL16,
+    [BC_LTR]= &&L_BC_LTR,
+    [BC_POP32]= &&L_BC_POP32,
+    [BC_POP16]= &&L_BC_POP16,
+    [BC_POP32_EFLAGS]= &&L_BC_POP32_EFLAGS,
+    [BC_POP16_EFLAGS]= &&L_BC_POP16_EFLAGS,
+    [BC_PUSH32]= &&L_BC_PUSH32,
+    [BC_PUSH16]= &&L_BC_PUSH16,
+    [BC_PUSH32_EFLAGS]= &&L_BC_PUSH32_EFLAGS,
+    [BC_PUSH16_EFLAGS]= &&L_BC_PUSH16_EFLAGS,
+    [BC_PUSHA32_CHECK_EXCEPTION]= &&L_BC_PUSHA32_CHECK_EXCEPTION,
+    [BC_PUSHA16_CHECK_EXCEPTION]= &&L_BC_PUSHA16_CHECK_EXCEPTION,
+    [BC_RET32_FAR]= &&L_BC_RET32_FAR,
+    [BC_RET32_FAR_NOSTOP]= &&L_BC_RET32_FAR_NOSTOP,
+    [BC_RET16_FAR]= &&L_BC_RET16_FAR,
+    [BC_RET16_FAR_NOSTOP]= &&L_BC_RET16_FAR_NOSTOP,
+    [BC_RET32_RES]= &&L_BC_RET32_RES,
+    [BC_RET32_RES_INC_ESP]= &&L_BC_RET32_RES_INC_ESP,
+    [BC_RET32_RES_INC_SP]= &&L_BC_RET32_RES_INC_SP,
+    [BC_RET16_RES]= &&L_BC_RET16_RES,
+    [BC_RET16_RES_INC_ESP]= &&L_BC_RET16_RES_INC_ESP,
+    [BC_RET16_RES_INC_SP]= &&L_BC_RET16_RES_INC_SP,
+    [BC_INC_ESP_AND_GOTO_EIP]= &&L_BC_INC_ESP_AND_GOTO_EIP,
+    [BC_INC_SP_AND_GOTO_EIP]= &&L_BC_INC_SP_AND_GOTO_EIP,
+    [BC_SAHF]= &&L_BC_SAHF,
+    [BC_STI]= &&L_BC_STI,
+    [BC_VERR]= &&L_BC_VERR,
+    [BC_VERW]= &&L_BC_VERW,
+    [BC_WBINVD]= &&L_BC_WBINVD,
+    [BC_CMPS32_ADDR32]= &&L_BC_CMPS32_ADDR32,
+    [BC_CMPS8_ADDR32]= &&L_BC_CMPS8_ADDR32,
+    [BC_CMPS32_ADDR16]= &&L_BC_CMPS32_ADDR16,
+    [BC_CMPS16_ADDR16]= &&L_BC_CMPS16_ADDR16,
+    [BC_CMPS8_ADDR16]= &&L_BC_CMPS8_ADDR16,
+    [BC_INS16_ADDR32]= &&L_BC_INS16_ADDR32,
+    [BC_INS8_ADDR32]= &&L_BC_INS8_ADDR32,
+    [BC_INS32_ADDR16]= &&L_BC_INS32_ADDR16,
+    [BC_INS16_ADDR16]= &&L_BC_INS16_ADDR16,
+    [BC_INS8_ADDR16]= &&L_BC_INS8_ADDR16,
+    [BC_LODS32_ADDR32]= &&L_BC_LODS32_ADDR32,
+    [BC_LODS16_ADDR32]= &&L_BC_LODS16_ADDR32,
+    [BC_LODS32_ADDR16]= &&L_BC_LODS32_ADDR16,
+    [BC_LODS16_ADDR16]= &&L_BC_LODS16_ADDR16,
+    [BC_LODS8_ADDR32]= &&L_BC_LODS8_ADDR32,
+    [BC_LODS8_ADDR16]= &&L_BC_LODS8_ADDR16,
+    [BC_MOVS32_ADDR32]= &&L_BC_MOVS32_ADDR32,
+    [BC_MOVS16_ADDR32]= &&L_BC_MOVS16_ADDR32,
+    [BC_MOVS8_ADDR32]= &&L_BC_MOVS8_ADDR32,
+    [BC_MOVS32_ADDR16]= &&L_BC_MOVS32_ADDR16,
+    [BC_MOVS16_ADDR16]= &&L_BC_MOVS16_ADDR16,
+    [BC_MOVS8_ADDR16]= &&L_BC_MOVS8_ADDR16,
+    [BC_OUTS16_ADDR32]= &&L_BC_OUTS16_ADDR32,
+    [BC_OUTS8_ADDR32]= &&L_BC_OUTS8_ADDR32,
+    [BC_OUTS16_ADDR16]= &&L_BC_OUTS16_ADDR16,
+    [BC_OUTS8_ADDR16]= &&L_BC_OUTS8_ADDR16,
+    [BC_SCAS32_ADDR32]= &&L_BC_SCAS32_ADDR32,
+    [BC_SCAS16_ADDR32]= &&L_BC_SCAS16_ADDR32,
+    [BC_SCAS8_ADDR32]= &&L_BC_SCAS8_ADDR32,
+    [BC_SCAS32_ADDR16]= &&L_BC_SCAS32_ADDR16,
+    [BC_SCAS16_ADDR16]= &&L_BC_SCAS16_ADDR16,
+    [BC_SCAS8_ADDR16]= &&L_BC_SCAS8_ADDR16,
+    [BC_STOS32_ADDR32]= &&L_BC_STOS32_ADDR32,
+    [BC_STOS32_ADDR16]= &&L_BC_STOS32_ADDR16,
+    [BC_STOS16_ADDR32]= &&L_BC_STOS16_ADDR32,
+    [BC_STOS16_ADDR16]= &&L_BC_STOS16_ADDR16,
+    [BC_STOS8_ADDR32]= &&L_BC_STOS8_ADDR32,
+    [BC_STOS8_ADDR16]= &&L_BC_STOS8_ADDR16,
+    [BC_FPU_DS_FLOATU32_WRITE32]= &&L_BC_FPU_DS_FLOATU32_WRITE32,
+    [BC_FPU_SS_FLOATU32_WRITE32]= &&L_BC_FPU_SS_FLOATU32_WRITE32,
+    [BC_FPU_ES_FLOATU32_WRITE32]= &&L_BC_FPU_ES_FLOATU32_WRITE32,
+    [BC_FPU_DS_DOUBLEU64_WRITE]= &&L_BC_FPU_DS_DOUBLEU64_WRITE,
+    [BC_FPU_SS_DOUBLEU64_WRITE]= &&L_BC_FPU_SS_DOUBLEU64_WRITE,
+    [BC_FPU_DS_LDOUBLEU80_WRITE]= &&L_BC_FPU_DS_LDOUBLEU80_WRITE,
+    [BC_FPU_SS_LDOUBLEU80_WRITE]= &&L_BC_FPU_SS_LDOUBLEU80_WRITE,
+    [BC_FPU_2XM1]= &&L_BC_FPU_2XM1,
+    [BC_FPU_ABS]= &&L_BC_FPU_ABS,
+    [BC_FPU_ADD]= &&L_BC_FPU_ADD,
+    [BC_FPU_BEGIN_OP]= &&L_BC_FPU_BEGIN_OP,
+    [BC_FPU_BEGIN_OP_CLEAR_C1]= &&L_BC_FPU_BEGIN_OP_CLEAR_C1,
+    [BC_FPU_BEGIN_OP_NOCHECK]= &&L_BC_FPU_BEGIN_OP_NOCHECK,
+    [BC_FPU_BSTP_SS]= &&L_BC_FPU_BSTP_SS,
+    [BC_FPU_CHS]= &&L_BC_FPU_CHS,
+    [BC_FPU_CLEAR_EXCP]= &&L_BC_FPU_CLEAR_EXCP,
+    [BC_FPU_COM]= &&L_BC_FPU_COM,
+    [BC_FPU_COS]= &&L_BC_FPU_COS,
+    [BC_FPU_DIV]= &&L_BC_FPU_DIV,
+    [BC_FPU_DIVR]= &&L_BC_FPU_DIVR,
+    [BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK]= &&L_BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK,
+    [BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_DENORMAL_SNAN]= &&L_BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_DENORMAL_SNAN,
+    [BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_FCOM]= &&L_BC_FPU_DOUBLEU64_LDOUBLE_AND_CHECK_FCOM,
+    [BC_FPU_FLOATU32_LDOUBLE_AND_CHECK]= &&L_BC_FPU_FLOATU32_LDOUBLE_AND_CHECK,
+    [BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_DENORMAL_SNAN]= &&L_BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_DENORMAL_SNAN,
+    [BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_FCOM]= &&L_BC_FPU_FLOATU32_LDOUBLE_AND_CHECK_FCOM,
+    [BC_FPU_FREE]= &&L_BC_FPU_FREE,
+    [BC_FPU_INIT]= &&L_BC_FPU_INIT,
+    [BC_FPU_MUL]= &&L_BC_FPU_MUL,
+    [BC_FPU_PATAN]= &&L_BC_FPU_PATAN,
+    [BC_FPU_POP]= &&L_BC_FPU_POP,
+    [BC_FPU_PREM]= &&L_BC_FPU_PREM,
+    [BC_FPU_PTAN]= &&L_BC_FPU_PTAN,
+    [BC_FPU_PUSH_DOUBLEU64]= &&L_BC_FPU_PUSH_DOUBLEU64,
+    [BC_FPU_PUSH_DOUBLEU64_AS_INT64]= &&L_BC_FPU_PUSH_DOUBLEU64_AS_INT64,
+    [BC_FPU_PUSH_FLOATU32]= &&L_BC_FPU_PUSH_FLOATU32,
+    [BC_FPU_PUSH_L2E]= &&L_BC_FPU_PUSH_L2E,
+    [BC_FPU_PUSH_LDOUBLEU80]= &&L_BC_FPU_PUSH_LDOUBLEU80,
+    [BC_FPU_PUSH_LN2]= &&L_BC_FPU_PUSH_LN2,
+    [BC_FPU_PUSH_ONE]= &&L_BC_FPU_PUSH_ONE,
+    [BC_FPU_PUSH_REG2]= &&L_BC_FPU_PUSH_REG2,
+    [BC_FPU_PUSH_RES16]= &&L_BC_FPU_PUSH_RES16,
+    [BC_FPU_PUSH_RES32]= &&L_BC_FPU_PUSH_RES32,
+    [BC_FPU_PUSH_ZERO]= &&L_BC_FPU_PUSH_ZERO,
+    [BC_FPU_REG_ST]= &&L_BC_FPU_REG_ST,
+    [BC_FPU_REG_INT16]= &&L_BC_FPU_REG_INT16,
+    [BC_FPU_REG_INT32]= &&L_BC_FPU_REG_INT32,
+    [BC_FPU_REG_INT64]= &&L_BC_FPU_REG_INT64,
+    [BC_FPU_REG_FLOATU32]= &&L_BC_FPU_REG_FLOATU32,
+    [BC_FPU_REG_DOUBLEU64]= &&L_BC_FPU_REG_DOUBLEU64,
+    [BC_FPU_REG_LDOUBLEU80]= &&L_BC_FPU_REG_LDOUBLEU80,
+    [BC_FPU_REG2_LDOUBLE_AND_CHECK]= &&L_BC_FPU_REG2_LDOUBLE_AND_CHECK,
+    [BC_FPU_REG2_LDOUBLE_AND_CHECK_FCOM]= &&L_BC_FPU_REG2_LDOUBLE_AND_CHECK_FCOM,
+    [BC_FPU_RES16_CONTROL_WORD]= &&L_BC_FPU_RES16_CONTROL_WORD,
+    [BC_FPU_RNDINT]= &&L_BC_FPU_RNDINT,
+    [BC_FPU_RSTOR32_DS]= &&L_BC_FPU_RSTOR32_DS,
+    [BC_FPU_SAVE32_DS]= &&L_BC_FPU_SAVE32_DS,
+    [BC_FPU_SCALE]= &&L_BC_FPU_SCALE,
+    [BC_FPU_SELECT_ST0]= &&L_BC_FPU_SELECT_ST0,
+    [BC_FPU_SELECT_ST1]= &&L_BC_FPU_SELECT_ST1,
+    [BC_FPU_SELECT_ST_REG]= &&L_BC_FPU_SELECT_ST_REG,
+    [BC_FPU_SELECT_ST_REG2]= &&L_BC_FPU_SELECT_ST_REG2,
+    [BC_FPU_SIN]= &&L_BC_FPU_SIN,
+    [BC_FPU_SQRT]= &&L_BC_FPU_SQRT,
+    [BC_FPU_SUB]= &&L_BC_FPU_SUB,
+    [BC_FPU_SUBR]= &&L_BC_FPU_SUBR,
+    [BC_FPU_TST]= &&L_BC_FPU_TST,
+    [BC_FPU_WAIT]= &&L_BC_FPU_WAIT,
+    [BC_FPU_XAM]= &&L_BC_FPU_XAM,
+    [BC_FPU_XCH]= &&L_BC_FPU_XCH,
+    [BC_FPU_YL2X]= &&L_BC_FPU_YL2X,
+  };
@@ -0,0 +1,535 @@
+/*
+ * Copyright 2023-2025 Adrià Giménez Pastor.
+ *
+ * This file is part of adriagipas/IA32.
+ *
+ * adriagipas/IA32 is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * adriagipas/IA32 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with adriagipas/IA32.  If not, see <https://www.gnu.org/licenses/>.
+ */
+/*
+ *  jit_native.h - Conté la part de 'jit.c' que tradueix seqüències
+ *                 d'instruccions a codi màquina x86-64.
+ *
+ */
+/*
+ * NOTA!! De moment sols es tradueixen seqüències d'instruccions de 32
+ * bits que operen sobre registres de propòsit general (no poden
+ * generar excepcions). Cada seqüència es converteix en una funció
+ * 'void f(IA32_CPU *)' on els registres del guest viuen en els
+ * registres r8-r15 del host. La resta d'instruccions es continuen
+ * executant amb el bytecode, que sempre es genera igualment.
+ *
+ * El buffer natiu de cada pàgina mai és alhora escrivible i
+ * executable: es reserva RW, native_compile el torna RX en acabar i
+ * native_reserve el torna a fer RW abans d'afegir més codi.
+ */
+
+#ifdef IA32_JIT_NATIVE
+
+
+// MACROS
+
+#define NATIVE_MIN_INSTS 2
+#define NATIVE_MAX_INSTS 64
+#define NATIVE_MAX_INST_BYTES 48 // Cota superior per instrucció
+
+#define NATIVE_FLAGS_ARITH                                              \
+  (OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG|CF_FLAG)
+#define NATIVE_FLAGS_INCDEC (OF_FLAG|SF_FLAG|ZF_FLAG|AF_FLAG|PF_FLAG)
+#define NATIVE_FLAGS_LOGIC (OF_FLAG|SF_FLAG|ZF_FLAG|PF_FLAG|CF_FLAG)
+
+// Registre rdi, on es passa el punter a la CPU.
+#define NATIVE_RDI 7
+
+// Registre del host on viu el registre 'REG' del guest.
+#define NATIVE_HREG(REG) (8+(REG))
+
+#define NATIVE_EFLAGS_OFF ((uint32_t) offsetof(IA32_CPU,eflags))
+#define NATIVE_EIP_OFF ((uint32_t) offsetof(IA32_CPU,eip))
+
+
+// TIPUS
+
+typedef void (native_func_t) (IA32_CPU *cpu);
+
+
+// CONSTANTS
+
+static const uint32_t NATIVE_REG_OFF[8]=
+  {
+    (uint32_t) offsetof(IA32_CPU,eax.v),
+    (uint32_t) offsetof(IA32_CPU,ecx.v),
+    (uint32_t) offsetof(IA32_CPU,edx.v),
+    (uint32_t) offsetof(IA32_CPU,ebx.v),
+    (uint32_t) offsetof(IA32_CPU,esp.v),
+    (uint32_t) offsetof(IA32_CPU,ebp.v),
+    (uint32_t) offsetof(IA32_CPU,esi.v),
+    (uint32_t) offsetof(IA32_CPU,edi.v)
+  };
+
+
+// FUNCIONS
+
+// Torna l'índex (ordre de codificació x86) del registre o -1.
+static int
+native_reg (
+            const IA32_InstOpType type
+            )
+{
+
+  switch ( type )
+    {
+    case IA32_EAX: return 0;
+    case IA32_ECX: return 1;
+    case IA32_EDX: return 2;
+    case IA32_EBX: return 3;
+    case IA32_ESP: return 4;
+    case IA32_EBP: return 5;
+    case IA32_ESI: return 6;
+    case IA32_EDI: return 7;
+    default: return -1;
+    }
+
+} // end native_reg
+
+
+static bool
+native_op1_is_reg_or_imm (
+                          const IA32_JIT_DisEntry *e,
+                          const bool               allow_imm8
+                          )
+{
+  return
+    native_reg ( e->inst.ops[1].type ) != -1 ||
+    e->inst.ops[1].type == IA32_IMM32 ||
+    (allow_imm8 && e->inst.ops[1].type == IA32_IMM8);
+} // end native_op1_is_reg_or_imm
+
+
+// Indica si la instrucció es pot traduir a codi natiu.
+static bool
+native_supported (
+                  const IA32_JIT_DisEntry *e
+                  )
+{
+
+  if ( e->inst.prefix != IA32_PREFIX_NONE ||
+       native_reg ( e->inst.ops[0].type ) == -1 )
+    return false;
+  switch ( e->inst.name )
+    {
+    case IA32_MOV32:
+      return native_op1_is_reg_or_imm ( e, false );
+    case IA32_ADD32:
+    case IA32_SUB32:
+    case IA32_CMP32:
+    case IA32_AND32:
+    case IA32_OR32:
+    case IA32_XOR32:
+      return native_op1_is_reg_or_imm ( e, true );
+    case IA32_TEST32:
+      return native_op1_is_reg_or_imm ( e, false );
+    case IA32_INC32:
+    case IA32_DEC32:
+    case IA32_NOT32:
+    case IA32_NEG32:
+      return true;
+    default: return false;
+    }
+
+} // end native_supported
+
+
+// Reserva espai en el buffer de codi natiu de la pàgina i el deixa
+// escrivible (no executable). Torna false si no s'ha pogut reservar
+// memòria.
+static bool
+native_reserve (
+                IA32_JIT_Page  *p,
+                const uint32_t  nbytes
+                )
+{
+
+  uint32_t tmp;
+  uint8_t *mem;
+
+
+  if ( p->native_N + nbytes <= p->native_capacity )
+    return mprotect ( p->native, p->native_capacity,
+                      PROT_READ|PROT_WRITE ) == 0;
+  tmp= p->native_capacity == 0 ? 4096 : p->native_capacity;
+  while ( tmp < p->native_N + nbytes ) tmp*= 2;
+  mem= (uint8_t *) mmap ( NULL, tmp, PROT_READ|PROT_WRITE,
+                          MAP_PRIVATE|MAP_ANONYMOUS, -1, 0 );
+  if ( mem == MAP_FAILED ) return false;
+  if ( p->native != NULL )
+    {
+      memcpy ( mem, p->native, p->native_N );
+      munmap ( p->native, p->native_capacity );
+    }
+  p->native= mem;
+  p->native_capacity= tmp;
+
+  return true;
+
+} // end native_reserve
+
+
+static void
+native_free (
+             IA32_JIT_Page *p
+             )
+{
+
+  if ( p->native != NULL )
+    munmap ( p->native, p->native_capacity );
+
+} // end native_free
+
+
+static void
+native_b (
+          IA32_JIT_Page *p,
+          const uint8_t  byte
+          )
+{
+  p->native[p->native_N++]= byte;
+} // end native_b
+
+
+static void
+native_u32 (
+            IA32_JIT_Page  *p,
+            const uint32_t  val
+            )
+{
+
+  native_b ( p, (uint8_t) val );
+  native_b ( p, (uint8_t) (val>>8) );
+  native_b ( p, (uint8_t) (val>>16) );
+  native_b ( p, (uint8_t) (val>>24) );
+
+} // end native_u32
+
+
+// Prefix REX per a operacions de 32 bits.
+static void
+native_rex (
+            IA32_JIT_Page *p,
+            const int      reg,
+            const int      rm
+            )
+{
+
+  uint8_t rex;
+
+
+  rex= 0x40 | (reg>=8 ? 0x04 : 0x00) | (rm>=8 ? 0x01 : 0x00);
+  if ( rex != 0x40 ) native_b ( p, rex );
+
+} // end native_rex
+
+
+// OPC reg,[rdi+disp32]  o  OPC [rdi+disp32],reg
+static void
+native_mem (
+            IA32_JIT_Page  *p,
+            const uint8_t   opc,
+            const int       reg,
+            const uint32_t  disp
+            )
+{
+
+  native_rex ( p, reg, NATIVE_RDI );
+  native_b ( p, opc );
+  native_b ( p, 0x80 | ((reg&7)<<3) | NATIVE_RDI );
+  native_u32 ( p, disp );
+
+} // end native_mem
+
+
+// OPC dst,src (forma r/m,reg)
+static void
+native_rr (
+           IA32_JIT_Page *p,
+           const uint8_t  opc,
+           const int      dst,
+           const int      src
+           )
+{
+
+  native_rex ( p, src, dst );
+  native_b ( p, opc );
+  native_b ( p, 0xC0 | ((src&7)<<3) | (dst&7) );
+
+} // end native_rr
+
+
+// OPC /EXT dst (forma r/m), opcionalment amb imm32.
+static void
+native_r (
+          IA32_JIT_Page  *p,
+          const uint8_t   opc,
+          const int       ext,
+          const int       dst
+          )
+{
+
+  native_rex ( p, 0, dst );
+  native_b ( p, opc );
+  native_b ( p, 0xC0 | (ext<<3) | (dst&7) );
+
+} // end native_r
+
+
+static uint32_t
+native_imm (
+            const IA32_InstOp *op
+            )
+{
+  return op->type == IA32_IMM8 ?
+    (uint32_t) ((int32_t) ((int8_t) op->u8)) : op->u32;
+} // end native_imm
+
+
+// Copia els flags del host indicats en 'mask' a EFLAGS.
+static void
+native_flags (
+              IA32_JIT_Page  *p,
+              const uint32_t  mask
+              )
+{
+
+  if ( mask == 0 ) return;
+  native_b ( p, 0x9C ); // pushfq
+  native_b ( p, 0x58 ); // pop rax
+  native_b ( p, 0x25 ); // and eax,mask
+  native_u32 ( p, mask );
+  native_b ( p, 0x81 ); // and dword [rdi+eflags],~mask
+  native_b ( p, 0xA7 );
+  native_u32 ( p, NATIVE_EFLAGS_OFF );
+  native_u32 ( p, ~mask );
+  native_mem ( p, 0x09, 0, NATIVE_EFLAGS_OFF ); // or [rdi+eflags],eax
+
+} // end native_flags
+
+
+// Operació binària amb forma 'OPC r/m,reg' i '81 /EXT r/m,imm32'.
+static void
+native_binop (
+              IA32_JIT_Page           *p,
+              const IA32_JIT_DisEntry *e,
+              const uint8_t            opc,
+              const int                ext
+              )
+{
+
+  int dst,src;
+
+
+  dst= NATIVE_HREG ( native_reg ( e->inst.ops[0].type ) );
+  src= native_reg ( e->inst.ops[1].type );
+  if ( src != -1 ) native_rr ( p, opc, dst, NATIVE_HREG ( src ) );
+  else
+    {
+      native_r ( p, 0x81, ext, dst );
+      native_u32 ( p, native_imm ( &(e->inst.ops[1]) ) );
+    }
+
+} // end native_binop
+
+
+static void
+native_inst (
+             IA32_JIT_Page           *p,
+             const IA32_JIT_DisEntry *e
+             )
+{
+
+  int dst,src;
+  uint32_t mask;
+
+
+  dst= NATIVE_HREG ( native_reg ( e->inst.ops[0].type ) );
+  switch ( e->inst.name )
+    {
+    case IA32_MOV32:
+      src= native_reg ( e->inst.ops[1].type );
+      if ( src != -1 ) native_rr ( p, 0x89, dst, NATIVE_HREG ( src ) );
+      else
+        {
+          native_rex ( p, 0, dst );
+          native_b ( p, 0xB8 + (dst&7) );
+          native_u32 ( p, e->inst.ops[1].u32 );
+        }
+      mask= 0;
+      break;
+    case IA32_ADD32:
+      native_binop ( p, e, 0x01, 0 );
+      mask= e->flags&NATIVE_FLAGS_ARITH;
+      break;
+    case IA32_OR32:
+      native_binop ( p, e, 0x09, 1 );
+      mask= e->flags&NATIVE_FLAGS_LOGIC;
+      break;
+    case IA32_AND32:
+      native_binop ( p, e, 0x21, 4 );
+      mask= e->flags&NATIVE_FLAGS_LOGIC;
+      break;
+    case IA32_SUB32:
+      native_binop ( p, e, 0x29, 5 );
+      mask= e->flags&NATIVE_FLAGS_ARITH;
+      break;
+    case IA32_XOR32:
+      native_binop ( p, e, 0x31, 6 );
+      mask= e->flags&NATIVE_FLAGS_LOGIC;
+      break;
+    case IA32_CMP32:
+      native_binop ( p, e, 0x39, 7 );
+      mask= e->flags&NATIVE_FLAGS_ARITH;
+      break;
+    case IA32_TEST32:
+      src= native_reg ( e->inst.ops[1].type );
+      if ( src != -1 ) native_rr ( p, 0x85, dst, NATIVE_HREG ( src ) );
+      else
+        {
+          native_r ( p, 0xF7, 0, dst );
+          native_u32 ( p, e->inst.ops[1].u32 );
+        }
+      mask= e->flags&NATIVE_FLAGS_LOGIC;
+      break;
+    case IA32_INC32:
+      native_r ( p, 0xFF, 0, dst );
+      mask= e->flags&NATIVE_FLAGS_INCDEC;
+      break;
+    case IA32_DEC32:
+      native_r ( p, 0xFF, 1, dst );
+      mask= e->flags&NATIVE_FLAGS_INCDEC;
+      break;
+    case IA32_NOT32:
+      native_r ( p, 0xF7, 2, dst );
+      mask= 0;
+      break;
+    case IA32_NEG32:
+      native_r ( p, 0xF7, 3, dst );
+      mask= e->flags&NATIVE_FLAGS_ARITH;
+      break;
+    default:
+      fprintf ( FERROR, "[EE] jit.c - native_inst: instrucció no"
+                " suportada %d\n", e->inst.name );
+      exit ( EXIT_FAILURE );
+    }
+
+  // Igual que el bytecode, en les operacions lògiques OF i CF es
+  // netegen juntes.
+  if ( (mask&(OF_FLAG|CF_FLAG)) != 0 &&
+       (e->inst.name == IA32_AND32 ||
+        e->inst.name == IA32_OR32 ||
+        e->inst.name == IA32_XOR32 ||
+        e->inst.name == IA32_TEST32) )
+    mask|= OF_FLAG|CF_FLAG;
+  native_flags ( p, mask );
+
+} // end native_inst
+
+
+// Torna el nombre d'instruccions consecutives a partir de 'e' que es
+// poden traduir (com a màxim N). Sols cobreix les operacions ALU de 32
+// bits entre registres o amb immediat de native_supported: una
+// instrucció amb operands en memòria, un bot o qualsevol cosa que pot
+// generar una excepció talla la seqüència i s'executa amb bytecode.
+static int
+native_run_length (
+                   const IA32_JIT_DisEntry *e,
+                   const size_t             N
+                   )
+{
+
+  size_t n;
+
+
+  for ( n= 0;
+        n < N && n < NATIVE_MAX_INSTS && native_supported ( &(e[n]) );
+        ++n );
+
+  return (int) n;
+
+} // end native_run_length
+
+
+// Tradueix les 'N' instruccions de 'e'. Torna en 'offset' la posició
+// de la funció dins del buffer natiu de la pàgina, que queda
+// executable. Torna false si no s'ha pogut reservar memòria o canviar
+// els permisos.
+static bool
+native_compile (
+                IA32_JIT_Page           *p,
+                const IA32_JIT_DisEntry *e,
+                const int                N,
+                uint32_t                *offset
+                )
+{
+
+  int n,reg;
+  bool used[8],written[8];
+  uint32_t eip_inc;
+
+
+  if ( !native_reserve ( p, 128 + N*NATIVE_MAX_INST_BYTES ) )
+    return false;
+  *offset= p->native_N;
+
+  // Registres emprats.
+  for ( reg= 0; reg < 8; ++reg ) used[reg]= written[reg]= false;
+  eip_inc= 0;
+  for ( n= 0; n < N; ++n )
+    {
+      reg= native_reg ( e[n].inst.ops[0].type );
+      used[reg]= true;
+      if ( e[n].inst.name != IA32_CMP32 && e[n].inst.name != IA32_TEST32 )
+        written[reg]= true;
+      reg= native_reg ( e[n].inst.ops[1].type );
+      if ( reg != -1 ) used[reg]= true;
+      eip_inc+= (uint32_t) e[n].inst.real_nbytes;
+    }
+
+  // Pròleg: r12-r15 s'han de preservar.
+  for ( reg= 4; reg < 8; ++reg )
+    if ( used[reg] ) { native_b ( p, 0x41 ); native_b ( p, 0x50 + reg ); }
+  for ( reg= 0; reg < 8; ++reg )
+    if ( used[reg] )
+      native_mem ( p, 0x8B, NATIVE_HREG ( reg ), NATIVE_REG_OFF[reg] );
+
+  // Cos.
+  for ( n= 0; n < N; ++n )
+    native_inst ( p, &(e[n]) );
+
+  // Epíleg.
+  for ( reg= 0; reg < 8; ++reg )
+    if ( written[reg] )
+      native_mem ( p, 0x89, NATIVE_HREG ( reg ), NATIVE_REG_OFF[reg] );
+  native_b ( p, 0x81 ); // add dword [rdi+eip],eip_inc
+  native_b ( p, 0x87 );
+  native_u32 ( p, NATIVE_EIP_OFF );
+  native_u32 ( p, eip_inc );
+  for ( reg= 7; reg >= 4; --reg )
+    if ( used[reg] ) { native_b ( p, 0x41 ); native_b ( p, 0x58 + reg ); }
+  native_b ( p, 0xC3 ); // ret
+
+  return mprotect ( p->native, p->native_capacity,
+                    PROT_READ|PROT_EXEC ) == 0;
+
+} // end native_compile
+
+
+#endif // IA32_JIT_NATIVE
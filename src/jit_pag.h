@@ -29,11 +29,15 @@
 #define PDE_RW      0x00000002
 #define PDE_US      0x00000004
 #define PDE_PS      0x00000080
+#define PDE_G       0x00000100
 #define PDE_PTEADDR 0xFFFFF000
+#define PDE_4MBADDR 0xFFC00000
+#define PDE_4MBRSVD 0x003FE000 // Sense PSE-36 (MAXPHYADDR = 32)
 
 #define PTE_P       0x00000001
 #define PTE_RW      0x00000002
 #define PTE_US      0x00000004
+#define PTE_G       0x00000100
 
 #define ECODE_P    0x0001
 #define ECODE_WR   0x0002
@@ -44,11 +48,84 @@
 
 #define IA32_JIT_P32_L2_4KB_SIZE 1024
 
+// Permisos d'una entrada del TLB.
+#define P32_TLB_READ  0x1
+#define P32_TLB_WRITE 0x2
+#define P32_TLB_EXEC  0x4
+#define P32_TLB_GLOBAL 0x8 // Pàgina global (CR4.PGE), sobreviu a CR3
+
+#define P32_TLB_MASK (IA32_JIT_P32_TLB_SIZE-1)
+
+// Marcs físics de 4KB amb taules de pàgines (IA32_JIT_Paging32b.pt_bitmap).
+// Pot haver bits de taules que ja no s'usen, sols costen una cerca.
+#define P32_PT_BITMAP_SIZE (1<<(32-12-5))
+#define P32_IS_PT_FRAME(P32,ADDR)                                       \
+  (((P32)->pt_bitmap[((uint32_t) (ADDR))>>(12+5)]>>                     \
+    ((((uint32_t) (ADDR))>>12)&0x1F))&0x1)
+#define P32_SET_PT_FRAME(P32,ADDR)                                      \
+  ((P32)->pt_bitmap[((uint32_t) (ADDR))>>(12+5)]|=                      \
+   1<<((((uint32_t) (ADDR))>>12)&0x1F))
+
 
 
 
 // FUNCIONS
 
+static void
+paging_32b_tlb_flush (
+                      IA32_JIT_Paging32b *p32
+                      )
+{
+
+  int n;
+
+
+  for ( n= 0; n < IA32_JIT_P32_TLB_SIZE; ++n )
+    {
+      p32->tlb[0][n].perm= 0;
+      p32->tlb[1][n].perm= 0;
+    }
+  
+} // end paging_32b_tlb_flush
+
+
+static void
+paging_32b_tlb_flush_page (
+                           IA32_JIT_Paging32b *p32,
+                           const uint32_t      addr
+                           )
+{
+
+  int ind;
+  
+
+  ind= (int) ((addr>>12)&P32_TLB_MASK);
+  p32->tlb[0][ind].perm= 0;
+  p32->tlb[1][ind].perm= 0;
+  
+} // end paging_32b_tlb_flush_page
+
+
+// Torna l'entrada del TLB per a 'addr' si està i permet l'accés
+// 'perm' amb el CPL actual, NULL en cas contrari.
+static inline IA32_JIT_P32_TLB *
+paging_32b_tlb_get (
+                    IA32_JIT       *jit,
+                    const uint32_t  addr,
+                    const uint32_t  perm
+                    )
+{
+
+  IA32_JIT_P32_TLB *e;
+
+
+  e= &(jit->_pag32->tlb[CPL<3][(addr>>12)&P32_TLB_MASK]);
+  
+  return (e->vpn == (addr>>12) && (e->perm&perm) != 0) ? e : NULL;
+  
+} // end paging_32b_tlb_get
+
+
 static void
 paging_32b_free (
                  IA32_JIT_Paging32b *p32
@@ -64,6 +141,7 @@ paging_32b_free (
       if ( p32->v[ind].v4kB != NULL )
         free ( p32->v[ind].v4kB );
     }
+  free ( p32->pt_bitmap );
   free ( p32 );
   
 } // end paging_32b_free
@@ -79,6 +157,7 @@ paging_32b_new (void)
   
 
   ret= (IA32_JIT_Paging32b *) malloc__ ( sizeof(IA32_JIT_Paging32b) );
+  ret->valid= false;
   ret->N= 0;
   for ( n= 0; n < IA32_JIT_P32_L1_SIZE; ++n )
     {
@@ -88,6 +167,11 @@ paging_32b_new (void)
   ret->addr_min= 0;
   ret->addr_max= 0;
   ret->base_addr= 0;
+  ret->pt_bitmap= (uint32_t *)
+    malloc__ ( sizeof(uint32_t)*P32_PT_BITMAP_SIZE );
+  for ( n= 0; n < P32_PT_BITMAP_SIZE; ++n )
+    ret->pt_bitmap[n]= 0;
+  paging_32b_tlb_flush ( ret );
   
   return ret;
   
@@ -101,6 +185,7 @@ paging_32b_clear (
 {
 
   int n,i;
+  uint32_t w,w_e;
 
 
   for ( n= 0; n < p32->N; ++n )
@@ -114,47 +199,161 @@ paging_32b_clear (
         }
     }
   p32->N= 0;
+  // Tots els bits actius estan dins de [addr_min,addr_max).
+  if ( p32->addr_max > p32->addr_min )
+    {
+      w_e= ((uint32_t) (p32->addr_max-1))>>(12+5);
+      for ( w= ((uint32_t) p32->addr_min)>>(12+5); w <= w_e; ++w )
+        p32->pt_bitmap[w]= 0;
+    }
   p32->addr_min= 0;
   p32->addr_max= 0;
   p32->base_addr= 0;
+  p32->valid= false;
+  paging_32b_tlb_flush ( p32 );
   
 } // end paging_32b_clear
 
 
+static void
+paging_32b_tlb_flush_all (
+                          IA32_JIT *jit
+                          )
+{
+
+  int n;
+
+
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    paging_32b_tlb_flush ( jit->_pag32_v[n] );
+  
+} // end paging_32b_tlb_flush_all
+
+
+// Les entrades globals són les úniques del TLB que no es mantenen
+// coherents amb les taules (poden vindre d'altre espai), per això
+// INVLPG les descarta totes.
+static void
+paging_32b_tlb_flush_global (
+                             IA32_JIT *jit
+                             )
+{
+
+  IA32_JIT_Paging32b *p32;
+  int n,i;
+  
+
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    {
+      p32= jit->_pag32_v[n];
+      for ( i= 0; i < IA32_JIT_P32_TLB_SIZE; ++i )
+        {
+          if ( p32->tlb[0][i].perm&P32_TLB_GLOBAL ) p32->tlb[0][i].perm= 0;
+          if ( p32->tlb[1][i].perm&P32_TLB_GLOBAL ) p32->tlb[1][i].perm= 0;
+        }
+    }
+  
+} // end paging_32b_tlb_flush_global
+
+
+// Copia en les entrades buides del TLB de 'dst' les pàgines globals
+// de 'src'.
+static void
+paging_32b_tlb_copy_global (
+                            IA32_JIT_Paging32b       *dst,
+                            const IA32_JIT_Paging32b *src
+                            )
+{
+
+  int k,i;
+
+
+  for ( k= 0; k < 2; ++k )
+    for ( i= 0; i < IA32_JIT_P32_TLB_SIZE; ++i )
+      if ( (src->tlb[k][i].perm&P32_TLB_GLOBAL) && dst->tlb[k][i].perm == 0 )
+        dst->tlb[k][i]= src->tlb[k][i];
+  
+} // end paging_32b_tlb_copy_global
+
+
+// Activa l'espai d'adreces de CR3. Si ja estava en memòria es
+// reutilitza tal qual, si no s'ocupa el menys recent.
 static void
 paging_32b_CR3_changed (
                         IA32_JIT *jit
                         )
 {
 
-  IA32_JIT_Paging32b *p32;
+  IA32_JIT_Paging32b *p32,*prev;
+  uint64_t base_addr;
+  int n;
   
   
-  p32= jit->_pag32;
-  paging_32b_clear ( p32 );
-  p32->base_addr= (uint64_t) (CR3&CR3_PDB);
-  p32->addr_min= p32->base_addr;
-  p32->addr_max= p32->base_addr + (1<<12); // 1024 entrades de 4 bytes
+  invalidate_links ( jit );
+  prev= jit->_pag32;
+  base_addr= (uint64_t) (CR3&CR3_PDB);
+  for ( n= 0;
+        n < IA32_JIT_P32_SPACES &&
+          !(jit->_pag32_v[n]->valid && jit->_pag32_v[n]->base_addr==base_addr);
+        ++n );
+  if ( n == IA32_JIT_P32_SPACES )
+    {
+      for ( n= 0; n < IA32_JIT_P32_SPACES-1 && jit->_pag32_v[n]->valid; ++n );
+      p32= jit->_pag32_v[n];
+      paging_32b_clear ( p32 );
+      p32->valid= true;
+      p32->base_addr= base_addr;
+      p32->addr_min= p32->base_addr;
+      p32->addr_max= p32->base_addr + (1<<12); // 1024 entrades de 4 bytes
+      P32_SET_PT_FRAME ( p32, p32->base_addr );
+    }
+  else p32= jit->_pag32_v[n];
+  
+  // Mou al principi.
+  for ( ; n > 0; --n )
+    jit->_pag32_v[n]= jit->_pag32_v[n-1];
+  jit->_pag32_v[0]= p32;
+  jit->_pag32= p32;
+
+  // Pàgines globals.
+  if ( p32 != prev && (CR4&CR4_PGE) )
+    paging_32b_tlb_copy_global ( p32, prev );
   
 } // end paging_32b_CR3_changed
 
 
+// Descarta tots els espais i torna a carregar el de CR3. S'ha de
+// cridar quan les taules poden haver canviat sense passar pel JIT.
+static void
+paging_32b_reset (
+                  IA32_JIT *jit
+                  )
+{
+
+  int n;
+
+
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    paging_32b_clear ( jit->_pag32_v[n] );
+  paging_32b_CR3_changed ( jit );
+  
+} // end paging_32b_reset
+
+
 static void
 paging_32b_alloc_page (
-                       IA32_JIT       *jit,
-                       const uint32_t  addr,
-                       const bool      add_actives
+                       IA32_JIT           *jit,
+                       IA32_JIT_Paging32b *p32,
+                       const uint32_t      addr,
+                       const bool          add_actives
                        )
 {
 
-  IA32_JIT_Paging32b *p32;
   uint64_t pde_addr,end_addr;
   uint32_t pde;
   int ind,n;
   
 
-  p32= jit->_pag32;
-
   // Llig pde
   pde_addr= (uint64_t) (p32->base_addr | ((addr>>22)<<2));
   pde= READU32 ( pde_addr );
@@ -163,32 +362,33 @@ paging_32b_alloc_page (
   // Inicialitza.
   p32->v[ind].active= true;
   p32->v[ind].error= ((pde&PDE_P) == 0);
+  p32->v[ind].pse_enabled= ((CR4&CR4_PSE)!=0);
   if ( !p32->v[ind].error )
     {
-      p32->v[ind].pse_enabled= ((CR4&CR4_PSE)!=0);
       p32->v[ind].svm_addr= ((pde&PDE_US)==0);
       p32->v[ind].writing_allowed= ((pde&PDE_RW)!=0);
       p32->v[ind].is4KB= !p32->v[ind].pse_enabled || ((pde&PDE_PS) == 0);
       if ( !p32->v[ind].is4KB )
         {
-          fprintf ( stderr, "[CAL_IMPLEMENTAR] paging_32b_alloc_page - 4MB\n" );
-          exit ( EXIT_FAILURE );
+          // Una única entrada per a tota la pàgina. Els bits
+          // reservats es comproven en cada accés.
+          p32->v[ind].rsvd= (pde&PDE_4MBRSVD) != 0;
+          p32->v[ind].global= (pde&PDE_G) != 0;
+          p32->v[ind].base_addr= (uint64_t) (pde&PDE_4MBADDR);
         }
       else
         {
-          if ( p32->v[ind].pse_enabled )
-            {
-              // NOTA!! Quan s'implemente igual és alguna cosa que es
-              // comprova en execució i no ací.
-              fprintf ( stderr, "[CAL_IMPLEMENTAR] paging_32b_alloc_page"
-                        " - 4KB comprovació reserved bits\n" );
-              exit ( EXIT_FAILURE );
-            }
+          // En 32-bit paging les entrades de 4KB no tenen bits
+          // reservats, encara que CR4.PSE estiga activat (el bit 7
+          // de la PTE és PAT).
+          p32->v[ind].rsvd= false;
+          p32->v[ind].global= false;
           p32->v[ind].v4kB= (IA32_JIT_P32_L2_4KB *)
             malloc__ ( sizeof(IA32_JIT_P32_L2_4KB)*IA32_JIT_P32_L2_4KB_SIZE );
           for ( n= 0; n < IA32_JIT_P32_L2_4KB_SIZE; ++n )
             p32->v[ind].v4kB[n].active= false;
           p32->v[ind].base_addr= (uint64_t) (pde&PDE_PTEADDR);
+          P32_SET_PT_FRAME ( p32, p32->v[ind].base_addr );
           end_addr= p32->v[ind].base_addr + 4*1024;
           if ( p32->v[ind].base_addr < p32->addr_min )
             p32->addr_min= p32->v[ind].base_addr;
@@ -233,6 +433,7 @@ paging_32b_active_4kB (
         (pte&PTE_US) == 0 ? true : pde->svm_addr;
       pde->v4kB[ind].writing_allowed=
         (pte&PTE_RW) == 0 ? false : pde->writing_allowed;
+      pde->v4kB[ind].global= (pte&PTE_G) != 0;
       pde->v4kB[ind].base_addr= (uint64_t) (pte&0xFFFFF000);
     }
 
@@ -339,6 +540,54 @@ paging_32b_check_access (
 } // end paging_32b_check_access
 
 
+// Desa en el TLB una traducció vàlida de la pàgina de 4KB 'frame'
+// (també per a les parts de 4KB d'una pàgina de 4MB).
+static void
+paging_32b_tlb_fill (
+                     IA32_JIT       *jit,
+                     const uint32_t  addr,
+                     const bool      explicit_svm,
+                     const bool      svm_addr,
+                     const bool      writing_allowed,
+                     const bool      global,
+                     const uint64_t  frame
+                     )
+{
+
+  IA32_JIT_P32_TLB *e;
+  uint32_t perm;
+  
+  
+  // Amb SMAP l'accés del supervisor a pàgines d'usuari depén de
+  // EFLAGS.AC, que no es vigila.
+  if ( explicit_svm && !svm_addr && (CR4&CR4_SMAP) != 0 )
+    return;
+
+  // Permisos.
+  perm= 0;
+  if ( paging_32b_check_access ( jit, explicit_svm, false, svm_addr,
+                                 writing_allowed, false, false ) )
+    perm|= P32_TLB_READ;
+  if ( paging_32b_check_access ( jit, explicit_svm, false, svm_addr,
+                                 writing_allowed, false, true ) )
+    perm|= P32_TLB_WRITE;
+  if ( paging_32b_check_access ( jit, explicit_svm, false, svm_addr,
+                                 writing_allowed, true, false ) )
+    perm|= P32_TLB_EXEC;
+  if ( perm == 0 ) return;
+  if ( global && (CR4&CR4_PGE) ) perm|= P32_TLB_GLOBAL;
+
+  // Desa.
+  e= &(jit->_pag32->tlb[explicit_svm][(addr>>12)&P32_TLB_MASK]);
+  e->vpn= addr>>12;
+  e->perm= perm;
+  e->frame= frame;
+  e->host= jit->mem_host_page!=NULL ?
+    jit->mem_host_page ( jit->udata, frame ) : NULL;
+  
+} // end paging_32b_tlb_fill
+
+
 // Torna cert si ha anat tot bé. Si no_check_erros és cert mai falla i
 // torna alguna cosa sempre. Si no es pot traduir torna l'adreça sense
 // traduir.
@@ -369,15 +618,18 @@ paging_32b_translate (
   
   // Selecciona PDE
   i= (int) (addr>>22);
-  if ( !p32->v[i].active ) paging_32b_alloc_page ( jit, addr, true );
+  if ( !p32->v[i].active ) paging_32b_alloc_page ( jit, p32, addr, true );
   pde= &(p32->v[i]);
-  if ( pde->error ) { ecode= 0; goto error; }
-  if ( pde->pse_enabled != pse_enabled )
+  if ( pde->pse_enabled != pse_enabled ) // Ha canviat CR4.PSE
     {
-      fprintf ( stderr, "[CAL_IMPLEMENTAR] paging_32b_translate -"
-                " pde->pse_enabled != pse_enabled\n" );
-      exit ( EXIT_FAILURE );
+      if ( pde->v4kB != NULL )
+        {
+          free ( pde->v4kB );
+          pde->v4kB= NULL;
+        }
+      paging_32b_alloc_page ( jit, p32, addr, false );
     }
+  if ( pde->error ) { ecode= 0; goto error; }
 
   // Segon nivell
   if ( pde->is4KB )
@@ -395,11 +647,30 @@ paging_32b_translate (
           ecode= ECODE_P; // page-level protection violation
           goto error;
         }
+      if ( !implicit_svm )
+        paging_32b_tlb_fill ( jit, addr, explicit_svm,
+                              pde->v4kB[j].svm_addr,
+                              pde->v4kB[j].writing_allowed,
+                              pde->v4kB[j].global,
+                              pde->v4kB[j].base_addr );
     }
-  else
+  else // 4MB
     {
-      fprintf ( stderr, "[CAL_IMPLEMENTAR] paging_32b_translate - 4MB\n" );
-      exit ( EXIT_FAILURE );
+      if ( pde->rsvd ) { ecode= ECODE_P|ECODE_RSVD; goto error; }
+      *laddr= pde->base_addr | ((uint64_t) (addr&0x003FFFFF));
+      if ( !paging_32b_check_access ( jit, explicit_svm, implicit_svm,
+                                      pde->svm_addr, pde->writing_allowed,
+                                      ifetch, writing ) )
+        {
+          ecode= ECODE_P; // page-level protection violation
+          goto error;
+        }
+      if ( !implicit_svm )
+        paging_32b_tlb_fill ( jit, addr, explicit_svm,
+                              pde->svm_addr, pde->writing_allowed,
+                              pde->global,
+                              pde->base_addr |
+                              ((uint64_t) (addr&0x003FF000)) );
     }
   
   return true;
@@ -415,78 +686,119 @@ paging_32b_translate (
 } // end paging_32b_translate
 
 
-// Es crida cada vegada que s'escriu en una adreça. IMPORTANT!!! S'ha
-// de cridar després d'haver-se actualitzat en memòria.
+// Actualitza l'espai 'p32' després d'escriure en 'addr', que està en
+// un dels seus marcs amb taules.
 static void
-paging_32b_addr_changed (
-                         IA32_JIT       *jit,
-                         const uint64_t  addr
-                         )
+paging_32b_space_addr_changed (
+                               IA32_JIT           *jit,
+                               IA32_JIT_Paging32b *p32,
+                               const uint64_t      addr
+                               )
 {
 
-  IA32_JIT_Paging32b *p32;
   IA32_JIT_P32_L1 *pde;
-  uint64_t addr_tmp;
+  uint64_t frame;
   int ind,n;
   uint32_t fake_addr;
-  bool stop;
+  bool current;
   
   
-  p32= jit->_pag32;
-  if ( addr >= p32->addr_min && addr < p32->addr_max )
+  current= p32 == jit->_pag32;
+  frame= addr&~((uint64_t) 0xFFF);
+  
+  // Entrades de la taula.
+  if ( frame == p32->base_addr )
     {
-
-      // Entrades de la taula.
-      addr_tmp= p32->base_addr + (1<<12);
-      if ( addr >= p32->base_addr && addr < addr_tmp )
+      ind= (int) ((addr-p32->base_addr)>>2);
+      // Reactiva
+      if ( p32->v[ind].active )
         {
-          ind= (int) ((addr-p32->base_addr)>>2);
-          // Reactiva
-          if ( p32->v[ind].active )
+          if ( current ) invalidate_links ( jit );
+          paging_32b_tlb_flush ( p32 );
+          p32->v[ind].active= false;
+          if ( p32->v[ind].v4kB != NULL )
             {
-              p32->v[ind].active= false;
-              if ( p32->v[ind].v4kB != NULL )
-                {
-                  free ( p32->v[ind].v4kB );
-                  p32->v[ind].v4kB= NULL;
-                }
-              fake_addr= ((uint32_t) ind)<<22;
-              paging_32b_alloc_page ( jit, fake_addr, false );
+              free ( p32->v[ind].v4kB );
+              p32->v[ind].v4kB= NULL;
             }
+          fake_addr= ((uint32_t) ind)<<22;
+          paging_32b_alloc_page ( jit, p32, fake_addr, false );
         }
-      
-      // Entrades nivell 2
-      else
+    }
+  
+  // Entrades nivell 2. El directori pot fer també de taula i una
+  // mateixa taula pot estar en varies entrades del directori.
+  ind= (int) ((addr&0xFFF)>>2);
+  for ( n= 0; n < p32->N; ++n )
+    {
+      pde= &p32->v[p32->a[n]];
+      if ( pde->error ) continue;
+      // Recarrega (les pàgines de 4MB no tenen taula)
+      if ( pde->is4KB && pde->base_addr == frame && pde->v4kB[ind].active )
         {
-          stop= false;
-          for ( n= 0; n < p32->N && !stop; ++n )
-            {
-              pde= &p32->v[p32->a[n]];
-              if ( pde->error ) continue;
-              if ( pde->is4KB )
-                {
-                  addr_tmp= pde->base_addr + (1<<12);
-                  if ( addr >= pde->base_addr && addr < addr_tmp )
-                    {
-                      stop= true;
-                      ind= (int) ((addr-pde->base_addr)>>2);
-                      // Recarrega
-                      if ( pde->v4kB[ind].active )
-                        {
-                          fake_addr= ((uint32_t) ind)<<12;
-                          paging_32b_active_4kB ( jit, pde, fake_addr );
-                        }
-                    }
-                }
-              else
-                {
-                  fprintf ( stderr,"[CAL_IMPLEMENTAR] paging_32b_addr_changed -"
-                            " 4MB!!\n" );
-                  exit ( EXIT_FAILURE );
-                }
-            }
+          if ( current ) invalidate_links ( jit );
+          paging_32b_tlb_flush_page
+            ( p32, (((uint32_t) p32->a[n])<<22) | (((uint32_t) ind)<<12) );
+          fake_addr= ((uint32_t) ind)<<12;
+          paging_32b_active_4kB ( jit, pde, fake_addr );
         }
-      
+    }
+  
+} // end paging_32b_space_addr_changed
+
+
+// Es crida cada vegada que s'escriu en una adreça. IMPORTANT!!! S'ha
+// de cridar després d'haver-se actualitzat en memòria. Actualitza tots
+// els espais en memòria, no sols l'actiu.
+static void
+paging_32b_addr_changed (
+                         IA32_JIT       *jit,
+                         const uint64_t  addr
+                         )
+{
+
+  IA32_JIT_Paging32b *p32;
+  int n;
+  
+  
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    {
+      p32= jit->_pag32_v[n];
+      if ( p32->valid && P32_IS_PT_FRAME ( p32, addr ) )
+        paging_32b_space_addr_changed ( jit, p32, addr );
     }
   
 } // end paging_32b_addr_changed
+
+
+// Descarta els espais amb taules dins de [begin,last] (l'embolcall ha
+// canviat la memòria sense passar pel JIT). Si és l'actiu es torna a
+// carregar.
+static void
+paging_32b_area_remapped (
+                          IA32_JIT       *jit,
+                          const uint32_t  begin,
+                          const uint32_t  last
+                          )
+{
+
+  IA32_JIT_Paging32b *p32;
+  bool reload;
+  int n;
+
+
+  reload= false;
+  for ( n= 0; n < IA32_JIT_P32_SPACES; ++n )
+    {
+      p32= jit->_pag32_v[n];
+      if ( p32->valid &&
+           (uint64_t) begin < p32->addr_max &&
+           (uint64_t) last >= p32->addr_min )
+        {
+          if ( p32 == jit->_pag32 ) reload= true;
+          paging_32b_clear ( p32 );
+        }
+    }
+  if ( reload ) paging_32b_CR3_changed ( jit );
+  
+} // end paging_32b_area_remapped